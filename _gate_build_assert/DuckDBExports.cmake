@@ -0,0 +1,164 @@
+# Generated by CMake
+
+if("${CMAKE_MAJOR_VERSION}.${CMAKE_MINOR_VERSION}" LESS 2.8)
+   message(FATAL_ERROR "CMake >= 2.8.0 required")
+endif()
+if(CMAKE_VERSION VERSION_LESS "2.8.3")
+   message(FATAL_ERROR "CMake >= 2.8.3 required")
+endif()
+cmake_policy(PUSH)
+cmake_policy(VERSION 2.8.3...3.23)
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Protect against multiple inclusion, which would fail when already imported targets are added once more.
+set(_cmake_targets_defined "")
+set(_cmake_targets_not_defined "")
+set(_cmake_expected_targets "")
+foreach(_cmake_expected_target IN ITEMS duckdb duckdb_static duckdb_fmt duckdb_pg_query duckdb_re2 duckdb_miniz utf8proc duckdb_hyperloglog)
+  list(APPEND _cmake_expected_targets "${_cmake_expected_target}")
+  if(TARGET "${_cmake_expected_target}")
+    list(APPEND _cmake_targets_defined "${_cmake_expected_target}")
+  else()
+    list(APPEND _cmake_targets_not_defined "${_cmake_expected_target}")
+  endif()
+endforeach()
+unset(_cmake_expected_target)
+if(_cmake_targets_defined STREQUAL _cmake_expected_targets)
+  unset(_cmake_targets_defined)
+  unset(_cmake_targets_not_defined)
+  unset(_cmake_expected_targets)
+  unset(CMAKE_IMPORT_FILE_VERSION)
+  cmake_policy(POP)
+  return()
+endif()
+if(NOT _cmake_targets_defined STREQUAL "")
+  string(REPLACE ";" ", " _cmake_targets_defined_text "${_cmake_targets_defined}")
+  string(REPLACE ";" ", " _cmake_targets_not_defined_text "${_cmake_targets_not_defined}")
+  message(FATAL_ERROR "Some (but not all) targets in this export set were already defined.\nTargets Defined: ${_cmake_targets_defined_text}\nTargets not yet defined: ${_cmake_targets_not_defined_text}\n")
+endif()
+unset(_cmake_targets_defined)
+unset(_cmake_targets_not_defined)
+unset(_cmake_expected_targets)
+
+
+# Create imported target duckdb
+add_library(duckdb SHARED IMPORTED)
+
+set_target_properties(duckdb PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/src/include"
+  INTERFACE_LINK_LIBRARIES "duckdb_fmt;duckdb_pg_query;duckdb_re2;duckdb_miniz;utf8proc;duckdb_hyperloglog;Threads::Threads"
+)
+
+# Create imported target duckdb_static
+add_library(duckdb_static STATIC IMPORTED)
+
+set_target_properties(duckdb_static PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/src/include"
+  INTERFACE_LINK_LIBRARIES "duckdb_fmt;duckdb_pg_query;duckdb_re2;duckdb_miniz;utf8proc;duckdb_hyperloglog;Threads::Threads"
+)
+
+# Create imported target duckdb_fmt
+add_library(duckdb_fmt STATIC IMPORTED)
+
+set_target_properties(duckdb_fmt PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/third_party/fmt/include"
+)
+
+# Create imported target duckdb_pg_query
+add_library(duckdb_pg_query STATIC IMPORTED)
+
+set_target_properties(duckdb_pg_query PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/third_party/libpg_query/include"
+)
+
+# Create imported target duckdb_re2
+add_library(duckdb_re2 STATIC IMPORTED)
+
+set_target_properties(duckdb_re2 PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/third_party/re2"
+)
+
+# Create imported target duckdb_miniz
+add_library(duckdb_miniz STATIC IMPORTED)
+
+set_target_properties(duckdb_miniz PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/third_party/miniz"
+)
+
+# Create imported target utf8proc
+add_library(utf8proc STATIC IMPORTED)
+
+# Create imported target duckdb_hyperloglog
+add_library(duckdb_hyperloglog STATIC IMPORTED)
+
+set_target_properties(duckdb_hyperloglog PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/third_party/hyperloglog"
+)
+
+# Import target "duckdb" for configuration "Release"
+set_property(TARGET duckdb APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(duckdb PROPERTIES
+  IMPORTED_LOCATION_RELEASE "/root/repo/_gate_build_assert/src/libduckdb.so"
+  IMPORTED_SONAME_RELEASE "libduckdb.so"
+  )
+
+# Import target "duckdb_static" for configuration "Release"
+set_property(TARGET duckdb_static APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(duckdb_static PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_gate_build_assert/src/libduckdb_static.a"
+  )
+
+# Import target "duckdb_fmt" for configuration "Release"
+set_property(TARGET duckdb_fmt APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(duckdb_fmt PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_gate_build_assert/third_party/fmt/libfmt.a"
+  )
+
+# Import target "duckdb_pg_query" for configuration "Release"
+set_property(TARGET duckdb_pg_query APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(duckdb_pg_query PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_gate_build_assert/third_party/libpg_query/libpg_query.a"
+  )
+
+# Import target "duckdb_re2" for configuration "Release"
+set_property(TARGET duckdb_re2 APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(duckdb_re2 PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_gate_build_assert/third_party/re2/libduckdb_re2.a"
+  )
+
+# Import target "duckdb_miniz" for configuration "Release"
+set_property(TARGET duckdb_miniz APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(duckdb_miniz PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_gate_build_assert/third_party/miniz/libminiz.a"
+  )
+
+# Import target "utf8proc" for configuration "Release"
+set_property(TARGET utf8proc APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(utf8proc PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_gate_build_assert/third_party/utf8proc/libutf8proc.a"
+  )
+
+# Import target "duckdb_hyperloglog" for configuration "Release"
+set_property(TARGET duckdb_hyperloglog APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(duckdb_hyperloglog PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "/root/repo/_gate_build_assert/third_party/hyperloglog/libhyperloglog.a"
+  )
+
+# This file does not depend on other imported targets which have
+# been exported from the same project but in a separate export set.
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
+cmake_policy(POP)
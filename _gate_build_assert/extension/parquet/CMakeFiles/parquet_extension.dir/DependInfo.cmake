@@ -0,0 +1,52 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/third_party/parquet/parquet_constants.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/parquet/parquet_constants.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/parquet/parquet_constants.cpp.o.d"
+  "/root/repo/third_party/parquet/parquet_types.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/parquet/parquet_types.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/parquet/parquet_types.cpp.o.d"
+  "/root/repo/third_party/snappy/snappy-sinksource.cc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/snappy/snappy-sinksource.cc.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/snappy/snappy-sinksource.cc.o.d"
+  "/root/repo/third_party/snappy/snappy.cc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/snappy/snappy.cc.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/snappy/snappy.cc.o.d"
+  "/root/repo/third_party/thrift/thrift/protocol/TProtocol.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/thrift/thrift/protocol/TProtocol.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/thrift/thrift/protocol/TProtocol.cpp.o.d"
+  "/root/repo/third_party/thrift/thrift/transport/TBufferTransports.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/thrift/thrift/transport/TBufferTransports.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/thrift/thrift/transport/TBufferTransports.cpp.o.d"
+  "/root/repo/third_party/thrift/thrift/transport/TTransportException.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/thrift/thrift/transport/TTransportException.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/thrift/thrift/transport/TTransportException.cpp.o.d"
+  "/root/repo/third_party/zstd/common/entropy_common.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/common/entropy_common.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/common/entropy_common.cpp.o.d"
+  "/root/repo/third_party/zstd/common/error_private.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/common/error_private.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/common/error_private.cpp.o.d"
+  "/root/repo/third_party/zstd/common/fse_decompress.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/common/fse_decompress.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/common/fse_decompress.cpp.o.d"
+  "/root/repo/third_party/zstd/common/xxhash.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/common/xxhash.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/common/xxhash.cpp.o.d"
+  "/root/repo/third_party/zstd/common/zstd_common.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/common/zstd_common.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/common/zstd_common.cpp.o.d"
+  "/root/repo/third_party/zstd/compress/fse_compress.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/compress/fse_compress.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/compress/fse_compress.cpp.o.d"
+  "/root/repo/third_party/zstd/compress/hist.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/compress/hist.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/compress/hist.cpp.o.d"
+  "/root/repo/third_party/zstd/compress/huf_compress.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/compress/huf_compress.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/compress/huf_compress.cpp.o.d"
+  "/root/repo/third_party/zstd/compress/zstd_compress.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/compress/zstd_compress.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/compress/zstd_compress.cpp.o.d"
+  "/root/repo/third_party/zstd/compress/zstd_compress_literals.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/compress/zstd_compress_literals.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/compress/zstd_compress_literals.cpp.o.d"
+  "/root/repo/third_party/zstd/compress/zstd_compress_sequences.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/compress/zstd_compress_sequences.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/compress/zstd_compress_sequences.cpp.o.d"
+  "/root/repo/third_party/zstd/compress/zstd_compress_superblock.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/compress/zstd_compress_superblock.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/compress/zstd_compress_superblock.cpp.o.d"
+  "/root/repo/third_party/zstd/compress/zstd_double_fast.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/compress/zstd_double_fast.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/compress/zstd_double_fast.cpp.o.d"
+  "/root/repo/third_party/zstd/compress/zstd_fast.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/compress/zstd_fast.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/compress/zstd_fast.cpp.o.d"
+  "/root/repo/third_party/zstd/compress/zstd_lazy.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/compress/zstd_lazy.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/compress/zstd_lazy.cpp.o.d"
+  "/root/repo/third_party/zstd/compress/zstd_ldm.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/compress/zstd_ldm.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/compress/zstd_ldm.cpp.o.d"
+  "/root/repo/third_party/zstd/compress/zstd_opt.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/compress/zstd_opt.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/compress/zstd_opt.cpp.o.d"
+  "/root/repo/third_party/zstd/decompress/huf_decompress.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/decompress/huf_decompress.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/decompress/huf_decompress.cpp.o.d"
+  "/root/repo/third_party/zstd/decompress/zstd_ddict.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/decompress/zstd_ddict.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/decompress/zstd_ddict.cpp.o.d"
+  "/root/repo/third_party/zstd/decompress/zstd_decompress.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/decompress/zstd_decompress.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/decompress/zstd_decompress.cpp.o.d"
+  "/root/repo/third_party/zstd/decompress/zstd_decompress_block.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/decompress/zstd_decompress_block.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/__/__/third_party/zstd/decompress/zstd_decompress_block.cpp.o.d"
+  "/root/repo/extension/parquet/column_reader.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/column_reader.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/column_reader.cpp.o.d"
+  "/root/repo/extension/parquet/parquet-extension.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/parquet-extension.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/parquet-extension.cpp.o.d"
+  "/root/repo/extension/parquet/parquet_reader.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/parquet_reader.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/parquet_reader.cpp.o.d"
+  "/root/repo/extension/parquet/parquet_statistics.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/parquet_statistics.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/parquet_statistics.cpp.o.d"
+  "/root/repo/extension/parquet/parquet_timestamp.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/parquet_timestamp.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/parquet_timestamp.cpp.o.d"
+  "/root/repo/extension/parquet/parquet_writer.cpp" "extension/parquet/CMakeFiles/parquet_extension.dir/parquet_writer.cpp.o" "gcc" "extension/parquet/CMakeFiles/parquet_extension.dir/parquet_writer.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
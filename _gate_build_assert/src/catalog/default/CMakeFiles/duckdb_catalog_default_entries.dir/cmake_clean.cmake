@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/duckdb_catalog_default_entries.dir/ub_duckdb_catalog_default_entries.cpp.o"
+  "CMakeFiles/duckdb_catalog_default_entries.dir/ub_duckdb_catalog_default_entries.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/duckdb_catalog_default_entries.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,7 @@
+// Unity Build generated by CMake
+#line 0 "default_functions.cpp"
+#include </root/repo/src/catalog/default/default_functions.cpp>
+#line 0 "default_schemas.cpp"
+#include </root/repo/src/catalog/default/default_schemas.cpp>
+#line 0 "default_views.cpp"
+#include </root/repo/src/catalog/default/default_views.cpp>
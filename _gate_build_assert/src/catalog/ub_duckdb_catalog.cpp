@@ -0,0 +1,9 @@
+// Unity Build generated by CMake
+#line 0 "catalog_entry.cpp"
+#include </root/repo/src/catalog/catalog_entry.cpp>
+#line 0 "catalog.cpp"
+#include </root/repo/src/catalog/catalog.cpp>
+#line 0 "catalog_set.cpp"
+#include </root/repo/src/catalog/catalog_set.cpp>
+#line 0 "dependency_manager.cpp"
+#include </root/repo/src/catalog/dependency_manager.cpp>
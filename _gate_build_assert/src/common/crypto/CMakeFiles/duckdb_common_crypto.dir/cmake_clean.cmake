@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/duckdb_common_crypto.dir/ub_duckdb_common_crypto.cpp.o"
+  "CMakeFiles/duckdb_common_crypto.dir/ub_duckdb_common_crypto.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/duckdb_common_crypto.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+// Unity Build generated by CMake
+#line 0 "md5.cpp"
+#include </root/repo/src/common/crypto/md5.cpp>
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/duckdb_common_enums.dir/ub_duckdb_common_enums.cpp.o"
+  "CMakeFiles/duckdb_common_enums.dir/ub_duckdb_common_enums.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/duckdb_common_enums.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/duckdb_common_serializer.dir/ub_duckdb_common_serializer.cpp.o"
+  "CMakeFiles/duckdb_common_serializer.dir/ub_duckdb_common_serializer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/duckdb_common_serializer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
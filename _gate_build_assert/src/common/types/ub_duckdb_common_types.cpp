@@ -0,0 +1,43 @@
+// Unity Build generated by CMake
+#line 0 "blob.cpp"
+#include </root/repo/src/common/types/blob.cpp>
+#line 0 "cast_helpers.cpp"
+#include </root/repo/src/common/types/cast_helpers.cpp>
+#line 0 "chunk_collection.cpp"
+#include </root/repo/src/common/types/chunk_collection.cpp>
+#line 0 "data_chunk.cpp"
+#include </root/repo/src/common/types/data_chunk.cpp>
+#line 0 "date.cpp"
+#include </root/repo/src/common/types/date.cpp>
+#line 0 "decimal.cpp"
+#include </root/repo/src/common/types/decimal.cpp>
+#line 0 "hash.cpp"
+#include </root/repo/src/common/types/hash.cpp>
+#line 0 "hugeint.cpp"
+#include </root/repo/src/common/types/hugeint.cpp>
+#line 0 "hyperloglog.cpp"
+#include </root/repo/src/common/types/hyperloglog.cpp>
+#line 0 "interval.cpp"
+#include </root/repo/src/common/types/interval.cpp>
+#line 0 "null_value.cpp"
+#include </root/repo/src/common/types/null_value.cpp>
+#line 0 "selection_vector.cpp"
+#include </root/repo/src/common/types/selection_vector.cpp>
+#line 0 "sort_keys.cpp"
+#include </root/repo/src/common/types/sort_keys.cpp>
+#line 0 "string_heap.cpp"
+#include </root/repo/src/common/types/string_heap.cpp>
+#line 0 "string_type.cpp"
+#include </root/repo/src/common/types/string_type.cpp>
+#line 0 "timestamp.cpp"
+#include </root/repo/src/common/types/timestamp.cpp>
+#line 0 "time.cpp"
+#include </root/repo/src/common/types/time.cpp>
+#line 0 "value.cpp"
+#include </root/repo/src/common/types/value.cpp>
+#line 0 "vector_buffer.cpp"
+#include </root/repo/src/common/types/vector_buffer.cpp>
+#line 0 "vector.cpp"
+#include </root/repo/src/common/types/vector.cpp>
+#line 0 "vector_constants.cpp"
+#include </root/repo/src/common/types/vector_constants.cpp>
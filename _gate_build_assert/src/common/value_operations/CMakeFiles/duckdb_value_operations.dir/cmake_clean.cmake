@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/duckdb_value_operations.dir/ub_duckdb_value_operations.cpp.o"
+  "CMakeFiles/duckdb_value_operations.dir/ub_duckdb_value_operations.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/duckdb_value_operations.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,19 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_gate_build_assert/src/common/vector_operations/ub_duckdb_vector_operations.cpp" "src/common/vector_operations/CMakeFiles/duckdb_vector_operations.dir/ub_duckdb_vector_operations.cpp.o" "gcc" "src/common/vector_operations/CMakeFiles/duckdb_vector_operations.dir/ub_duckdb_vector_operations.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_gate_build_assert/src/execution/index/art/ub_duckdb_art_index_execution.cpp" "src/execution/index/art/CMakeFiles/duckdb_art_index_execution.dir/ub_duckdb_art_index_execution.cpp.o" "gcc" "src/execution/index/art/CMakeFiles/duckdb_art_index_execution.dir/ub_duckdb_art_index_execution.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/duckdb_art_index_execution.dir/ub_duckdb_art_index_execution.cpp.o"
+  "CMakeFiles/duckdb_art_index_execution.dir/ub_duckdb_art_index_execution.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/duckdb_art_index_execution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
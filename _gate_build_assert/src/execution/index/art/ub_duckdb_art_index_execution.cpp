@@ -0,0 +1,19 @@
+// Unity Build generated by CMake
+#line 0 "art_key.cpp"
+#include </root/repo/src/execution/index/art/art_key.cpp>
+#line 0 "leaf.cpp"
+#include </root/repo/src/execution/index/art/leaf.cpp>
+#line 0 "node.cpp"
+#include </root/repo/src/execution/index/art/node.cpp>
+#line 0 "node4.cpp"
+#include </root/repo/src/execution/index/art/node4.cpp>
+#line 0 "node16.cpp"
+#include </root/repo/src/execution/index/art/node16.cpp>
+#line 0 "node48.cpp"
+#include </root/repo/src/execution/index/art/node48.cpp>
+#line 0 "node256.cpp"
+#include </root/repo/src/execution/index/art/node256.cpp>
+#line 0 "persistent_node.cpp"
+#include </root/repo/src/execution/index/art/persistent_node.cpp>
+#line 0 "art.cpp"
+#include </root/repo/src/execution/index/art/art.cpp>
@@ -0,0 +1,7 @@
+// Unity Build generated by CMake
+#line 0 "merge_join.cpp"
+#include </root/repo/src/execution/merge_join/merge_join.cpp>
+#line 0 "merge_join_complex.cpp"
+#include </root/repo/src/execution/merge_join/merge_join_complex.cpp>
+#line 0 "merge_join_simple.cpp"
+#include </root/repo/src/execution/merge_join/merge_join_simple.cpp>
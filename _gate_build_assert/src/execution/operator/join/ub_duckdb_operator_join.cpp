@@ -0,0 +1,19 @@
+// Unity Build generated by CMake
+#line 0 "physical_blockwise_nl_join.cpp"
+#include </root/repo/src/execution/operator/join/physical_blockwise_nl_join.cpp>
+#line 0 "physical_comparison_join.cpp"
+#include </root/repo/src/execution/operator/join/physical_comparison_join.cpp>
+#line 0 "physical_cross_product.cpp"
+#include </root/repo/src/execution/operator/join/physical_cross_product.cpp>
+#line 0 "physical_delim_join.cpp"
+#include </root/repo/src/execution/operator/join/physical_delim_join.cpp>
+#line 0 "physical_hash_join.cpp"
+#include </root/repo/src/execution/operator/join/physical_hash_join.cpp>
+#line 0 "physical_index_join.cpp"
+#include </root/repo/src/execution/operator/join/physical_index_join.cpp>
+#line 0 "physical_join.cpp"
+#include </root/repo/src/execution/operator/join/physical_join.cpp>
+#line 0 "physical_nested_loop_join.cpp"
+#include </root/repo/src/execution/operator/join/physical_nested_loop_join.cpp>
+#line 0 "physical_piecewise_merge_join.cpp"
+#include </root/repo/src/execution/operator/join/physical_piecewise_merge_join.cpp>
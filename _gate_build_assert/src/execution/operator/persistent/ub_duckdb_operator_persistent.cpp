@@ -0,0 +1,13 @@
+// Unity Build generated by CMake
+#line 0 "buffered_csv_reader.cpp"
+#include </root/repo/src/execution/operator/persistent/buffered_csv_reader.cpp>
+#line 0 "physical_copy_to_file.cpp"
+#include </root/repo/src/execution/operator/persistent/physical_copy_to_file.cpp>
+#line 0 "physical_delete.cpp"
+#include </root/repo/src/execution/operator/persistent/physical_delete.cpp>
+#line 0 "physical_export.cpp"
+#include </root/repo/src/execution/operator/persistent/physical_export.cpp>
+#line 0 "physical_insert.cpp"
+#include </root/repo/src/execution/operator/persistent/physical_insert.cpp>
+#line 0 "physical_update.cpp"
+#include </root/repo/src/execution/operator/persistent/physical_update.cpp>
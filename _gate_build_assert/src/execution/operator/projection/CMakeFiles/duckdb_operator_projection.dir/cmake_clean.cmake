@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/duckdb_operator_projection.dir/ub_duckdb_operator_projection.cpp.o"
+  "CMakeFiles/duckdb_operator_projection.dir/ub_duckdb_operator_projection.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/duckdb_operator_projection.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,5 @@
+// Unity Build generated by CMake
+#line 0 "physical_projection.cpp"
+#include </root/repo/src/execution/operator/projection/physical_projection.cpp>
+#line 0 "physical_unnest.cpp"
+#include </root/repo/src/execution/operator/projection/physical_unnest.cpp>
@@ -0,0 +1,19 @@
+// Unity Build generated by CMake
+#line 0 "physical_alter.cpp"
+#include </root/repo/src/execution/operator/schema/physical_alter.cpp>
+#line 0 "physical_create_index.cpp"
+#include </root/repo/src/execution/operator/schema/physical_create_index.cpp>
+#line 0 "physical_create_schema.cpp"
+#include </root/repo/src/execution/operator/schema/physical_create_schema.cpp>
+#line 0 "physical_create_sequence.cpp"
+#include </root/repo/src/execution/operator/schema/physical_create_sequence.cpp>
+#line 0 "physical_create_table.cpp"
+#include </root/repo/src/execution/operator/schema/physical_create_table.cpp>
+#line 0 "physical_create_table_as.cpp"
+#include </root/repo/src/execution/operator/schema/physical_create_table_as.cpp>
+#line 0 "physical_create_view.cpp"
+#include </root/repo/src/execution/operator/schema/physical_create_view.cpp>
+#line 0 "physical_create_function.cpp"
+#include </root/repo/src/execution/operator/schema/physical_create_function.cpp>
+#line 0 "physical_drop.cpp"
+#include </root/repo/src/execution/operator/schema/physical_drop.cpp>
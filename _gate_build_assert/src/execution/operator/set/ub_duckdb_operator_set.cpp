@@ -0,0 +1,5 @@
+// Unity Build generated by CMake
+#line 0 "physical_union.cpp"
+#include </root/repo/src/execution/operator/set/physical_union.cpp>
+#line 0 "physical_recursive_cte.cpp"
+#include </root/repo/src/execution/operator/set/physical_recursive_cte.cpp>
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/duckdb_physical_plan.dir/ub_duckdb_physical_plan.cpp.o"
+  "CMakeFiles/duckdb_physical_plan.dir/ub_duckdb_physical_plan.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/duckdb_physical_plan.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/duckdb_func_aggr.dir/ub_duckdb_func_aggr.cpp.o"
+  "CMakeFiles/duckdb_func_aggr.dir/ub_duckdb_func_aggr.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/duckdb_func_aggr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
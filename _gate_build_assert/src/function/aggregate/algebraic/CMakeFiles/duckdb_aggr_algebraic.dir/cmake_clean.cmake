@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/duckdb_aggr_algebraic.dir/ub_duckdb_aggr_algebraic.cpp.o"
+  "CMakeFiles/duckdb_aggr_algebraic.dir/ub_duckdb_aggr_algebraic.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/duckdb_aggr_algebraic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
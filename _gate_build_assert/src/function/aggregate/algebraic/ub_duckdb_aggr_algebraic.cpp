@@ -0,0 +1,9 @@
+// Unity Build generated by CMake
+#line 0 "avg.cpp"
+#include </root/repo/src/function/aggregate/algebraic/avg.cpp>
+#line 0 "covar.cpp"
+#include </root/repo/src/function/aggregate/algebraic/covar.cpp>
+#line 0 "stddev.cpp"
+#include </root/repo/src/function/aggregate/algebraic/stddev.cpp>
+#line 0 "corr.cpp"
+#include </root/repo/src/function/aggregate/algebraic/corr.cpp>
@@ -0,0 +1,29 @@
+// Unity Build generated by CMake
+#line 0 "approx_count.cpp"
+#include </root/repo/src/function/aggregate/distributive/approx_count.cpp>
+#line 0 "bitagg.cpp"
+#include </root/repo/src/function/aggregate/distributive/bitagg.cpp>
+#line 0 "count.cpp"
+#include </root/repo/src/function/aggregate/distributive/count.cpp>
+#line 0 "first.cpp"
+#include </root/repo/src/function/aggregate/distributive/first.cpp>
+#line 0 "minmax.cpp"
+#include </root/repo/src/function/aggregate/distributive/minmax.cpp>
+#line 0 "string_agg.cpp"
+#include </root/repo/src/function/aggregate/distributive/string_agg.cpp>
+#line 0 "sum.cpp"
+#include </root/repo/src/function/aggregate/distributive/sum.cpp>
+#line 0 "product.cpp"
+#include </root/repo/src/function/aggregate/distributive/product.cpp>
+#line 0 "bool.cpp"
+#include </root/repo/src/function/aggregate/distributive/bool.cpp>
+#line 0 "mode.cpp"
+#include </root/repo/src/function/aggregate/distributive/mode.cpp>
+#line 0 "arg_min_max.cpp"
+#include </root/repo/src/function/aggregate/distributive/arg_min_max.cpp>
+#line 0 "skew.cpp"
+#include </root/repo/src/function/aggregate/distributive/skew.cpp>
+#line 0 "kurtosis.cpp"
+#include </root/repo/src/function/aggregate/distributive/kurtosis.cpp>
+#line 0 "entropy.cpp"
+#include </root/repo/src/function/aggregate/distributive/entropy.cpp>
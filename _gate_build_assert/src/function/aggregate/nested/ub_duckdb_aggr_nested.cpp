@@ -0,0 +1,3 @@
+// Unity Build generated by CMake
+#line 0 "list.cpp"
+#include </root/repo/src/function/aggregate/nested/list.cpp>
@@ -0,0 +1,11 @@
+// Unity Build generated by CMake
+#line 0 "algebraic_functions.cpp"
+#include </root/repo/src/function/aggregate/algebraic_functions.cpp>
+#line 0 "distributive_functions.cpp"
+#include </root/repo/src/function/aggregate/distributive_functions.cpp>
+#line 0 "holistic_functions.cpp"
+#include </root/repo/src/function/aggregate/holistic_functions.cpp>
+#line 0 "nested_functions.cpp"
+#include </root/repo/src/function/aggregate/nested_functions.cpp>
+#line 0 "regression_functions.cpp"
+#include </root/repo/src/function/aggregate/regression_functions.cpp>
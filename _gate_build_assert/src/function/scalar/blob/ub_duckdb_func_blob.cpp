@@ -0,0 +1,5 @@
+// Unity Build generated by CMake
+#line 0 "encode.cpp"
+#include </root/repo/src/function/scalar/blob/encode.cpp>
+#line 0 "base64.cpp"
+#include </root/repo/src/function/scalar/blob/base64.cpp>
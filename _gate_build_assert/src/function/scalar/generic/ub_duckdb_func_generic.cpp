@@ -0,0 +1,13 @@
+// Unity Build generated by CMake
+#line 0 "alias.cpp"
+#include </root/repo/src/function/scalar/generic/alias.cpp>
+#line 0 "constant_or_null.cpp"
+#include </root/repo/src/function/scalar/generic/constant_or_null.cpp>
+#line 0 "current_setting.cpp"
+#include </root/repo/src/function/scalar/generic/current_setting.cpp>
+#line 0 "least.cpp"
+#include </root/repo/src/function/scalar/generic/least.cpp>
+#line 0 "stats.cpp"
+#include </root/repo/src/function/scalar/generic/stats.cpp>
+#line 0 "typeof.cpp"
+#include </root/repo/src/function/scalar/generic/typeof.cpp>
@@ -0,0 +1,7 @@
+// Unity Build generated by CMake
+#line 0 "list_value.cpp"
+#include </root/repo/src/function/scalar/nested/list_value.cpp>
+#line 0 "struct_extract.cpp"
+#include </root/repo/src/function/scalar/nested/struct_extract.cpp>
+#line 0 "struct_pack.cpp"
+#include </root/repo/src/function/scalar/nested/struct_pack.cpp>
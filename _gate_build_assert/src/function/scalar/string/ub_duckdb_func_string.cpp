@@ -0,0 +1,47 @@
+// Unity Build generated by CMake
+#line 0 "ascii.cpp"
+#include </root/repo/src/function/scalar/string/ascii.cpp>
+#line 0 "chr.cpp"
+#include </root/repo/src/function/scalar/string/chr.cpp>
+#line 0 "reverse.cpp"
+#include </root/repo/src/function/scalar/string/reverse.cpp>
+#line 0 "caseconvert.cpp"
+#include </root/repo/src/function/scalar/string/caseconvert.cpp>
+#line 0 "concat.cpp"
+#include </root/repo/src/function/scalar/string/concat.cpp>
+#line 0 "length.cpp"
+#include </root/repo/src/function/scalar/string/length.cpp>
+#line 0 "like.cpp"
+#include </root/repo/src/function/scalar/string/like.cpp>
+#line 0 "md5.cpp"
+#include </root/repo/src/function/scalar/string/md5.cpp>
+#line 0 "nfc_normalize.cpp"
+#include </root/repo/src/function/scalar/string/nfc_normalize.cpp>
+#line 0 "printf.cpp"
+#include </root/repo/src/function/scalar/string/printf.cpp>
+#line 0 "regexp.cpp"
+#include </root/repo/src/function/scalar/string/regexp.cpp>
+#line 0 "substring.cpp"
+#include </root/repo/src/function/scalar/string/substring.cpp>
+#line 0 "instr.cpp"
+#include </root/repo/src/function/scalar/string/instr.cpp>
+#line 0 "pad.cpp"
+#include </root/repo/src/function/scalar/string/pad.cpp>
+#line 0 "prefix.cpp"
+#include </root/repo/src/function/scalar/string/prefix.cpp>
+#line 0 "repeat.cpp"
+#include </root/repo/src/function/scalar/string/repeat.cpp>
+#line 0 "replace.cpp"
+#include </root/repo/src/function/scalar/string/replace.cpp>
+#line 0 "strip_accents.cpp"
+#include </root/repo/src/function/scalar/string/strip_accents.cpp>
+#line 0 "suffix.cpp"
+#include </root/repo/src/function/scalar/string/suffix.cpp>
+#line 0 "trim.cpp"
+#include </root/repo/src/function/scalar/string/trim.cpp>
+#line 0 "left_right.cpp"
+#include </root/repo/src/function/scalar/string/left_right.cpp>
+#line 0 "contains.cpp"
+#include </root/repo/src/function/scalar/string/contains.cpp>
+#line 0 "string_split.cpp"
+#include </root/repo/src/function/scalar/string/string_split.cpp>
@@ -0,0 +1,19 @@
+// Unity Build generated by CMake
+#line 0 "date_functions.cpp"
+#include </root/repo/src/function/scalar/date_functions.cpp>
+#line 0 "generic_functions.cpp"
+#include </root/repo/src/function/scalar/generic_functions.cpp>
+#line 0 "string_functions.cpp"
+#include </root/repo/src/function/scalar/string_functions.cpp>
+#line 0 "nested_functions.cpp"
+#include </root/repo/src/function/scalar/nested_functions.cpp>
+#line 0 "math_functions.cpp"
+#include </root/repo/src/function/scalar/math_functions.cpp>
+#line 0 "operators.cpp"
+#include </root/repo/src/function/scalar/operators.cpp>
+#line 0 "pragma_functions.cpp"
+#include </root/repo/src/function/scalar/pragma_functions.cpp>
+#line 0 "sequence_functions.cpp"
+#include </root/repo/src/function/scalar/sequence_functions.cpp>
+#line 0 "trigonometrics_functions.cpp"
+#include </root/repo/src/function/scalar/trigonometrics_functions.cpp>
@@ -0,0 +1,19 @@
+// Unity Build generated by CMake
+#line 0 "pragma_buffer_manager_stats.cpp"
+#include </root/repo/src/function/table/sqlite/pragma_buffer_manager_stats.cpp>
+#line 0 "pragma_collations.cpp"
+#include </root/repo/src/function/table/sqlite/pragma_collations.cpp>
+#line 0 "pragma_column_statistics.cpp"
+#include </root/repo/src/function/table/sqlite/pragma_column_statistics.cpp>
+#line 0 "pragma_database_list.cpp"
+#include </root/repo/src/function/table/sqlite/pragma_database_list.cpp>
+#line 0 "pragma_database_size.cpp"
+#include </root/repo/src/function/table/sqlite/pragma_database_size.cpp>
+#line 0 "pragma_functions.cpp"
+#include </root/repo/src/function/table/sqlite/pragma_functions.cpp>
+#line 0 "pragma_table_info.cpp"
+#include </root/repo/src/function/table/sqlite/pragma_table_info.cpp>
+#line 0 "pragma_wal_stats.cpp"
+#include </root/repo/src/function/table/sqlite/pragma_wal_stats.cpp>
+#line 0 "sqlite_master.cpp"
+#include </root/repo/src/function/table/sqlite/sqlite_master.cpp>
@@ -0,0 +1,3 @@
+// Unity Build generated by CMake
+#line 0 "pragma_version.cpp"
+#include </root/repo/src/function/table/version/pragma_version.cpp>
@@ -0,0 +1,11 @@
+// Unity Build generated by CMake
+#line 0 "cast_rules.cpp"
+#include </root/repo/src/function/cast_rules.cpp>
+#line 0 "function.cpp"
+#include </root/repo/src/function/function.cpp>
+#line 0 "pragma_function.cpp"
+#include </root/repo/src/function/pragma_function.cpp>
+#line 0 "macro_function.cpp"
+#include </root/repo/src/function/macro_function.cpp>
+#line 0 "udf_function.cpp"
+#include </root/repo/src/function/udf_function.cpp>
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/duckdb_main.dir/ub_duckdb_main.cpp.o"
+  "CMakeFiles/duckdb_main.dir/ub_duckdb_main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/duckdb_main.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
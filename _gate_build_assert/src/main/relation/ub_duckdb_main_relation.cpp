@@ -0,0 +1,43 @@
+// Unity Build generated by CMake
+#line 0 "aggregate_relation.cpp"
+#include </root/repo/src/main/relation/aggregate_relation.cpp>
+#line 0 "create_table_relation.cpp"
+#include </root/repo/src/main/relation/create_table_relation.cpp>
+#line 0 "create_view_relation.cpp"
+#include </root/repo/src/main/relation/create_view_relation.cpp>
+#line 0 "delete_relation.cpp"
+#include </root/repo/src/main/relation/delete_relation.cpp>
+#line 0 "distinct_relation.cpp"
+#include </root/repo/src/main/relation/distinct_relation.cpp>
+#line 0 "explain_relation.cpp"
+#include </root/repo/src/main/relation/explain_relation.cpp>
+#line 0 "filter_relation.cpp"
+#include </root/repo/src/main/relation/filter_relation.cpp>
+#line 0 "insert_relation.cpp"
+#include </root/repo/src/main/relation/insert_relation.cpp>
+#line 0 "join_relation.cpp"
+#include </root/repo/src/main/relation/join_relation.cpp>
+#line 0 "limit_relation.cpp"
+#include </root/repo/src/main/relation/limit_relation.cpp>
+#line 0 "order_relation.cpp"
+#include </root/repo/src/main/relation/order_relation.cpp>
+#line 0 "update_relation.cpp"
+#include </root/repo/src/main/relation/update_relation.cpp>
+#line 0 "projection_relation.cpp"
+#include </root/repo/src/main/relation/projection_relation.cpp>
+#line 0 "read_csv_relation.cpp"
+#include </root/repo/src/main/relation/read_csv_relation.cpp>
+#line 0 "setop_relation.cpp"
+#include </root/repo/src/main/relation/setop_relation.cpp>
+#line 0 "subquery_relation.cpp"
+#include </root/repo/src/main/relation/subquery_relation.cpp>
+#line 0 "table_function_relation.cpp"
+#include </root/repo/src/main/relation/table_function_relation.cpp>
+#line 0 "table_relation.cpp"
+#include </root/repo/src/main/relation/table_relation.cpp>
+#line 0 "value_relation.cpp"
+#include </root/repo/src/main/relation/value_relation.cpp>
+#line 0 "view_relation.cpp"
+#include </root/repo/src/main/relation/view_relation.cpp>
+#line 0 "write_csv_relation.cpp"
+#include </root/repo/src/main/relation/write_csv_relation.cpp>
@@ -0,0 +1,21 @@
+// Unity Build generated by CMake
+#line 0 "propagate_aggregate.cpp"
+#include </root/repo/src/optimizer/statistics/expression/propagate_aggregate.cpp>
+#line 0 "propagate_between.cpp"
+#include </root/repo/src/optimizer/statistics/expression/propagate_between.cpp>
+#line 0 "propagate_case.cpp"
+#include </root/repo/src/optimizer/statistics/expression/propagate_case.cpp>
+#line 0 "propagate_cast.cpp"
+#include </root/repo/src/optimizer/statistics/expression/propagate_cast.cpp>
+#line 0 "propagate_comparison.cpp"
+#include </root/repo/src/optimizer/statistics/expression/propagate_comparison.cpp>
+#line 0 "propagate_conjunction.cpp"
+#include </root/repo/src/optimizer/statistics/expression/propagate_conjunction.cpp>
+#line 0 "propagate_constant.cpp"
+#include </root/repo/src/optimizer/statistics/expression/propagate_constant.cpp>
+#line 0 "propagate_columnref.cpp"
+#include </root/repo/src/optimizer/statistics/expression/propagate_columnref.cpp>
+#line 0 "propagate_function.cpp"
+#include </root/repo/src/optimizer/statistics/expression/propagate_function.cpp>
+#line 0 "propagate_operator.cpp"
+#include </root/repo/src/optimizer/statistics/expression/propagate_operator.cpp>
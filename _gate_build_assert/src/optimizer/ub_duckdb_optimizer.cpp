@@ -0,0 +1,33 @@
+// Unity Build generated by CMake
+#line 0 "common_aggregate_optimizer.cpp"
+#include </root/repo/src/optimizer/common_aggregate_optimizer.cpp>
+#line 0 "cse_optimizer.cpp"
+#include </root/repo/src/optimizer/cse_optimizer.cpp>
+#line 0 "deliminator.cpp"
+#include </root/repo/src/optimizer/deliminator.cpp>
+#line 0 "column_lifetime_analyzer.cpp"
+#include </root/repo/src/optimizer/column_lifetime_analyzer.cpp>
+#line 0 "expression_heuristics.cpp"
+#include </root/repo/src/optimizer/expression_heuristics.cpp>
+#line 0 "filter_combiner.cpp"
+#include </root/repo/src/optimizer/filter_combiner.cpp>
+#line 0 "filter_pushdown.cpp"
+#include </root/repo/src/optimizer/filter_pushdown.cpp>
+#line 0 "filter_pullup.cpp"
+#include </root/repo/src/optimizer/filter_pullup.cpp>
+#line 0 "in_clause_rewriter.cpp"
+#include </root/repo/src/optimizer/in_clause_rewriter.cpp>
+#line 0 "join_order_optimizer.cpp"
+#include </root/repo/src/optimizer/join_order_optimizer.cpp>
+#line 0 "optimizer.cpp"
+#include </root/repo/src/optimizer/optimizer.cpp>
+#line 0 "expression_rewriter.cpp"
+#include </root/repo/src/optimizer/expression_rewriter.cpp>
+#line 0 "regex_range_filter.cpp"
+#include </root/repo/src/optimizer/regex_range_filter.cpp>
+#line 0 "remove_unused_columns.cpp"
+#include </root/repo/src/optimizer/remove_unused_columns.cpp>
+#line 0 "statistics_propagator.cpp"
+#include </root/repo/src/optimizer/statistics_propagator.cpp>
+#line 0 "topn_optimizer.cpp"
+#include </root/repo/src/optimizer/topn_optimizer.cpp>
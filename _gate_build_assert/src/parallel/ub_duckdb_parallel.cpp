@@ -0,0 +1,11 @@
+// Unity Build generated by CMake
+#line 0 "executor.cpp"
+#include </root/repo/src/parallel/executor.cpp>
+#line 0 "pipeline.cpp"
+#include </root/repo/src/parallel/pipeline.cpp>
+#line 0 "task_executor.cpp"
+#include </root/repo/src/parallel/task_executor.cpp>
+#line 0 "task_scheduler.cpp"
+#include </root/repo/src/parallel/task_scheduler.cpp>
+#line 0 "thread_context.cpp"
+#include </root/repo/src/parallel/thread_context.cpp>
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/duckdb_parser.dir/ub_duckdb_parser.cpp.o"
+  "CMakeFiles/duckdb_parser.dir/ub_duckdb_parser.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/duckdb_parser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/duckdb_parsed_data.dir/ub_duckdb_parsed_data.cpp.o"
+  "CMakeFiles/duckdb_parsed_data.dir/ub_duckdb_parsed_data.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/duckdb_parsed_data.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
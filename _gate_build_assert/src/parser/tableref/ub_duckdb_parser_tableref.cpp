@@ -0,0 +1,15 @@
+// Unity Build generated by CMake
+#line 0 "basetableref.cpp"
+#include </root/repo/src/parser/tableref/basetableref.cpp>
+#line 0 "crossproductref.cpp"
+#include </root/repo/src/parser/tableref/crossproductref.cpp>
+#line 0 "emptytableref.cpp"
+#include </root/repo/src/parser/tableref/emptytableref.cpp>
+#line 0 "expressionlistref.cpp"
+#include </root/repo/src/parser/tableref/expressionlistref.cpp>
+#line 0 "joinref.cpp"
+#include </root/repo/src/parser/tableref/joinref.cpp>
+#line 0 "subqueryref.cpp"
+#include </root/repo/src/parser/tableref/subqueryref.cpp>
+#line 0 "table_function.cpp"
+#include </root/repo/src/parser/tableref/table_function.cpp>
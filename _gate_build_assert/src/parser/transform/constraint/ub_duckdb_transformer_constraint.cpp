@@ -0,0 +1,3 @@
+// Unity Build generated by CMake
+#line 0 "transform_constraint.cpp"
+#include </root/repo/src/parser/transform/constraint/transform_constraint.cpp>
@@ -0,0 +1,29 @@
+// Unity Build generated by CMake
+#line 0 "transform_bool_expr.cpp"
+#include </root/repo/src/parser/transform/expression/transform_bool_expr.cpp>
+#line 0 "transform_case.cpp"
+#include </root/repo/src/parser/transform/expression/transform_case.cpp>
+#line 0 "transform_cast.cpp"
+#include </root/repo/src/parser/transform/expression/transform_cast.cpp>
+#line 0 "transform_coalesce.cpp"
+#include </root/repo/src/parser/transform/expression/transform_coalesce.cpp>
+#line 0 "transform_columnref.cpp"
+#include </root/repo/src/parser/transform/expression/transform_columnref.cpp>
+#line 0 "transform_constant.cpp"
+#include </root/repo/src/parser/transform/expression/transform_constant.cpp>
+#line 0 "transform_expression.cpp"
+#include </root/repo/src/parser/transform/expression/transform_expression.cpp>
+#line 0 "transform_function.cpp"
+#include </root/repo/src/parser/transform/expression/transform_function.cpp>
+#line 0 "transform_lambda.cpp"
+#include </root/repo/src/parser/transform/expression/transform_lambda.cpp>
+#line 0 "transform_interval.cpp"
+#include </root/repo/src/parser/transform/expression/transform_interval.cpp>
+#line 0 "transform_is_null.cpp"
+#include </root/repo/src/parser/transform/expression/transform_is_null.cpp>
+#line 0 "transform_operator.cpp"
+#include </root/repo/src/parser/transform/expression/transform_operator.cpp>
+#line 0 "transform_param_ref.cpp"
+#include </root/repo/src/parser/transform/expression/transform_param_ref.cpp>
+#line 0 "transform_subquery.cpp"
+#include </root/repo/src/parser/transform/expression/transform_subquery.cpp>
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/duckdb_transformer_statement.dir/ub_duckdb_transformer_statement.cpp.o"
+  "CMakeFiles/duckdb_transformer_statement.dir/ub_duckdb_transformer_statement.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/duckdb_transformer_statement.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
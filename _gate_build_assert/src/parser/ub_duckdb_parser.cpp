@@ -0,0 +1,27 @@
+// Unity Build generated by CMake
+#line 0 "base_expression.cpp"
+#include </root/repo/src/parser/base_expression.cpp>
+#line 0 "column_definition.cpp"
+#include </root/repo/src/parser/column_definition.cpp>
+#line 0 "constraint.cpp"
+#include </root/repo/src/parser/constraint.cpp>
+#line 0 "expression_util.cpp"
+#include </root/repo/src/parser/expression_util.cpp>
+#line 0 "keyword_helper.cpp"
+#include </root/repo/src/parser/keyword_helper.cpp>
+#line 0 "parsed_expression.cpp"
+#include </root/repo/src/parser/parsed_expression.cpp>
+#line 0 "parsed_expression_iterator.cpp"
+#include </root/repo/src/parser/parsed_expression_iterator.cpp>
+#line 0 "parser.cpp"
+#include </root/repo/src/parser/parser.cpp>
+#line 0 "query_error_context.cpp"
+#include </root/repo/src/parser/query_error_context.cpp>
+#line 0 "query_node.cpp"
+#include </root/repo/src/parser/query_node.cpp>
+#line 0 "result_modifier.cpp"
+#include </root/repo/src/parser/result_modifier.cpp>
+#line 0 "tableref.cpp"
+#include </root/repo/src/parser/tableref.cpp>
+#line 0 "transformer.cpp"
+#include </root/repo/src/parser/transformer.cpp>
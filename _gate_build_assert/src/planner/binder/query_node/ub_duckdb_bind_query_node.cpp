@@ -0,0 +1,17 @@
+// Unity Build generated by CMake
+#line 0 "bind_select_node.cpp"
+#include </root/repo/src/planner/binder/query_node/bind_select_node.cpp>
+#line 0 "bind_setop_node.cpp"
+#include </root/repo/src/planner/binder/query_node/bind_setop_node.cpp>
+#line 0 "bind_recursive_cte_node.cpp"
+#include </root/repo/src/planner/binder/query_node/bind_recursive_cte_node.cpp>
+#line 0 "plan_query_node.cpp"
+#include </root/repo/src/planner/binder/query_node/plan_query_node.cpp>
+#line 0 "plan_recursive_cte_node.cpp"
+#include </root/repo/src/planner/binder/query_node/plan_recursive_cte_node.cpp>
+#line 0 "plan_select_node.cpp"
+#include </root/repo/src/planner/binder/query_node/plan_select_node.cpp>
+#line 0 "plan_setop.cpp"
+#include </root/repo/src/planner/binder/query_node/plan_setop.cpp>
+#line 0 "plan_subquery.cpp"
+#include </root/repo/src/planner/binder/query_node/plan_subquery.cpp>
@@ -0,0 +1,35 @@
+// Unity Build generated by CMake
+#line 0 "bind_call.cpp"
+#include </root/repo/src/planner/binder/statement/bind_call.cpp>
+#line 0 "bind_copy.cpp"
+#include </root/repo/src/planner/binder/statement/bind_copy.cpp>
+#line 0 "bind_create.cpp"
+#include </root/repo/src/planner/binder/statement/bind_create.cpp>
+#line 0 "bind_create_table.cpp"
+#include </root/repo/src/planner/binder/statement/bind_create_table.cpp>
+#line 0 "bind_delete.cpp"
+#include </root/repo/src/planner/binder/statement/bind_delete.cpp>
+#line 0 "bind_drop.cpp"
+#include </root/repo/src/planner/binder/statement/bind_drop.cpp>
+#line 0 "bind_explain.cpp"
+#include </root/repo/src/planner/binder/statement/bind_explain.cpp>
+#line 0 "bind_export.cpp"
+#include </root/repo/src/planner/binder/statement/bind_export.cpp>
+#line 0 "bind_insert.cpp"
+#include </root/repo/src/planner/binder/statement/bind_insert.cpp>
+#line 0 "bind_pragma.cpp"
+#include </root/repo/src/planner/binder/statement/bind_pragma.cpp>
+#line 0 "bind_relation.cpp"
+#include </root/repo/src/planner/binder/statement/bind_relation.cpp>
+#line 0 "bind_select.cpp"
+#include </root/repo/src/planner/binder/statement/bind_select.cpp>
+#line 0 "bind_set.cpp"
+#include </root/repo/src/planner/binder/statement/bind_set.cpp>
+#line 0 "bind_simple.cpp"
+#include </root/repo/src/planner/binder/statement/bind_simple.cpp>
+#line 0 "bind_update.cpp"
+#include </root/repo/src/planner/binder/statement/bind_update.cpp>
+#line 0 "bind_vacuum.cpp"
+#include </root/repo/src/planner/binder/statement/bind_vacuum.cpp>
+#line 0 "bind_show.cpp"
+#include </root/repo/src/planner/binder/statement/bind_show.cpp>
@@ -0,0 +1,33 @@
+// Unity Build generated by CMake
+#line 0 "bind_basetableref.cpp"
+#include </root/repo/src/planner/binder/tableref/bind_basetableref.cpp>
+#line 0 "bind_crossproductref.cpp"
+#include </root/repo/src/planner/binder/tableref/bind_crossproductref.cpp>
+#line 0 "bind_emptytableref.cpp"
+#include </root/repo/src/planner/binder/tableref/bind_emptytableref.cpp>
+#line 0 "bind_expressionlistref.cpp"
+#include </root/repo/src/planner/binder/tableref/bind_expressionlistref.cpp>
+#line 0 "bind_joinref.cpp"
+#include </root/repo/src/planner/binder/tableref/bind_joinref.cpp>
+#line 0 "bind_subqueryref.cpp"
+#include </root/repo/src/planner/binder/tableref/bind_subqueryref.cpp>
+#line 0 "bind_table_function.cpp"
+#include </root/repo/src/planner/binder/tableref/bind_table_function.cpp>
+#line 0 "bind_named_parameters.cpp"
+#include </root/repo/src/planner/binder/tableref/bind_named_parameters.cpp>
+#line 0 "plan_basetableref.cpp"
+#include </root/repo/src/planner/binder/tableref/plan_basetableref.cpp>
+#line 0 "plan_crossproductref.cpp"
+#include </root/repo/src/planner/binder/tableref/plan_crossproductref.cpp>
+#line 0 "plan_dummytableref.cpp"
+#include </root/repo/src/planner/binder/tableref/plan_dummytableref.cpp>
+#line 0 "plan_expressionlistref.cpp"
+#include </root/repo/src/planner/binder/tableref/plan_expressionlistref.cpp>
+#line 0 "plan_joinref.cpp"
+#include </root/repo/src/planner/binder/tableref/plan_joinref.cpp>
+#line 0 "plan_subqueryref.cpp"
+#include </root/repo/src/planner/binder/tableref/plan_subqueryref.cpp>
+#line 0 "plan_table_function.cpp"
+#include </root/repo/src/planner/binder/tableref/plan_table_function.cpp>
+#line 0 "plan_cteref.cpp"
+#include </root/repo/src/planner/binder/tableref/plan_cteref.cpp>
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/duckdb_planner_operator.dir/ub_duckdb_planner_operator.cpp.o"
+  "CMakeFiles/duckdb_planner_operator.dir/ub_duckdb_planner_operator.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/duckdb_planner_operator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+// Unity Build generated by CMake
+#line 0 "logical_aggregate.cpp"
+#include </root/repo/src/planner/operator/logical_aggregate.cpp>
+#line 0 "logical_empty_result.cpp"
+#include </root/repo/src/planner/operator/logical_empty_result.cpp>
+#line 0 "logical_any_join.cpp"
+#include </root/repo/src/planner/operator/logical_any_join.cpp>
+#line 0 "logical_comparison_join.cpp"
+#include </root/repo/src/planner/operator/logical_comparison_join.cpp>
+#line 0 "logical_cross_product.cpp"
+#include </root/repo/src/planner/operator/logical_cross_product.cpp>
+#line 0 "logical_filter.cpp"
+#include </root/repo/src/planner/operator/logical_filter.cpp>
+#line 0 "logical_get.cpp"
+#include </root/repo/src/planner/operator/logical_get.cpp>
+#line 0 "logical_join.cpp"
+#include </root/repo/src/planner/operator/logical_join.cpp>
+#line 0 "logical_projection.cpp"
+#include </root/repo/src/planner/operator/logical_projection.cpp>
+#line 0 "logical_unnest.cpp"
+#include </root/repo/src/planner/operator/logical_unnest.cpp>
+#line 0 "logical_window.cpp"
+#include </root/repo/src/planner/operator/logical_window.cpp>
+#line 0 "logical_distinct.cpp"
+#include </root/repo/src/planner/operator/logical_distinct.cpp>
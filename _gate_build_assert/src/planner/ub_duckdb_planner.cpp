@@ -0,0 +1,23 @@
+// Unity Build generated by CMake
+#line 0 "expression_iterator.cpp"
+#include </root/repo/src/planner/expression_iterator.cpp>
+#line 0 "expression.cpp"
+#include </root/repo/src/planner/expression.cpp>
+#line 0 "table_binding.cpp"
+#include </root/repo/src/planner/table_binding.cpp>
+#line 0 "expression_binder.cpp"
+#include </root/repo/src/planner/expression_binder.cpp>
+#line 0 "joinside.cpp"
+#include </root/repo/src/planner/joinside.cpp>
+#line 0 "logical_operator.cpp"
+#include </root/repo/src/planner/logical_operator.cpp>
+#line 0 "binder.cpp"
+#include </root/repo/src/planner/binder.cpp>
+#line 0 "bind_context.cpp"
+#include </root/repo/src/planner/bind_context.cpp>
+#line 0 "planner.cpp"
+#include </root/repo/src/planner/planner.cpp>
+#line 0 "pragma_handler.cpp"
+#include </root/repo/src/planner/pragma_handler.cpp>
+#line 0 "logical_operator_visitor.cpp"
+#include </root/repo/src/planner/logical_operator_visitor.cpp>
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/duckdb_storage_buffer.dir/ub_duckdb_storage_buffer.cpp.o"
+  "CMakeFiles/duckdb_storage_buffer.dir/ub_duckdb_storage_buffer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/duckdb_storage_buffer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,5 @@
+// Unity Build generated by CMake
+#line 0 "table_data_writer.cpp"
+#include </root/repo/src/storage/checkpoint/table_data_writer.cpp>
+#line 0 "table_data_reader.cpp"
+#include </root/repo/src/storage/checkpoint/table_data_reader.cpp>
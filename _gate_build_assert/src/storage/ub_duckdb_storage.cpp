@@ -0,0 +1,41 @@
+// Unity Build generated by CMake
+#line 0 "buffer_manager.cpp"
+#include </root/repo/src/storage/buffer_manager.cpp>
+#line 0 "checkpoint_manager.cpp"
+#include </root/repo/src/storage/checkpoint_manager.cpp>
+#line 0 "column_data.cpp"
+#include </root/repo/src/storage/column_data.cpp>
+#line 0 "compressed_segment.cpp"
+#include </root/repo/src/storage/compressed_segment.cpp>
+#line 0 "dictionary_segment.cpp"
+#include </root/repo/src/storage/dictionary_segment.cpp>
+#line 0 "block.cpp"
+#include </root/repo/src/storage/block.cpp>
+#line 0 "data_table.cpp"
+#include </root/repo/src/storage/data_table.cpp>
+#line 0 "index.cpp"
+#include </root/repo/src/storage/index.cpp>
+#line 0 "local_storage.cpp"
+#include </root/repo/src/storage/local_storage.cpp>
+#line 0 "meta_block_reader.cpp"
+#include </root/repo/src/storage/meta_block_reader.cpp>
+#line 0 "meta_block_writer.cpp"
+#include </root/repo/src/storage/meta_block_writer.cpp>
+#line 0 "numeric_segment.cpp"
+#include </root/repo/src/storage/numeric_segment.cpp>
+#line 0 "storage_manager.cpp"
+#include </root/repo/src/storage/storage_manager.cpp>
+#line 0 "write_ahead_log.cpp"
+#include </root/repo/src/storage/write_ahead_log.cpp>
+#line 0 "uncompressed_segment.cpp"
+#include </root/repo/src/storage/uncompressed_segment.cpp>
+#line 0 "single_file_block_manager.cpp"
+#include </root/repo/src/storage/single_file_block_manager.cpp>
+#line 0 "string_segment.cpp"
+#include </root/repo/src/storage/string_segment.cpp>
+#line 0 "storage_info.cpp"
+#include </root/repo/src/storage/storage_info.cpp>
+#line 0 "storage_lock.cpp"
+#include </root/repo/src/storage/storage_lock.cpp>
+#line 0 "wal_replay.cpp"
+#include </root/repo/src/storage/wal_replay.cpp>
@@ -0,0 +1,15 @@
+// Unity Build generated by CMake
+#line 0 "undo_buffer.cpp"
+#include </root/repo/src/transaction/undo_buffer.cpp>
+#line 0 "transaction_context.cpp"
+#include </root/repo/src/transaction/transaction_context.cpp>
+#line 0 "transaction.cpp"
+#include </root/repo/src/transaction/transaction.cpp>
+#line 0 "transaction_manager.cpp"
+#include </root/repo/src/transaction/transaction_manager.cpp>
+#line 0 "commit_state.cpp"
+#include </root/repo/src/transaction/commit_state.cpp>
+#line 0 "rollback_state.cpp"
+#include </root/repo/src/transaction/rollback_state.cpp>
+#line 0 "cleanup_state.cpp"
+#include </root/repo/src/transaction/cleanup_state.cpp>
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_api.dir/ub_test_api.cpp.o"
+  "CMakeFiles/test_api.dir/ub_test_api.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_api.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
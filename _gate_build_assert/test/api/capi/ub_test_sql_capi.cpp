@@ -0,0 +1,5 @@
+// Unity Build generated by CMake
+#line 0 "test_capi.cpp"
+#include </root/repo/test/api/capi/test_capi.cpp>
+#line 0 "test_starting_database.cpp"
+#include </root/repo/test/api/capi/test_starting_database.cpp>
@@ -0,0 +1,21 @@
+// Unity Build generated by CMake
+#line 0 "test_api.cpp"
+#include </root/repo/test/api/test_api.cpp>
+#line 0 "test_arrow.cpp"
+#include </root/repo/test/api/test_arrow.cpp>
+#line 0 "test_results.cpp"
+#include </root/repo/test/api/test_results.cpp>
+#line 0 "test_prepared_api.cpp"
+#include </root/repo/test/api/test_prepared_api.cpp>
+#line 0 "test_table_info.cpp"
+#include </root/repo/test/api/test_table_info.cpp>
+#line 0 "test_appender_api.cpp"
+#include </root/repo/test/api/test_appender_api.cpp>
+#line 0 "test_relation_api.cpp"
+#include </root/repo/test/api/test_relation_api.cpp>
+#line 0 "test_query_profiler.cpp"
+#include </root/repo/test/api/test_query_profiler.cpp>
+#line 0 "test_dbdir.cpp"
+#include </root/repo/test/api/test_dbdir.cpp>
+#line 0 "test_read_only.cpp"
+#include </root/repo/test/api/test_read_only.cpp>
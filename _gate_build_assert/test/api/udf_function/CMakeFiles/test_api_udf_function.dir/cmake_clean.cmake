@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_api_udf_function.dir/ub_test_api_udf_function.cpp.o"
+  "CMakeFiles/test_api_udf_function.dir/ub_test_api_udf_function.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_api_udf_function.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+// Unity Build generated by CMake
+#line 0 "test_templated_scalar_udf.cpp"
+#include </root/repo/test/api/udf_function/test_templated_scalar_udf.cpp>
+#line 0 "test_argumented_scalar_udf.cpp"
+#include </root/repo/test/api/udf_function/test_argumented_scalar_udf.cpp>
+#line 0 "test_templated_vec_udf.cpp"
+#include </root/repo/test/api/udf_function/test_templated_vec_udf.cpp>
+#line 0 "test_argumented_vec_udf.cpp"
+#include </root/repo/test/api/udf_function/test_argumented_vec_udf.cpp>
+#line 0 "test_aggregate_udf.cpp"
+#include </root/repo/test/api/udf_function/test_aggregate_udf.cpp>
@@ -0,0 +1,19 @@
+// Unity Build generated by CMake
+#line 0 "test_cast.cpp"
+#include </root/repo/test/common/test_cast.cpp>
+#line 0 "test_checksum.cpp"
+#include </root/repo/test/common/test_checksum.cpp>
+#line 0 "test_file_handle_stream.cpp"
+#include </root/repo/test/common/test_file_handle_stream.cpp>
+#line 0 "test_file_system.cpp"
+#include </root/repo/test/common/test_file_system.cpp>
+#line 0 "test_hyperlog.cpp"
+#include </root/repo/test/common/test_hyperlog.cpp>
+#line 0 "test_gzip_stream.cpp"
+#include </root/repo/test/common/test_gzip_stream.cpp>
+#line 0 "test_task_executor.cpp"
+#include </root/repo/test/common/test_task_executor.cpp>
+#line 0 "test_utf.cpp"
+#include </root/repo/test/common/test_utf.cpp>
+#line 0 "test_string_util.cpp"
+#include </root/repo/test/common/test_string_util.cpp>
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_persistence.dir/ub_test_persistence.cpp.o"
+  "CMakeFiles/test_persistence.dir/ub_test_persistence.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_persistence.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
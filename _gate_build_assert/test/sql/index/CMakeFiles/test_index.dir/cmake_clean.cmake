@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_index.dir/ub_test_index.cpp.o"
+  "CMakeFiles/test_index.dir/ub_test_index.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_index.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,5 @@
+// Unity Build generated by CMake
+#line 0 "test_art_index.cpp"
+#include </root/repo/test/sql/index/test_art_index.cpp>
+#line 0 "test_art_keys.cpp"
+#include </root/repo/test/sql/index/test_art_keys.cpp>
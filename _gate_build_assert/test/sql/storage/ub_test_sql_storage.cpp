@@ -0,0 +1,15 @@
+// Unity Build generated by CMake
+#line 0 "test_buffer_manager.cpp"
+#include </root/repo/test/sql/storage/test_buffer_manager.cpp>
+#line 0 "test_checksum.cpp"
+#include </root/repo/test/sql/storage/test_checksum.cpp>
+#line 0 "test_big_storage.cpp"
+#include </root/repo/test/sql/storage/test_big_storage.cpp>
+#line 0 "test_repeated_checkpoint.cpp"
+#include </root/repo/test/sql/storage/test_repeated_checkpoint.cpp>
+#line 0 "test_storage.cpp"
+#include </root/repo/test/sql/storage/test_storage.cpp>
+#line 0 "test_readonly.cpp"
+#include </root/repo/test/sql/storage/test_readonly.cpp>
+#line 0 "test_database_size.cpp"
+#include </root/repo/test/sql/storage/test_database_size.cpp>
@@ -0,0 +1,3 @@
+// Unity Build generated by CMake
+#line 0 "test_tpcds.cpp"
+#include </root/repo/test/sql/tpcds/test_tpcds.cpp>
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_sqlite.dir/ub_test_sqlite.cpp.o"
+  "CMakeFiles/test_sqlite.dir/ub_test_sqlite.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_sqlite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
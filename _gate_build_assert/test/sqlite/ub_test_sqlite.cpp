@@ -0,0 +1,3 @@
+// Unity Build generated by CMake
+#line 0 "test_sqllogictest.cpp"
+#include </root/repo/test/sqlite/test_sqllogictest.cpp>
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dsdgen.dir/append_info-c.cpp.o"
+  "CMakeFiles/dsdgen.dir/append_info-c.cpp.o.d"
+  "CMakeFiles/dsdgen.dir/dsdgen.cpp.o"
+  "CMakeFiles/dsdgen.dir/dsdgen.cpp.o.d"
+  "CMakeFiles/dsdgen.dir/dsdgen_helpers.cpp.o"
+  "CMakeFiles/dsdgen.dir/dsdgen_helpers.cpp.o.d"
+  "libdsdgen.a"
+  "libdsdgen.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/dsdgen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
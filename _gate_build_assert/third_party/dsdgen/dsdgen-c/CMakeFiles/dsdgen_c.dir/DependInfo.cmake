@@ -0,0 +1,68 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/third_party/dsdgen/dsdgen-c/StringBuffer.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/StringBuffer.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/StringBuffer.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/address.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/address.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/address.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/build_support.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/build_support.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/build_support.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/date.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/date.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/date.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/dbgen_version.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/dbgen_version.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/dbgen_version.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/decimal.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/decimal.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/decimal.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/dist.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/dist.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/dist.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/error_msg.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/error_msg.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/error_msg.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/genrand.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/genrand.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/genrand.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/join.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/join.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/join.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/list.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/list.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/list.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/load.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/load.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/load.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/misc.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/misc.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/misc.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/nulls.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/nulls.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/nulls.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/parallel.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/parallel.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/parallel.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/permute.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/permute.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/permute.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/pricing.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/pricing.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/pricing.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/r_params.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/r_params.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/r_params.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/release.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/release.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/release.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/scaling.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/scaling.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/scaling.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/scd.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/scd.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/scd.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/skip_days.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/skip_days.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/skip_days.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/sparse.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/sparse.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/sparse.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/tdef_functions.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/tdef_functions.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/tdef_functions.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/tdefs.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/tdefs.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/tdefs.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/text.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/text.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/text.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/w_call_center.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_call_center.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_call_center.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/w_catalog_page.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_catalog_page.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_catalog_page.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/w_catalog_returns.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_catalog_returns.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_catalog_returns.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/w_catalog_sales.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_catalog_sales.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_catalog_sales.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/w_customer.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_customer.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_customer.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/w_customer_address.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_customer_address.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_customer_address.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/w_customer_demographics.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_customer_demographics.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_customer_demographics.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/w_datetbl.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_datetbl.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_datetbl.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/w_household_demographics.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_household_demographics.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_household_demographics.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/w_income_band.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_income_band.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_income_band.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/w_inventory.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_inventory.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_inventory.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/w_item.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_item.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_item.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/w_promotion.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_promotion.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_promotion.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/w_reason.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_reason.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_reason.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/w_ship_mode.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_ship_mode.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_ship_mode.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/w_store.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_store.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_store.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/w_store_returns.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_store_returns.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_store_returns.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/w_store_sales.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_store_sales.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_store_sales.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/w_timetbl.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_timetbl.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_timetbl.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/w_warehouse.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_warehouse.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_warehouse.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/w_web_page.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_web_page.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_web_page.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/w_web_returns.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_web_returns.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_web_returns.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/w_web_sales.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_web_sales.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_web_sales.c.o.d"
+  "/root/repo/third_party/dsdgen/dsdgen-c/w_web_site.c" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_web_site.c.o" "gcc" "third_party/dsdgen/dsdgen-c/CMakeFiles/dsdgen_c.dir/w_web_site.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
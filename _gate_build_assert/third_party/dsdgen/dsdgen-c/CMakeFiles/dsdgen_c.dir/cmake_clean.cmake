@@ -0,0 +1,107 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dsdgen_c.dir/StringBuffer.c.o"
+  "CMakeFiles/dsdgen_c.dir/StringBuffer.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/address.c.o"
+  "CMakeFiles/dsdgen_c.dir/address.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/build_support.c.o"
+  "CMakeFiles/dsdgen_c.dir/build_support.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/date.c.o"
+  "CMakeFiles/dsdgen_c.dir/date.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/dbgen_version.c.o"
+  "CMakeFiles/dsdgen_c.dir/dbgen_version.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/decimal.c.o"
+  "CMakeFiles/dsdgen_c.dir/decimal.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/dist.c.o"
+  "CMakeFiles/dsdgen_c.dir/dist.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/error_msg.c.o"
+  "CMakeFiles/dsdgen_c.dir/error_msg.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/genrand.c.o"
+  "CMakeFiles/dsdgen_c.dir/genrand.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/join.c.o"
+  "CMakeFiles/dsdgen_c.dir/join.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/list.c.o"
+  "CMakeFiles/dsdgen_c.dir/list.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/load.c.o"
+  "CMakeFiles/dsdgen_c.dir/load.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/misc.c.o"
+  "CMakeFiles/dsdgen_c.dir/misc.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/nulls.c.o"
+  "CMakeFiles/dsdgen_c.dir/nulls.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/parallel.c.o"
+  "CMakeFiles/dsdgen_c.dir/parallel.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/permute.c.o"
+  "CMakeFiles/dsdgen_c.dir/permute.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/pricing.c.o"
+  "CMakeFiles/dsdgen_c.dir/pricing.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/r_params.c.o"
+  "CMakeFiles/dsdgen_c.dir/r_params.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/release.c.o"
+  "CMakeFiles/dsdgen_c.dir/release.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/scaling.c.o"
+  "CMakeFiles/dsdgen_c.dir/scaling.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/scd.c.o"
+  "CMakeFiles/dsdgen_c.dir/scd.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/skip_days.c.o"
+  "CMakeFiles/dsdgen_c.dir/skip_days.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/sparse.c.o"
+  "CMakeFiles/dsdgen_c.dir/sparse.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/tdef_functions.c.o"
+  "CMakeFiles/dsdgen_c.dir/tdef_functions.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/tdefs.c.o"
+  "CMakeFiles/dsdgen_c.dir/tdefs.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/text.c.o"
+  "CMakeFiles/dsdgen_c.dir/text.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/w_call_center.c.o"
+  "CMakeFiles/dsdgen_c.dir/w_call_center.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/w_catalog_page.c.o"
+  "CMakeFiles/dsdgen_c.dir/w_catalog_page.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/w_catalog_returns.c.o"
+  "CMakeFiles/dsdgen_c.dir/w_catalog_returns.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/w_catalog_sales.c.o"
+  "CMakeFiles/dsdgen_c.dir/w_catalog_sales.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/w_customer.c.o"
+  "CMakeFiles/dsdgen_c.dir/w_customer.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/w_customer_address.c.o"
+  "CMakeFiles/dsdgen_c.dir/w_customer_address.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/w_customer_demographics.c.o"
+  "CMakeFiles/dsdgen_c.dir/w_customer_demographics.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/w_datetbl.c.o"
+  "CMakeFiles/dsdgen_c.dir/w_datetbl.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/w_household_demographics.c.o"
+  "CMakeFiles/dsdgen_c.dir/w_household_demographics.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/w_income_band.c.o"
+  "CMakeFiles/dsdgen_c.dir/w_income_band.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/w_inventory.c.o"
+  "CMakeFiles/dsdgen_c.dir/w_inventory.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/w_item.c.o"
+  "CMakeFiles/dsdgen_c.dir/w_item.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/w_promotion.c.o"
+  "CMakeFiles/dsdgen_c.dir/w_promotion.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/w_reason.c.o"
+  "CMakeFiles/dsdgen_c.dir/w_reason.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/w_ship_mode.c.o"
+  "CMakeFiles/dsdgen_c.dir/w_ship_mode.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/w_store.c.o"
+  "CMakeFiles/dsdgen_c.dir/w_store.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/w_store_returns.c.o"
+  "CMakeFiles/dsdgen_c.dir/w_store_returns.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/w_store_sales.c.o"
+  "CMakeFiles/dsdgen_c.dir/w_store_sales.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/w_timetbl.c.o"
+  "CMakeFiles/dsdgen_c.dir/w_timetbl.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/w_warehouse.c.o"
+  "CMakeFiles/dsdgen_c.dir/w_warehouse.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/w_web_page.c.o"
+  "CMakeFiles/dsdgen_c.dir/w_web_page.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/w_web_returns.c.o"
+  "CMakeFiles/dsdgen_c.dir/w_web_returns.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/w_web_sales.c.o"
+  "CMakeFiles/dsdgen_c.dir/w_web_sales.c.o.d"
+  "CMakeFiles/dsdgen_c.dir/w_web_site.c.o"
+  "CMakeFiles/dsdgen_c.dir/w_web_site.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dsdgen_c.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
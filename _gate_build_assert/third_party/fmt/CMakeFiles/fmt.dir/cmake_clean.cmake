@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fmt.dir/format.cc.o"
+  "CMakeFiles/fmt.dir/format.cc.o.d"
+  "libfmt.a"
+  "libfmt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fmt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
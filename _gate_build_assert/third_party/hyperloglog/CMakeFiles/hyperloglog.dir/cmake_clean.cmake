@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hyperloglog.dir/hyperloglog.cpp.o"
+  "CMakeFiles/hyperloglog.dir/hyperloglog.cpp.o.d"
+  "CMakeFiles/hyperloglog.dir/sds.cpp.o"
+  "CMakeFiles/hyperloglog.dir/sds.cpp.o.d"
+  "libhyperloglog.a"
+  "libhyperloglog.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hyperloglog.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
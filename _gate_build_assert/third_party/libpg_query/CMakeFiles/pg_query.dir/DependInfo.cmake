@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/third_party/libpg_query/pg_functions.cpp" "third_party/libpg_query/CMakeFiles/pg_query.dir/pg_functions.cpp.o" "gcc" "third_party/libpg_query/CMakeFiles/pg_query.dir/pg_functions.cpp.o.d"
+  "/root/repo/third_party/libpg_query/postgres_parser.cpp" "third_party/libpg_query/CMakeFiles/pg_query.dir/postgres_parser.cpp.o" "gcc" "third_party/libpg_query/CMakeFiles/pg_query.dir/postgres_parser.cpp.o.d"
+  "/root/repo/third_party/libpg_query/src_backend_nodes_list.cpp" "third_party/libpg_query/CMakeFiles/pg_query.dir/src_backend_nodes_list.cpp.o" "gcc" "third_party/libpg_query/CMakeFiles/pg_query.dir/src_backend_nodes_list.cpp.o.d"
+  "/root/repo/third_party/libpg_query/src_backend_nodes_makefuncs.cpp" "third_party/libpg_query/CMakeFiles/pg_query.dir/src_backend_nodes_makefuncs.cpp.o" "gcc" "third_party/libpg_query/CMakeFiles/pg_query.dir/src_backend_nodes_makefuncs.cpp.o.d"
+  "/root/repo/third_party/libpg_query/src_backend_nodes_value.cpp" "third_party/libpg_query/CMakeFiles/pg_query.dir/src_backend_nodes_value.cpp.o" "gcc" "third_party/libpg_query/CMakeFiles/pg_query.dir/src_backend_nodes_value.cpp.o.d"
+  "/root/repo/third_party/libpg_query/src_backend_parser_gram.cpp" "third_party/libpg_query/CMakeFiles/pg_query.dir/src_backend_parser_gram.cpp.o" "gcc" "third_party/libpg_query/CMakeFiles/pg_query.dir/src_backend_parser_gram.cpp.o.d"
+  "/root/repo/third_party/libpg_query/src_backend_parser_parser.cpp" "third_party/libpg_query/CMakeFiles/pg_query.dir/src_backend_parser_parser.cpp.o" "gcc" "third_party/libpg_query/CMakeFiles/pg_query.dir/src_backend_parser_parser.cpp.o.d"
+  "/root/repo/third_party/libpg_query/src_backend_parser_scan.cpp" "third_party/libpg_query/CMakeFiles/pg_query.dir/src_backend_parser_scan.cpp.o" "gcc" "third_party/libpg_query/CMakeFiles/pg_query.dir/src_backend_parser_scan.cpp.o.d"
+  "/root/repo/third_party/libpg_query/src_backend_parser_scansup.cpp" "third_party/libpg_query/CMakeFiles/pg_query.dir/src_backend_parser_scansup.cpp.o" "gcc" "third_party/libpg_query/CMakeFiles/pg_query.dir/src_backend_parser_scansup.cpp.o.d"
+  "/root/repo/third_party/libpg_query/src_common_keywords.cpp" "third_party/libpg_query/CMakeFiles/pg_query.dir/src_common_keywords.cpp.o" "gcc" "third_party/libpg_query/CMakeFiles/pg_query.dir/src_common_keywords.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/third_party/re2/re2/bitstate.cc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/bitstate.cc.o" "gcc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/bitstate.cc.o.d"
+  "/root/repo/third_party/re2/re2/compile.cc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/compile.cc.o" "gcc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/compile.cc.o.d"
+  "/root/repo/third_party/re2/re2/dfa.cc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/dfa.cc.o" "gcc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/dfa.cc.o.d"
+  "/root/repo/third_party/re2/re2/filtered_re2.cc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/filtered_re2.cc.o" "gcc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/filtered_re2.cc.o.d"
+  "/root/repo/third_party/re2/re2/mimics_pcre.cc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/mimics_pcre.cc.o" "gcc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/mimics_pcre.cc.o.d"
+  "/root/repo/third_party/re2/re2/nfa.cc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/nfa.cc.o" "gcc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/nfa.cc.o.d"
+  "/root/repo/third_party/re2/re2/onepass.cc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/onepass.cc.o" "gcc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/onepass.cc.o.d"
+  "/root/repo/third_party/re2/re2/parse.cc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/parse.cc.o" "gcc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/parse.cc.o.d"
+  "/root/repo/third_party/re2/re2/perl_groups.cc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/perl_groups.cc.o" "gcc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/perl_groups.cc.o.d"
+  "/root/repo/third_party/re2/re2/prefilter.cc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/prefilter.cc.o" "gcc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/prefilter.cc.o.d"
+  "/root/repo/third_party/re2/re2/prefilter_tree.cc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/prefilter_tree.cc.o" "gcc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/prefilter_tree.cc.o.d"
+  "/root/repo/third_party/re2/re2/prog.cc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/prog.cc.o" "gcc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/prog.cc.o.d"
+  "/root/repo/third_party/re2/re2/re2.cc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/re2.cc.o" "gcc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/re2.cc.o.d"
+  "/root/repo/third_party/re2/re2/regexp.cc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/regexp.cc.o" "gcc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/regexp.cc.o.d"
+  "/root/repo/third_party/re2/re2/set.cc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/set.cc.o" "gcc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/set.cc.o.d"
+  "/root/repo/third_party/re2/re2/simplify.cc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/simplify.cc.o" "gcc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/simplify.cc.o.d"
+  "/root/repo/third_party/re2/re2/stringpiece.cc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/stringpiece.cc.o" "gcc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/stringpiece.cc.o.d"
+  "/root/repo/third_party/re2/re2/tostring.cc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/tostring.cc.o" "gcc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/tostring.cc.o.d"
+  "/root/repo/third_party/re2/re2/unicode_casefold.cc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/unicode_casefold.cc.o" "gcc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/unicode_casefold.cc.o.d"
+  "/root/repo/third_party/re2/re2/unicode_groups.cc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/unicode_groups.cc.o" "gcc" "third_party/re2/CMakeFiles/duckdb_re2.dir/re2/unicode_groups.cc.o.d"
+  "/root/repo/third_party/re2/util/rune.cc" "third_party/re2/CMakeFiles/duckdb_re2.dir/util/rune.cc.o" "gcc" "third_party/re2/CMakeFiles/duckdb_re2.dir/util/rune.cc.o.d"
+  "/root/repo/third_party/re2/util/strutil.cc" "third_party/re2/CMakeFiles/duckdb_re2.dir/util/strutil.cc.o" "gcc" "third_party/re2/CMakeFiles/duckdb_re2.dir/util/strutil.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libduckdb_re2.a"
+)
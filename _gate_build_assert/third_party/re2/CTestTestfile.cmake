@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/third_party/re2
+# Build directory: /root/repo/_gate_build_assert/third_party/re2
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/third_party/utf8proc/utf8proc.cpp" "third_party/utf8proc/CMakeFiles/utf8proc.dir/utf8proc.cpp.o" "gcc" "third_party/utf8proc/CMakeFiles/utf8proc.dir/utf8proc.cpp.o.d"
+  "/root/repo/third_party/utf8proc/utf8proc_wrapper.cpp" "third_party/utf8proc/CMakeFiles/utf8proc.dir/utf8proc_wrapper.cpp.o" "gcc" "third_party/utf8proc/CMakeFiles/utf8proc.dir/utf8proc_wrapper.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_sqlite3_api_wrapper.dir/test_sqlite3_api_wrapper.cpp.o"
+  "CMakeFiles/test_sqlite3_api_wrapper.dir/test_sqlite3_api_wrapper.cpp.o.d"
+  "test_sqlite3_api_wrapper"
+  "test_sqlite3_api_wrapper.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_sqlite3_api_wrapper.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
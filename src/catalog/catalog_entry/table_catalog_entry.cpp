@@ -66,6 +66,7 @@ TableCatalogEntry::TableCatalogEntry(Catalog *catalog, SchemaCatalogEntry *schem
 		storage = make_shared<DataTable>(catalog->db, schema->name, name, GetTypes(), move(info->data));
 
 		// create the unique indexes for the UNIQUE and PRIMARY KEY constraints
+		idx_t unique_index = 0;
 		for (idx_t i = 0; i < bound_constraints.size(); i++) {
 			auto &constraint = bound_constraints[i];
 			if (constraint->type == ConstraintType::UNIQUE) {
@@ -87,7 +88,14 @@ TableCatalogEntry::TableCatalogEntry(Catalog *catalog, SchemaCatalogEntry *schem
 				}
 				// create an adaptive radix tree around the expressions
 				auto art = make_unique<ART>(column_ids, move(unbound_expressions), true);
-				storage->AddIndex(move(art), bound_expressions);
+				if (unique_index < info->indexes.size()) {
+					// the index has been written to disk: load it instead of rebuilding it from the table data
+					art->Deserialize(catalog->db, info->indexes[unique_index]);
+					storage->info->indexes.push_back(move(art));
+				} else {
+					storage->AddIndex(move(art), bound_expressions);
+				}
+				unique_index++;
 			}
 		}
 	}
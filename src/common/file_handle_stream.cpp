@@ -0,0 +1,184 @@
+#include "duckdb/common/file_handle_stream.hpp"
+
+#include <cstring>
+#include <utility>
+
+namespace duckdb {
+
+constexpr idx_t FileHandleStreamBuf::BUFFER_SIZE;
+
+FileHandleStreamBuf::FileHandleStreamBuf(FileSystem &fs, const string &path)
+    : fs(fs), handle(fs.OpenFile(path.c_str(), FileFlags::FILE_FLAGS_READ)), buffer_offset(0),
+      prefetch_offset(INVALID_INDEX), prefetch_size(0), prefetch_requested(false), prefetch_failed(false),
+      prefetch_shutdown(false) {
+	auto size = fs.GetFileSize(*handle);
+	if (size < 0) {
+		throw IOException("Could not determine the size of file \"%s\"", path);
+	}
+	file_size = size;
+	buffer = unique_ptr<char[]>(new char[BUFFER_SIZE]);
+	setg(buffer.get(), buffer.get(), buffer.get());
+}
+
+FileHandleStreamBuf::~FileHandleStreamBuf() {
+	if (!prefetch_thread) {
+		return;
+	}
+	// the prefetch thread uses the handle and the prefetch buffer: let it finish its read and stop
+	{
+		lock_guard<mutex> guard(prefetch_lock);
+		prefetch_shutdown = true;
+	}
+	prefetch_condition.notify_all();
+	prefetch_thread->join();
+}
+
+void FileHandleStreamBuf::PrefetchBlocks() {
+	std::unique_lock<mutex> guard(prefetch_lock);
+	while (true) {
+		prefetch_condition.wait(guard, [&] { return prefetch_requested || prefetch_shutdown; });
+		if (prefetch_shutdown) {
+			return;
+		}
+		auto offset = prefetch_offset;
+		auto read_size = prefetch_size;
+		guard.unlock();
+		bool failed = false;
+		try {
+			fs.Read(*handle, prefetch_buffer.get(), read_size, offset);
+		} catch (...) {
+			failed = true;
+		}
+		guard.lock();
+		prefetch_requested = false;
+		prefetch_failed = failed;
+		prefetch_condition.notify_all();
+	}
+}
+
+void FileHandleStreamBuf::StartPrefetch(idx_t offset) {
+	if (offset >= file_size) {
+		return;
+	}
+	if (!prefetch_buffer) {
+		prefetch_buffer = unique_ptr<char[]>(new char[BUFFER_SIZE]);
+	}
+	if (!prefetch_thread) {
+		prefetch_thread = make_unique<thread>(&FileHandleStreamBuf::PrefetchBlocks, this);
+	}
+	{
+		lock_guard<mutex> guard(prefetch_lock);
+		D_ASSERT(!prefetch_requested);
+		prefetch_offset = offset;
+		prefetch_size = MinValue<idx_t>(BUFFER_SIZE, file_size - offset);
+		prefetch_requested = true;
+	}
+	prefetch_condition.notify_all();
+}
+
+void FileHandleStreamBuf::FinishPrefetch() {
+	if (!prefetch_thread) {
+		return;
+	}
+	std::unique_lock<mutex> guard(prefetch_lock);
+	prefetch_condition.wait(guard, [&] { return !prefetch_requested; });
+	if (prefetch_failed) {
+		// the block is read again when it is needed, which reports the error if it persists
+		prefetch_offset = INVALID_INDEX;
+		prefetch_failed = false;
+	}
+}
+
+std::streambuf::int_type FileHandleStreamBuf::underflow() {
+	if (gptr() < egptr()) {
+		return traits_type::to_int_type(*gptr());
+	}
+	// the buffer has been consumed: read the next block of the file
+	buffer_offset = GetPosition();
+	idx_t read_size;
+	FinishPrefetch();
+	if (prefetch_offset == buffer_offset) {
+		// the block has been read in the background already
+		std::swap(buffer, prefetch_buffer);
+		read_size = prefetch_size;
+		prefetch_offset = INVALID_INDEX;
+	} else {
+		read_size = buffer_offset < file_size ? MinValue<idx_t>(BUFFER_SIZE, file_size - buffer_offset) : 0;
+		if (read_size > 0) {
+			fs.Read(*handle, buffer.get(), read_size, buffer_offset);
+		}
+	}
+	setg(buffer.get(), buffer.get(), buffer.get() + read_size);
+	// read the block after it while this one is consumed
+	StartPrefetch(buffer_offset + read_size);
+	return read_size == 0 ? traits_type::eof() : traits_type::to_int_type(*gptr());
+}
+
+std::streamsize FileHandleStreamBuf::xsgetn(char *s, std::streamsize n) {
+	if (n <= 0) {
+		return 0;
+	}
+	idx_t requested = n;
+	idx_t total_read = 0;
+	while (total_read < requested) {
+		if (gptr() == egptr()) {
+			idx_t position = GetPosition();
+			idx_t remaining = MinValue<idx_t>(requested - total_read, position < file_size ? file_size - position : 0);
+			if (remaining >= BUFFER_SIZE && prefetch_offset != position) {
+				// the remainder spans an entire block that is not read in the background: read it directly into the
+				// target, and start with an empty buffer after it. The handle is not used by more than one read at
+				// a time.
+				FinishPrefetch();
+				fs.Read(*handle, s + total_read, remaining, position);
+				buffer_offset = position + remaining;
+				setg(buffer.get(), buffer.get(), buffer.get());
+				return total_read + remaining;
+			}
+			// load the next block (swapping in the block that has been read in the background, if any)
+			if (underflow() == traits_type::eof()) {
+				break;
+			}
+		}
+		// copy whatever is buffered
+		idx_t buffered = MinValue<idx_t>(egptr() - gptr(), requested - total_read);
+		memcpy(s + total_read, gptr(), buffered);
+		gbump(buffered);
+		total_read += buffered;
+	}
+	return total_read;
+}
+
+std::streambuf::pos_type FileHandleStreamBuf::seekoff(std::streambuf::off_type off, std::ios_base::seekdir dir,
+                                                      std::ios_base::openmode which) {
+	int64_t base;
+	switch (dir) {
+	case std::ios_base::beg:
+		base = 0;
+		break;
+	case std::ios_base::cur:
+		base = GetPosition();
+		break;
+	default:
+		base = file_size;
+		break;
+	}
+	return seekpos(std::streambuf::pos_type(base + off), which);
+}
+
+std::streambuf::pos_type FileHandleStreamBuf::seekpos(std::streambuf::pos_type pos, std::ios_base::openmode which) {
+	int64_t target = pos;
+	if (!(which & std::ios_base::in) || target < 0 || (idx_t)target > file_size) {
+		return std::streambuf::pos_type(std::streambuf::off_type(-1));
+	}
+	idx_t buffered_size = egptr() - eback();
+	if ((idx_t)target >= buffer_offset && (idx_t)target <= buffer_offset + buffered_size) {
+		// the target is within the buffer: only move the read pointer
+		setg(eback(), eback() + (target - buffer_offset), egptr());
+	} else {
+		buffer_offset = target;
+		setg(buffer.get(), buffer.get(), buffer.get());
+	}
+	return pos;
+}
+
+} // namespace duckdb
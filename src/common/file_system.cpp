@@ -152,6 +152,50 @@ void FileSystem::SetFilePointer(FileHandle &handle, idx_t location) {
 	}
 }
 
+//! Reads from the location with pread if the handle was opened by the local file system, returns false otherwise
+static bool TryPositionalRead(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
+	auto unix_handle = dynamic_cast<UnixFileHandle *>(&handle);
+	if (!unix_handle) {
+		return false;
+	}
+	auto read_buffer = (char *)buffer;
+	while (nr_bytes > 0) {
+		int64_t bytes_read = pread(unix_handle->fd, read_buffer, nr_bytes, location);
+		if (bytes_read == -1) {
+			throw IOException("Could not read from file \"%s\": %s", handle.path, strerror(errno));
+		}
+		if (bytes_read == 0) {
+			throw IOException("Could not read sufficient bytes from file \"%s\"", handle.path);
+		}
+		read_buffer += bytes_read;
+		nr_bytes -= bytes_read;
+		location += bytes_read;
+	}
+	return true;
+}
+
+//! Writes to the location with pwrite if the handle was opened by the local file system, returns false otherwise
+static bool TryPositionalWrite(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
+	auto unix_handle = dynamic_cast<UnixFileHandle *>(&handle);
+	if (!unix_handle) {
+		return false;
+	}
+	auto write_buffer = (char *)buffer;
+	while (nr_bytes > 0) {
+		int64_t bytes_written = pwrite(unix_handle->fd, write_buffer, nr_bytes, location);
+		if (bytes_written == -1) {
+			throw IOException("Could not write file \"%s\": %s", handle.path, strerror(errno));
+		}
+		if (bytes_written == 0) {
+			throw IOException("Could not write sufficient bytes from file \"%s\"", handle.path);
+		}
+		write_buffer += bytes_written;
+		nr_bytes -= bytes_written;
+		location += bytes_written;
+	}
+	return true;
+}
+
 int64_t FileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	int fd = ((UnixFileHandle &)handle).fd;
 	int64_t bytes_read = read(fd, buffer, nr_bytes);
@@ -451,6 +495,51 @@ void FileSystem::SetFilePointer(FileHandle &handle, idx_t location) {
 	}
 }
 
+//! Reads from the location with an OVERLAPPED offset if the handle was opened by the local file system, returns
+//! false otherwise
+static bool TryPositionalRead(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
+	auto windows_handle = dynamic_cast<WindowsFileHandle *>(&handle);
+	if (!windows_handle) {
+		return false;
+	}
+	// passing the offset in an OVERLAPPED structure makes the read positional
+	OVERLAPPED ov = {};
+	ov.Offset = location & 0xFFFFFFFF;
+	ov.OffsetHigh = location >> 32;
+	DWORD bytes_read;
+	auto rc = ReadFile(windows_handle->fd, buffer, (DWORD)nr_bytes, &bytes_read, &ov);
+	if (rc == 0) {
+		auto error = GetLastErrorAsString();
+		throw IOException("Could not read file \"%s\": %s", handle.path, error);
+	}
+	if (bytes_read != nr_bytes) {
+		throw IOException("Could not read sufficient bytes from file \"%s\"", handle.path);
+	}
+	return true;
+}
+
+//! Writes to the location with an OVERLAPPED offset if the handle was opened by the local file system, returns
+//! false otherwise
+static bool TryPositionalWrite(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
+	auto windows_handle = dynamic_cast<WindowsFileHandle *>(&handle);
+	if (!windows_handle) {
+		return false;
+	}
+	OVERLAPPED ov = {};
+	ov.Offset = location & 0xFFFFFFFF;
+	ov.OffsetHigh = location >> 32;
+	DWORD bytes_written;
+	auto rc = WriteFile(windows_handle->fd, buffer, (DWORD)nr_bytes, &bytes_written, &ov);
+	if (rc == 0) {
+		auto error = GetLastErrorAsString();
+		throw IOException("Could not write file \"%s\": %s", handle.path, error);
+	}
+	if (bytes_written != nr_bytes) {
+		throw IOException("Could not write sufficient bytes from file \"%s\"", handle.path);
+	}
+	return true;
+}
+
 int64_t FileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	HANDLE hFile = ((WindowsFileHandle &)handle).fd;
 	DWORD bytes_read;
@@ -672,6 +761,11 @@ string FileSystem::GetHomeDirectory() {
 }
 
 void FileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
+	if (TryPositionalRead(handle, buffer, nr_bytes, location)) {
+		return;
+	}
+	// the handle only supports reading at the file pointer, which is shared by all users of the handle
+	lock_guard<mutex> file_pointer_guard(file_pointer_lock);
 	// seek to the location
 	SetFilePointer(handle, location);
 	// now read from the location
@@ -682,6 +776,11 @@ void FileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t
 }
 
 void FileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
+	if (TryPositionalWrite(handle, buffer, nr_bytes, location)) {
+		return;
+	}
+	// the handle only supports writing at the file pointer, which is shared by all users of the handle
+	lock_guard<mutex> file_pointer_guard(file_pointer_lock);
 	// seek to the location
 	SetFilePointer(handle, location);
 	// now write to the location
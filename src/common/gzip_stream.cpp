@@ -2,12 +2,13 @@
 
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/file_system.hpp"
-#include "duckdb/common/fstream_util.hpp"
 
 #include "miniz.hpp"
 
 #include "duckdb/common/limits.hpp"
 
+#include <cstring>
+
 namespace duckdb {
 
 /*
@@ -53,14 +54,6 @@ namespace duckdb {
 
  */
 
-static idx_t GZipConsumeString(fstream &input) {
-	idx_t size = 1; // terminator
-	while (input.get() != '\0') {
-		size++;
-	}
-	return size;
-}
-
 static constexpr const uint8_t GZIP_COMPRESSION_DEFLATE = 0x08;
 
 static constexpr const uint8_t GZIP_FLAG_ASCII = 0x1;
@@ -75,13 +68,23 @@ static constexpr const uint8_t GZIP_HEADER_MINSIZE = 10;
 static constexpr const unsigned char GZIP_FLAG_UNSUPPORTED =
     GZIP_FLAG_ASCII | GZIP_FLAG_MULTIPART | GZIP_FLAG_EXTRA | GZIP_FLAG_COMMENT | GZIP_FLAG_ENCRYPT;
 
+idx_t GzipStreamBuf::ReadInput() {
+	// the file is read in blocks at an explicit offset, as not every file system supports reading at the file pointer
+	idx_t read_size = MinValue<idx_t>(BUFFER_SIZE, file_size - read_position);
+	if (read_size > 0) {
+		fs.Read(*input, in_buff, read_size, read_position);
+		read_position += read_size;
+	}
+	in_buff_start = in_buff;
+	in_buff_end = in_buff + read_size;
+	return read_size;
+}
+
 void GzipStreamBuf::Initialize() {
 	if (is_initialized) {
 		return;
 	}
-	D_ASSERT(BUFFER_SIZE >= 3); // found to work fine with 3
-	uint8_t gzip_hdr[10];
-	data_start = GZIP_HEADER_MINSIZE;
+	D_ASSERT(BUFFER_SIZE >= GZIP_HEADER_MINSIZE);
 
 	in_buff = new data_t[BUFFER_SIZE];
 	in_buff_start = in_buff;
@@ -91,12 +94,19 @@ void GzipStreamBuf::Initialize() {
 	mz_stream_ptr = new duckdb_miniz::mz_stream();
 	// TODO use custom alloc/free methods in miniz to throw exceptions on OOM
 
-	FstreamUtil::OpenFile(filename, input, ios::in | ios::binary);
+	input = fs.OpenFile(filename.c_str(), FileFlags::FILE_FLAGS_READ);
+	auto size = fs.GetFileSize(*input);
+	if (size < 0) {
+		throw IOException("Could not get the size of file \"%s\"", filename);
+	}
+	file_size = size;
+	read_position = 0;
 
-	input.read((char *)gzip_hdr, GZIP_HEADER_MINSIZE);
-	if (!input) {
+	// the header is parsed from the first block of the file
+	if (ReadInput() < GZIP_HEADER_MINSIZE) {
 		throw Exception("Input is not a GZIP stream");
 	}
+	auto gzip_hdr = in_buff;
 	if (gzip_hdr[0] != 0x1F || gzip_hdr[1] != 0x8B) { // magic header
 		throw Exception("Input is not a GZIP stream");
 	}
@@ -106,13 +116,23 @@ void GzipStreamBuf::Initialize() {
 	if (gzip_hdr[3] & GZIP_FLAG_UNSUPPORTED) {
 		throw Exception("Unsupported GZIP archive");
 	}
+	in_buff_start += GZIP_HEADER_MINSIZE;
 
 	if (gzip_hdr[3] & GZIP_FLAG_NAME) {
-		input.seekg(data_start, input.beg);
-		data_start += GZipConsumeString(input);
+		// skip the zero-terminated file name, which can continue in the next block
+		while (true) {
+			auto terminator = (data_ptr_t)memchr(in_buff_start, '\0', in_buff_end - in_buff_start);
+			if (terminator) {
+				in_buff_start = terminator + 1;
+				break;
+			}
+			if (ReadInput() == 0) {
+				throw Exception("Input is not a GZIP stream");
+			}
+		}
 	}
-	input.seekg(data_start, input.beg);
-	// stream is now set to beginning of payload data
+	// the input buffer now starts at the payload data
+	data_start = read_position - (in_buff_end - in_buff_start);
 
 	auto ret = duckdb_miniz::mz_inflateInit2((duckdb_miniz::mz_streamp)mz_stream_ptr, -MZ_DEFAULT_WINDOW_BITS);
 	if (ret != duckdb_miniz::MZ_OK) {
@@ -144,12 +164,9 @@ std::streambuf::int_type GzipStreamBuf::underflow() {
 			// read more input if none available
 			if (in_buff_start == in_buff_end) {
 				// empty input buffer: refill from the start
-				in_buff_start = in_buff;
-				std::streamsize sz = input.rdbuf()->sgetn((char *)in_buff, BUFFER_SIZE);
-				if (sz == 0) {
+				if (ReadInput() == 0) {
 					break; // end of input
 				}
-				in_buff_end = in_buff + sz;
 			}
 
 			// actually decompress
@@ -5,6 +5,7 @@
 #include "duckdb/common/value_operations/value_operations.hpp"
 #include "duckdb/common/operator/comparison_operators.hpp"
 #include "duckdb/common/assert.hpp"
+#include "duckdb/common/types/sort_keys.hpp"
 
 #include <algorithm>
 #include <cstring>
@@ -191,29 +192,19 @@ static int32_t CompareValue(Vector &left_vec, Vector &right_vec, idx_t vector_id
 	return false;
 }
 
-static int CompareTuple(ChunkCollection *sort_by, vector<OrderType> &desc, vector<OrderByNullType> &null_order,
-                        idx_t left, idx_t right) {
-	D_ASSERT(sort_by);
-
-	idx_t chunk_idx_left = left / STANDARD_VECTOR_SIZE;
-	idx_t chunk_idx_right = right / STANDARD_VECTOR_SIZE;
-	idx_t vector_idx_left = left % STANDARD_VECTOR_SIZE;
-	idx_t vector_idx_right = right % STANDARD_VECTOR_SIZE;
-
-	auto &left_chunk = sort_by->GetChunk(chunk_idx_left);
-	auto &right_chunk = sort_by->GetChunk(chunk_idx_right);
-
+int ChunkCollection::CompareRows(DataChunk &left, idx_t left_idx, DataChunk &right, idx_t right_idx,
+                                 vector<OrderType> &desc, vector<OrderByNullType> &null_order) {
 	for (idx_t col_idx = 0; col_idx < desc.size(); col_idx++) {
 		auto order_type = desc[col_idx];
 
-		auto &left_vec = left_chunk.data[col_idx];
-		auto &right_vec = right_chunk.data[col_idx];
+		auto &left_vec = left.data[col_idx];
+		auto &right_vec = right.data[col_idx];
 
 		D_ASSERT(left_vec.vector_type == VectorType::FLAT_VECTOR);
 		D_ASSERT(right_vec.vector_type == VectorType::FLAT_VECTOR);
 		D_ASSERT(left_vec.type == right_vec.type);
 
-		auto comp_res = CompareValue(left_vec, right_vec, vector_idx_left, vector_idx_right, null_order[col_idx]);
+		auto comp_res = CompareValue(left_vec, right_vec, left_idx, right_idx, null_order[col_idx]);
 
 		if (comp_res == 0) {
 			continue;
@@ -224,6 +215,21 @@ static int CompareTuple(ChunkCollection *sort_by, vector<OrderType> &desc, vecto
 	return 0;
 }
 
+static int CompareTuple(ChunkCollection *sort_by, vector<OrderType> &desc, vector<OrderByNullType> &null_order,
+                        idx_t left, idx_t right) {
+	D_ASSERT(sort_by);
+
+	idx_t chunk_idx_left = left / STANDARD_VECTOR_SIZE;
+	idx_t chunk_idx_right = right / STANDARD_VECTOR_SIZE;
+	idx_t vector_idx_left = left % STANDARD_VECTOR_SIZE;
+	idx_t vector_idx_right = right % STANDARD_VECTOR_SIZE;
+
+	auto &left_chunk = sort_by->GetChunk(chunk_idx_left);
+	auto &right_chunk = sort_by->GetChunk(chunk_idx_right);
+
+	return ChunkCollection::CompareRows(left_chunk, vector_idx_left, right_chunk, vector_idx_right, desc, null_order);
+}
+
 static int64_t QuicksortInitial(ChunkCollection *sort_by, vector<OrderType> &desc, vector<OrderByNullType> &null_order,
                                 idx_t *result) {
 	// select pivot
@@ -324,6 +330,16 @@ void ChunkCollection::Sort(vector<OrderType> &desc, vector<OrderByNullType> &nul
 	if (count == 0) {
 		return;
 	}
+	vector<LogicalType> key_types(types.begin(), types.begin() + desc.size());
+	if (SortKeys::CanEncode(key_types)) {
+		// radix sort on the normalized sort keys
+		SortKeys sort_keys(key_types, desc, null_order);
+		for (auto &chunk : chunks) {
+			sort_keys.Append(*chunk);
+		}
+		sort_keys.Sort(result);
+		return;
+	}
 	// start off with an initial quicksort
 	int64_t part = QuicksortInitial(this, desc, null_order, result);
 
@@ -510,8 +526,23 @@ bool ChunkCollection::Equals(ChunkCollection &other) {
 	}
 	return true;
 }
-static void Heapify(ChunkCollection *input, vector<OrderType> &desc, vector<OrderByNullType> &null_order, idx_t *heap,
-                    idx_t heap_size, idx_t current_index) {
+//! Compares the rows of a ChunkCollection directly
+struct CollectionTupleComparer {
+	CollectionTupleComparer(ChunkCollection *input, vector<OrderType> &desc, vector<OrderByNullType> &null_order)
+	    : input(input), desc(desc), null_order(null_order) {
+	}
+
+	int Compare(idx_t left, idx_t right) {
+		return CompareTuple(input, desc, null_order, left, right);
+	}
+
+	ChunkCollection *input;
+	vector<OrderType> &desc;
+	vector<OrderByNullType> &null_order;
+};
+
+template <class COMPARER>
+static void Heapify(COMPARER &comparer, idx_t *heap, idx_t heap_size, idx_t current_index) {
 	if (current_index >= heap_size) {
 		return;
 	}
@@ -520,43 +551,52 @@ static void Heapify(ChunkCollection *input, vector<OrderType> &desc, vector<Orde
 	idx_t swap_index = current_index;
 
 	if (left_child_index < heap_size) {
-		swap_index = CompareTuple(input, desc, null_order, heap[swap_index], heap[left_child_index]) <= 0
-		                 ? left_child_index
-		                 : swap_index;
+		swap_index =
+		    comparer.Compare(heap[swap_index], heap[left_child_index]) <= 0 ? left_child_index : swap_index;
 	}
 
 	if (right_child_index < heap_size) {
-		swap_index = CompareTuple(input, desc, null_order, heap[swap_index], heap[right_child_index]) <= 0
-		                 ? right_child_index
-		                 : swap_index;
+		swap_index =
+		    comparer.Compare(heap[swap_index], heap[right_child_index]) <= 0 ? right_child_index : swap_index;
 	}
 
 	if (swap_index != current_index) {
 		std::swap(heap[current_index], heap[swap_index]);
-		Heapify(input, desc, null_order, heap, heap_size, swap_index);
+		Heapify(comparer, heap, heap_size, swap_index);
 	}
 }
 
-static void HeapCreate(ChunkCollection *input, vector<OrderType> &desc, vector<OrderByNullType> &null_order,
-                       idx_t *heap, idx_t heap_size) {
+template <class COMPARER>
+static void HeapCreate(COMPARER &comparer, idx_t input_count, idx_t *heap, idx_t heap_size) {
 	for (idx_t i = 0; i < heap_size; i++) {
 		heap[i] = i;
 	}
 
 	// build heap
 	for (int64_t i = heap_size / 2 - 1; i >= 0; i--) {
-		Heapify(input, desc, null_order, heap, heap_size, i);
+		Heapify(comparer, heap, heap_size, i);
 	}
 
 	// Run through all the rows.
-	for (idx_t i = heap_size; i < input->Count(); i++) {
-		if (CompareTuple(input, desc, null_order, i, heap[0]) <= 0) {
+	for (idx_t i = heap_size; i < input_count; i++) {
+		if (comparer.Compare(i, heap[0]) <= 0) {
 			heap[0] = i;
-			Heapify(input, desc, null_order, heap, heap_size, 0);
+			Heapify(comparer, heap, heap_size, 0);
 		}
 	}
 }
 
+template <class COMPARER>
+static void HeapSort(COMPARER &comparer, idx_t input_count, idx_t *heap, idx_t heap_size) {
+	HeapCreate(comparer, input_count, heap, heap_size);
+
+	// Heap is ready. Now do a heapsort
+	for (int64_t i = heap_size - 1; i >= 0; i--) {
+		std::swap(heap[i], heap[0]);
+		Heapify(comparer, heap, i, 0);
+	}
+}
+
 void ChunkCollection::Heap(vector<OrderType> &desc, vector<OrderByNullType> &null_order, idx_t heap[],
                            idx_t heap_size) {
 	D_ASSERT(heap);
@@ -564,12 +604,17 @@ void ChunkCollection::Heap(vector<OrderType> &desc, vector<OrderByNullType> &nul
 		return;
 	}
 
-	HeapCreate(this, desc, null_order, heap, heap_size);
-
-	// Heap is ready. Now do a heapsort
-	for (int64_t i = heap_size - 1; i >= 0; i--) {
-		std::swap(heap[i], heap[0]);
-		Heapify(this, desc, null_order, heap, i, 0);
+	vector<LogicalType> key_types(types.begin(), types.begin() + desc.size());
+	if (SortKeys::CanEncode(key_types)) {
+		// compare the normalized sort keys instead of the rows
+		SortKeys sort_keys(key_types, desc, null_order);
+		for (auto &chunk : chunks) {
+			sort_keys.Append(*chunk);
+		}
+		HeapSort(sort_keys, count, heap, heap_size);
+	} else {
+		CollectionTupleComparer comparer(this, desc, null_order);
+		HeapSort(comparer, count, heap, heap_size);
 	}
 }
 
@@ -1,6 +1,7 @@
 #include "duckdb/common/types/hyperloglog.hpp"
 
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/serializer.hpp"
 #include "hyperloglog.hpp"
 
 namespace duckdb {
@@ -22,6 +23,12 @@ void HyperLogLog::Add(data_ptr_t element, idx_t size) {
 	}
 }
 
+void HyperLogLog::AddHashes(hash_t hashes[], idx_t count) {
+	if (hll_to_dense((robj *)hll) != C_OK || hll_add_hashes((robj *)hll, hashes, count) != C_OK) {
+		throw Exception("Could not add hashes to HLL");
+	}
+}
+
 idx_t HyperLogLog::Count() {
 	size_t result; // exception from size_t ban
 	if (hll_count((robj *)hll, &result) != C_OK) {
@@ -67,4 +74,27 @@ unique_ptr<HyperLogLog> HyperLogLog::Merge(HyperLogLog logs[], idx_t count) {
 	return unique_ptr<HyperLogLog>(new HyperLogLog((void *)new_hll));
 }
 
-} // namespace duckdb
\ No newline at end of file
+unique_ptr<HyperLogLog> HyperLogLog::Copy() {
+	auto new_hll = hll_deserialize(hll_serialized_data((robj *)hll), hll_serialized_size((robj *)hll));
+	if (!new_hll) {
+		throw Exception("Could not copy HLL");
+	}
+	return unique_ptr<HyperLogLog>(new HyperLogLog((void *)new_hll));
+}
+
+void HyperLogLog::Serialize(Serializer &serializer) {
+	serializer.WriteStringLen(hll_serialized_data((robj *)hll), hll_serialized_size((robj *)hll));
+}
+
+unique_ptr<HyperLogLog> HyperLogLog::Deserialize(Deserializer &source) {
+	auto size = source.Read<uint32_t>();
+	auto data = unique_ptr<data_t[]>(new data_t[size]);
+	source.ReadData(data.get(), size);
+	auto new_hll = hll_deserialize(data.get(), size);
+	if (!new_hll) {
+		throw SerializationException("Could not deserialize HLL: invalid representation");
+	}
+	return unique_ptr<HyperLogLog>(new HyperLogLog((void *)new_hll));
+}
+
+} // namespace duckdb
@@ -0,0 +1,377 @@
+#include "duckdb/common/types/sort_keys.hpp"
+
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/types/hugeint.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace duckdb {
+
+//! Buckets of at most this many rows are sorted with a comparison sort instead of radix sort
+static constexpr idx_t RADIX_SORT_THRESHOLD = 24;
+
+static idx_t SortKeyWidth(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return GetTypeIdSize(type);
+	case PhysicalType::VARCHAR:
+		return SortKeys::STRING_PREFIX_LENGTH;
+	default:
+		throw NotImplementedException("Type for sort key");
+	}
+}
+
+bool SortKeys::CanEncode(const vector<LogicalType> &types) {
+	for (auto &type : types) {
+		switch (type.InternalType()) {
+		case PhysicalType::BOOL:
+		case PhysicalType::INT8:
+		case PhysicalType::INT16:
+		case PhysicalType::INT32:
+		case PhysicalType::INT64:
+		case PhysicalType::UINT8:
+		case PhysicalType::UINT16:
+		case PhysicalType::UINT32:
+		case PhysicalType::UINT64:
+		case PhysicalType::INT128:
+		case PhysicalType::FLOAT:
+		case PhysicalType::DOUBLE:
+		case PhysicalType::VARCHAR:
+			break;
+		default:
+			return false;
+		}
+	}
+	return true;
+}
+
+SortKeys::SortKeys(const vector<LogicalType> &types_p, const vector<OrderType> &order_types,
+                   const vector<OrderByNullType> &null_order_types)
+    : order_types(order_types), null_order_types(null_order_types), key_width(0), count(0) {
+	D_ASSERT(types_p.size() == order_types.size() && types_p.size() == null_order_types.size());
+	for (auto &type : types_p) {
+		types.push_back(type.InternalType());
+		offsets.push_back(key_width);
+		// every column is prefixed by a byte that encodes whether or not the value is NULL
+		key_width += 1 + SortKeyWidth(type.InternalType());
+	}
+	strings.resize(types.size());
+	prefix_ties.resize(types.size(), false);
+}
+
+//===--------------------------------------------------------------------===//
+// Encoding
+//===--------------------------------------------------------------------===//
+// all values are stored in big-endian, so that the most significant byte is compared first
+template <class T>
+static inline void StoreBigEndian(T value, data_ptr_t target) {
+	for (idx_t i = 0; i < sizeof(T); i++) {
+		target[i] = (value >> ((sizeof(T) - 1 - i) * 8)) & 0xFF;
+	}
+}
+
+template <class T>
+static inline void EncodeValue(T value, data_ptr_t target);
+
+template <>
+inline void EncodeValue(bool value, data_ptr_t target) {
+	target[0] = value ? 1 : 0;
+}
+
+// signed integers: flip the sign bit so that negative numbers sort before positive numbers
+template <>
+inline void EncodeValue(int8_t value, data_ptr_t target) {
+	target[0] = (uint8_t)value ^ 0x80;
+}
+
+template <>
+inline void EncodeValue(int16_t value, data_ptr_t target) {
+	StoreBigEndian<uint16_t>((uint16_t)value ^ 0x8000, target);
+}
+
+template <>
+inline void EncodeValue(int32_t value, data_ptr_t target) {
+	StoreBigEndian<uint32_t>((uint32_t)value ^ 0x80000000u, target);
+}
+
+template <>
+inline void EncodeValue(int64_t value, data_ptr_t target) {
+	StoreBigEndian<uint64_t>((uint64_t)value ^ 0x8000000000000000ull, target);
+}
+
+template <>
+inline void EncodeValue(uint8_t value, data_ptr_t target) {
+	target[0] = value;
+}
+
+template <>
+inline void EncodeValue(uint16_t value, data_ptr_t target) {
+	StoreBigEndian<uint16_t>(value, target);
+}
+
+template <>
+inline void EncodeValue(uint32_t value, data_ptr_t target) {
+	StoreBigEndian<uint32_t>(value, target);
+}
+
+template <>
+inline void EncodeValue(uint64_t value, data_ptr_t target) {
+	StoreBigEndian<uint64_t>(value, target);
+}
+
+template <>
+inline void EncodeValue(hugeint_t value, data_ptr_t target) {
+	EncodeValue<int64_t>(value.upper, target);
+	EncodeValue<uint64_t>(value.lower, target + sizeof(int64_t));
+}
+
+// floating point numbers: flip the sign bit of positive numbers and all bits of negative numbers
+template <>
+inline void EncodeValue(float value, data_ptr_t target) {
+	uint32_t bits;
+	if (value == 0) {
+		// -0 and +0 are equal
+		bits = 0;
+	} else {
+		memcpy(&bits, &value, sizeof(bits));
+	}
+	bits = (bits & (1u << 31)) ? ~bits : bits | (1u << 31);
+	StoreBigEndian<uint32_t>(bits, target);
+}
+
+template <>
+inline void EncodeValue(double value, data_ptr_t target) {
+	uint64_t bits;
+	if (value == 0) {
+		bits = 0;
+	} else {
+		memcpy(&bits, &value, sizeof(bits));
+	}
+	bits = (bits & (1ull << 63)) ? ~bits : bits | (1ull << 63);
+	StoreBigEndian<uint64_t>(bits, target);
+}
+
+template <class T>
+static void TemplatedEncodeColumn(VectorData &vdata, idx_t count, data_ptr_t target, idx_t key_width,
+                                  data_t valid_byte) {
+	auto data = (T *)vdata.data;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		auto key = target + i * key_width;
+		if ((*vdata.nullmask)[idx]) {
+			key[0] = valid_byte ^ 1;
+			memset(key + 1, 0, sizeof(T));
+		} else {
+			key[0] = valid_byte;
+			EncodeValue<T>(data[idx], key + 1);
+		}
+	}
+}
+
+void SortKeys::EncodeColumn(idx_t col_idx, Vector &vector, idx_t chunk_count) {
+	VectorData vdata;
+	vector.Orrify(chunk_count, vdata);
+
+	auto target = GetKey(count) + offsets[col_idx];
+	// the NULL byte decides the position of NULL values relative to all other values
+	data_t valid_byte = null_order_types[col_idx] == OrderByNullType::NULLS_FIRST ? 1 : 0;
+	switch (types[col_idx]) {
+	case PhysicalType::BOOL:
+		TemplatedEncodeColumn<bool>(vdata, chunk_count, target, key_width, valid_byte);
+		break;
+	case PhysicalType::INT8:
+		TemplatedEncodeColumn<int8_t>(vdata, chunk_count, target, key_width, valid_byte);
+		break;
+	case PhysicalType::INT16:
+		TemplatedEncodeColumn<int16_t>(vdata, chunk_count, target, key_width, valid_byte);
+		break;
+	case PhysicalType::INT32:
+		TemplatedEncodeColumn<int32_t>(vdata, chunk_count, target, key_width, valid_byte);
+		break;
+	case PhysicalType::INT64:
+		TemplatedEncodeColumn<int64_t>(vdata, chunk_count, target, key_width, valid_byte);
+		break;
+	case PhysicalType::UINT8:
+		TemplatedEncodeColumn<uint8_t>(vdata, chunk_count, target, key_width, valid_byte);
+		break;
+	case PhysicalType::UINT16:
+		TemplatedEncodeColumn<uint16_t>(vdata, chunk_count, target, key_width, valid_byte);
+		break;
+	case PhysicalType::UINT32:
+		TemplatedEncodeColumn<uint32_t>(vdata, chunk_count, target, key_width, valid_byte);
+		break;
+	case PhysicalType::UINT64:
+		TemplatedEncodeColumn<uint64_t>(vdata, chunk_count, target, key_width, valid_byte);
+		break;
+	case PhysicalType::INT128:
+		TemplatedEncodeColumn<hugeint_t>(vdata, chunk_count, target, key_width, valid_byte);
+		break;
+	case PhysicalType::FLOAT:
+		TemplatedEncodeColumn<float>(vdata, chunk_count, target, key_width, valid_byte);
+		break;
+	case PhysicalType::DOUBLE:
+		TemplatedEncodeColumn<double>(vdata, chunk_count, target, key_width, valid_byte);
+		break;
+	case PhysicalType::VARCHAR: {
+		auto data = (string_t *)vdata.data;
+		auto &column_strings = strings[col_idx];
+		for (idx_t i = 0; i < chunk_count; i++) {
+			auto idx = vdata.sel->get_index(i);
+			auto key = target + i * key_width;
+			memset(key + 1, 0, STRING_PREFIX_LENGTH);
+			if ((*vdata.nullmask)[idx]) {
+				key[0] = valid_byte ^ 1;
+				column_strings.push_back(string_t(nullptr, 0));
+				continue;
+			}
+			key[0] = valid_byte;
+			auto str = data[idx];
+			auto str_data = str.GetDataUnsafe();
+			auto prefix_length = MinValue<idx_t>(str.GetSize(), STRING_PREFIX_LENGTH);
+			memcpy(key + 1, str_data, prefix_length);
+			// the prefix does not decide the order if the string is truncated, or if it contains zero bytes that
+			// cannot be told apart from the padding
+			if (str.GetSize() > STRING_PREFIX_LENGTH || memchr(str_data, '\0', prefix_length)) {
+				prefix_ties[col_idx] = true;
+			}
+			column_strings.push_back(str);
+		}
+		break;
+	}
+	default:
+		throw NotImplementedException("Type for sort key");
+	}
+	if (order_types[col_idx] == OrderType::DESCENDING) {
+		// descending order: invert all bytes of the column (including the NULL byte)
+		auto width = 1 + SortKeyWidth(types[col_idx]);
+		for (idx_t i = 0; i < chunk_count; i++) {
+			auto key = target + i * key_width;
+			for (idx_t byte_idx = 0; byte_idx < width; byte_idx++) {
+				key[byte_idx] = ~key[byte_idx];
+			}
+		}
+	}
+}
+
+void SortKeys::Append(DataChunk &chunk) {
+	D_ASSERT(chunk.ColumnCount() >= types.size());
+	if (chunk.size() == 0) {
+		return;
+	}
+	keys.resize((count + chunk.size()) * key_width);
+	for (idx_t col_idx = 0; col_idx < types.size(); col_idx++) {
+		D_ASSERT(chunk.data[col_idx].type.InternalType() == types[col_idx]);
+		EncodeColumn(col_idx, chunk.data[col_idx], chunk.size());
+	}
+	count += chunk.size();
+}
+
+//===--------------------------------------------------------------------===//
+// Comparison
+//===--------------------------------------------------------------------===//
+int SortKeys::Compare(idx_t left, idx_t right) {
+	auto left_key = GetKey(left);
+	auto right_key = GetKey(right);
+	idx_t start = 0;
+	for (idx_t col_idx = 0; col_idx < types.size(); col_idx++) {
+		if (!prefix_ties[col_idx]) {
+			continue;
+		}
+		// compare the keys up to and including the prefix of this column
+		idx_t end = offsets[col_idx] + 1 + STRING_PREFIX_LENGTH;
+		auto cmp = memcmp(left_key + start, right_key + start, end - start);
+		if (cmp != 0) {
+			return cmp;
+		}
+		// the prefixes are equal: compare the full strings
+		auto &left_str = strings[col_idx][left];
+		auto &right_str = strings[col_idx][right];
+		if (!Equals::Operation<string_t>(left_str, right_str)) {
+			bool less_than = LessThan::Operation<string_t>(left_str, right_str);
+			return less_than == (order_types[col_idx] == OrderType::ASCENDING) ? -1 : 1;
+		}
+		start = end;
+	}
+	return memcmp(left_key + start, right_key + start, key_width - start);
+}
+
+//===--------------------------------------------------------------------===//
+// Sort
+//===--------------------------------------------------------------------===//
+void SortKeys::RadixSort(idx_t *indices, idx_t *temp, idx_t sort_count, idx_t offset, idx_t radix_end,
+                         bool compare_ties) {
+	if (sort_count <= 1) {
+		return;
+	}
+	if (offset >= radix_end || sort_count <= RADIX_SORT_THRESHOLD) {
+		if (offset >= radix_end && !compare_ties) {
+			// all keys in this range are equal
+			return;
+		}
+		std::sort(indices, indices + sort_count, [&](idx_t l, idx_t r) { return Compare(l, r) < 0; });
+		return;
+	}
+	// count the occurrences of every byte value at the current offset
+	idx_t counts[256];
+	memset(counts, 0, sizeof(counts));
+	for (idx_t i = 0; i < sort_count; i++) {
+		counts[GetKey(indices[i])[offset]]++;
+	}
+	if (counts[GetKey(indices[0])[offset]] == sort_count) {
+		// all keys share this byte: move on to the next byte
+		RadixSort(indices, temp, sort_count, offset + 1, radix_end, compare_ties);
+		return;
+	}
+	idx_t positions[256];
+	idx_t position = 0;
+	for (idx_t byte = 0; byte < 256; byte++) {
+		positions[byte] = position;
+		position += counts[byte];
+	}
+	// scatter the indices into their buckets
+	for (idx_t i = 0; i < sort_count; i++) {
+		temp[positions[GetKey(indices[i])[offset]]++] = indices[i];
+	}
+	memcpy(indices, temp, sort_count * sizeof(idx_t));
+	// now sort every bucket on the next byte
+	idx_t bucket_start = 0;
+	for (idx_t byte = 0; byte < 256; byte++) {
+		RadixSort(indices + bucket_start, temp + bucket_start, counts[byte], offset + 1, radix_end, compare_ties);
+		bucket_start += counts[byte];
+	}
+}
+
+void SortKeys::Sort(idx_t result[]) {
+	D_ASSERT(result);
+	for (idx_t i = 0; i < count; i++) {
+		result[i] = i;
+	}
+	// the radix sort can only proceed up to the end of the first string prefix that can have ties, after that the
+	// remaining rows are ordered by comparing the full strings
+	idx_t radix_end = key_width;
+	bool compare_ties = false;
+	for (idx_t col_idx = 0; col_idx < types.size(); col_idx++) {
+		if (prefix_ties[col_idx]) {
+			radix_end = offsets[col_idx] + 1 + STRING_PREFIX_LENGTH;
+			compare_ties = true;
+			break;
+		}
+	}
+	auto temp = unique_ptr<idx_t[]>(new idx_t[count]);
+	RadixSort(result, temp.get(), count, 0, radix_end, compare_ties);
+}
+
+} // namespace duckdb
@@ -62,7 +62,8 @@ void StringHeap::MergeHeap(StringHeap &other) {
 	other.tail->prev = move(chunk);
 	this->chunk = move(other.chunk);
 	if (!tail) {
-		tail = this->chunk.get();
+		// this heap was empty: the oldest chunk is now the oldest chunk of the other heap
+		tail = other.tail;
 	}
 	other.tail = nullptr;
 }
@@ -111,7 +111,10 @@ void GroupedAggregateHashTable::PayloadApply(FUNC fun) {
 }
 
 void GroupedAggregateHashTable::NewBlock() {
-	auto pin = buffer_manager.Allocate(Storage::BLOCK_ALLOC_SIZE);
+	// payload blocks are not destroyed when unpinned, so finalized HTs can be offloaded to disk
+	auto block = buffer_manager.RegisterMemory(Storage::BLOCK_ALLOC_SIZE, false);
+	auto pin = buffer_manager.Pin(block);
+	payload_blocks.push_back(move(block));
 	payload_hds.push_back(move(pin));
 	payload_hds_ptrs.push_back(payload_hds.back()->Ptr());
 	payload_page_offset = 0;
@@ -125,9 +128,11 @@ void GroupedAggregateHashTable::Destroy() {
 			has_destructor = true;
 		}
 	}
-	if (!has_destructor) {
+	if (!has_destructor || entries == 0) {
 		return;
 	}
+	// the aggregate states have to be in memory to destroy them
+	Pin();
 	// there are aggregates with destructors: loop over the hash table
 	// and call the destructor method for each of the aggregates
 	data_ptr_t data_pointers[STANDARD_VECTOR_SIZE];
@@ -789,6 +794,7 @@ void GroupedAggregateHashTable::FlushMove(Vector &source_addresses, Vector &sour
 void GroupedAggregateHashTable::Combine(GroupedAggregateHashTable &other) {
 
 	D_ASSERT(!is_finalized);
+	D_ASSERT(other.payload_hds.size() == other.payload_blocks.size());
 
 	D_ASSERT(other.payload_width == payload_width);
 	D_ASSERT(other.group_width == group_width);
@@ -838,6 +844,7 @@ struct PartitionInfo {
 void GroupedAggregateHashTable::Partition(vector<GroupedAggregateHashTable *> &partition_hts, hash_t mask,
                                           idx_t shift) {
 	D_ASSERT(partition_hts.size() > 1);
+	D_ASSERT(payload_hds.size() == payload_blocks.size());
 	vector<PartitionInfo> partition_info(partition_hts.size());
 
 	PayloadApply([&](idx_t page_nr, idx_t page_offset, data_ptr_t ptr) {
@@ -881,6 +888,7 @@ idx_t GroupedAggregateHashTable::Scan(idx_t &scan_position, DataChunk &result) {
 		return 0;
 	}
 	auto this_n = MinValue((idx_t)STANDARD_VECTOR_SIZE, remaining);
+	D_ASSERT(payload_hds.size() == payload_blocks.size());
 
 	auto chunk_idx = scan_position / tuples_per_block;
 	auto chunk_offset = (scan_position % tuples_per_block) * tuple_size;
@@ -923,4 +931,32 @@ void GroupedAggregateHashTable::Finalize() {
 	is_finalized = true;
 }
 
+void GroupedAggregateHashTable::Unpin() {
+	// the hashes refer to the payload pointers, so they have to be gone before the payload can be moved
+	D_ASSERT(is_finalized);
+	payload_hds.clear();
+	payload_hds_ptrs.clear();
+}
+
+void GroupedAggregateHashTable::Pin() {
+	if (payload_hds.size() == payload_blocks.size()) {
+		// already pinned
+		return;
+	}
+	D_ASSERT(payload_hds.empty());
+	for (auto &block : payload_blocks) {
+		auto pin = buffer_manager.Pin(block);
+		payload_hds_ptrs.push_back(pin->Ptr());
+		payload_hds.push_back(move(pin));
+	}
+}
+
+idx_t GroupedAggregateHashTable::SizeInBytes() {
+	idx_t size = payload_blocks.size() * Storage::BLOCK_ALLOC_SIZE;
+	if (hashes_hdl) {
+		size += MaxValue<idx_t>(Storage::BLOCK_ALLOC_SIZE, hashes_end_ptr - hashes_hdl_ptr);
+	}
+	return size;
+}
+
 } // namespace duckdb
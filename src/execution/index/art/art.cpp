@@ -1,15 +1,31 @@
 #include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/common/types/chunk_collection.hpp"
+#include "duckdb/common/limits.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/storage/block_manager.hpp"
+#include "duckdb/storage/buffer/block_handle.hpp"
+#include "duckdb/storage/meta_block_reader.hpp"
+#include "duckdb/storage/meta_block_writer.hpp"
 #include <algorithm>
+#include <atomic>
+#include <thread>
 #include <ctgmath>
 #include <cstring>
 
 namespace duckdb {
 
 ART::ART(vector<column_t> column_ids, vector<unique_ptr<Expression>> unbound_expressions, bool is_unique)
-    : Index(IndexType::ART, move(column_ids), move(unbound_expressions)), is_unique(is_unique) {
+    : Index(IndexType::ART, move(column_ids), move(unbound_expressions)), is_unique(is_unique), db(nullptr) {
 	tree = nullptr;
+	root_version = 0;
+	current_epoch = 1;
+	for (idx_t i = 0; i < ART_READER_SLOTS; i++) {
+		reader_epochs[i] = 0;
+	}
+	overflow_readers = 0;
 	expression_result.Initialize(logical_types);
 	int n = 1;
 	//! little endian if true
@@ -40,6 +56,196 @@ ART::ART(vector<column_t> column_ids, vector<unique_ptr<Expression>> unbound_exp
 ART::~ART() {
 }
 
+//===--------------------------------------------------------------------===//
+// Optimistic Lock Coupling
+//===--------------------------------------------------------------------===//
+// Point lookups do not take the lock of the index: they read the version of every node before reading from it and
+// validate that it did not change afterwards. Writers are serialized by the lock of the index and lock only the nodes
+// they modify (including the node holding a child they replace). Nodes and arrays that writers remove from the tree
+// are not freed right away, but only once no optimistic reader is active anymore.
+void ART::RetireNode(unique_ptr<Node> node) {
+	if (!node) {
+		return;
+	}
+	node->version.fetch_or(Node::VERSION_OBSOLETE);
+	ReleaseNode(*node);
+	retired_nodes.push_back(move(node));
+}
+
+void ART::AddNodeBlocks(BlockPointer pointer, idx_t size, const vector<block_id_t> &blocks) {
+	D_ASSERT(!blocks.empty() && blocks[0] == pointer.block_id);
+	// the node fills up the rest of the block it starts in, and continues in the next blocks if it does not fit
+	idx_t remaining = size;
+	idx_t available = Storage::BLOCK_SIZE - pointer.offset;
+	for (auto &block_id : blocks) {
+		auto bytes = MinValue<idx_t>(remaining, available);
+		block_usage[block_id] += bytes;
+		remaining -= bytes;
+		available = Storage::BLOCK_SIZE - sizeof(block_id_t);
+	}
+	D_ASSERT(remaining == 0);
+}
+
+void ART::ReleaseNode(Node &node) {
+	if (node.persistent_pointer.block_id == INVALID_BLOCK) {
+		return;
+	}
+	D_ASSERT(db);
+	auto &block_manager = BlockManager::GetBlockManager(*db);
+	block_id_t block_id = node.persistent_pointer.block_id;
+	idx_t remaining = node.persistent_size;
+	idx_t available = Storage::BLOCK_SIZE - node.persistent_pointer.offset;
+	while (remaining > 0) {
+		auto bytes = MinValue<idx_t>(remaining, available);
+		remaining -= bytes;
+		block_id_t next_block = INVALID_BLOCK;
+		if (remaining > 0) {
+			// the node continues in the next block of the chain
+			MetaBlockReader reader(*db, block_id, false);
+			next_block = reader.next_block;
+		}
+		auto entry = block_usage.find(block_id);
+		D_ASSERT(entry != block_usage.end() && entry->second >= bytes);
+		if (entry != block_usage.end()) {
+			entry->second -= MinValue<idx_t>(entry->second, bytes);
+			if (entry->second == 0) {
+				// the block does not store any node of the tree anymore: it is reused after the next checkpoint
+				block_usage.erase(entry);
+				block_manager.MarkBlockAsModified(block_id);
+			}
+		}
+		block_id = next_block;
+		available = Storage::BLOCK_SIZE - sizeof(block_id_t);
+	}
+	node.persistent_pointer.block_id = INVALID_BLOCK;
+}
+
+bool ART::IsSparseBlock(block_id_t block_id) {
+	auto entry = block_usage.find(block_id);
+	return entry != block_usage.end() && entry->second < Storage::BLOCK_SIZE / 4;
+}
+
+void ART::RetirePrefix(unique_ptr<uint8_t[]> prefix) {
+	retired_prefixes.push_back(move(prefix));
+}
+
+void ART::RetireRowIds(unique_ptr<row_t[]> row_ids) {
+	retired_row_ids.push_back(move(row_ids));
+}
+
+void ART::FreeRetired() {
+	if (!retired_nodes.empty() || !retired_prefixes.empty() || !retired_row_ids.empty()) {
+		// the nodes of the batch have been unlinked from the tree: readers that start in a later epoch cannot reach
+		// them
+		ARTRetiredBatch batch;
+		batch.epoch = current_epoch.fetch_add(1);
+		batch.nodes = move(retired_nodes);
+		batch.prefixes = move(retired_prefixes);
+		batch.row_ids = move(retired_row_ids);
+		retired_nodes.clear();
+		retired_prefixes.clear();
+		retired_row_ids.clear();
+		retired_batches.push_back(move(batch));
+	}
+	if (retired_batches.empty()) {
+		return;
+	}
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (overflow_readers.load() != 0) {
+		return;
+	}
+	// a batch can be freed once every reader that started in or before the epoch of the batch has left
+	auto oldest_epoch = NumericLimits<uint64_t>::Maximum();
+	for (idx_t i = 0; i < ART_READER_SLOTS; i++) {
+		auto epoch = reader_epochs[i].load();
+		if (epoch != 0 && epoch < oldest_epoch) {
+			oldest_epoch = epoch;
+		}
+	}
+	idx_t free_count = 0;
+	while (free_count < retired_batches.size() && retired_batches[free_count].epoch < oldest_epoch) {
+		free_count++;
+	}
+	retired_batches.erase(retired_batches.begin(), retired_batches.begin() + free_count);
+}
+
+idx_t ART::EnterReader() {
+	auto epoch = current_epoch.load();
+	// start looking for an unused slot at a slot determined by the thread, so readers rarely compete for a slot
+	auto start = std::hash<std::thread::id>()(std::this_thread::get_id());
+	for (idx_t i = 0; i < ART_READER_SLOTS; i++) {
+		idx_t slot = (start + i) % ART_READER_SLOTS;
+		uint64_t unused = 0;
+		if (reader_epochs[slot].compare_exchange_strong(unused, epoch)) {
+			return slot;
+		}
+	}
+	overflow_readers++;
+	return ART_READER_SLOTS;
+}
+
+void ART::LeaveReader(idx_t slot) {
+	if (slot == ART_READER_SLOTS) {
+		overflow_readers--;
+	} else {
+		reader_epochs[slot] = 0;
+	}
+}
+
+idx_t ART::RetiredCount() {
+	lock_guard<mutex> l(lock);
+	idx_t count = retired_nodes.size() + retired_prefixes.size() + retired_row_ids.size();
+	for (auto &batch : retired_batches) {
+		count += batch.nodes.size() + batch.prefixes.size() + batch.row_ids.size();
+	}
+	return count;
+}
+
+IndexPointer ART::Serialize(DatabaseInstance &db) {
+	lock_guard<mutex> l(lock);
+	this->db = &db;
+	IndexPointer result;
+	result.root.block_id = INVALID_BLOCK;
+	result.root.offset = 0;
+	// the nodes are written to blocks that only store nodes of this index, so they can be kept across checkpoints
+	MetaBlockWriter writer(db);
+	if (tree) {
+		bool written;
+		result.root = tree->Serialize(*this, writer, written);
+	}
+	writer.Flush();
+	if (writer.written_blocks.empty()) {
+		// no node has changed: the block of the writer has not been used
+		BlockManager::GetBlockManager(db).MarkBlockAsModified(writer.block->id);
+	}
+	result.blocks = block_usage;
+	// release the blocks that nodes have been loaded from: freed blocks can be reused after the checkpoint
+	loaded_blocks.clear();
+	FreeRetired();
+	return result;
+}
+
+void ART::Deserialize(DatabaseInstance &db, IndexPointer &pointer) {
+	lock_guard<mutex> l(lock);
+	this->db = &db;
+	block_usage = move(pointer.blocks);
+	if (pointer.root.block_id != INVALID_BLOCK) {
+		tree = Node::Deserialize(*this, pointer.root);
+	}
+}
+
+void ART::CommitDrop() {
+	lock_guard<mutex> l(lock);
+	if (!db) {
+		return;
+	}
+	auto &block_manager = BlockManager::GetBlockManager(*db);
+	for (auto &entry : block_usage) {
+		block_manager.MarkBlockAsModified(entry.first);
+	}
+	block_usage.clear();
+}
+
 bool ART::LeafMatches(Node *node, Key &key, unsigned depth) {
 	auto leaf = static_cast<Leaf *>(node);
 	Key &leaf_key = *leaf->value;
@@ -220,7 +426,7 @@ bool ART::Insert(IndexLock &lock, DataChunk &input, Vector &row_ids) {
 		}
 
 		row_t row_id = row_identifiers[i];
-		if (!Insert(tree, move(keys[i]), 0, row_id)) {
+		if (!Insert(tree, move(keys[i]), 0, row_id, root_version)) {
 			// failed to insert because of constraint violation
 			failed_index = i;
 			break;
@@ -239,10 +445,12 @@ bool ART::Insert(IndexLock &lock, DataChunk &input, Vector &row_ids) {
 				continue;
 			}
 			row_t row_id = row_identifiers[i];
-			Erase(tree, *keys[i], 0, row_id);
+			Erase(tree, *keys[i], 0, row_id, root_version);
 		}
+		FreeRetired();
 		return false;
 	}
+	FreeRetired();
 	return true;
 }
 
@@ -289,15 +497,21 @@ bool ART::InsertToLeaf(Leaf &leaf, row_t row_id) {
 	if (is_unique && leaf.num_elements != 0) {
 		return false;
 	}
-	leaf.Insert(row_id);
+	Node::WriteLock(leaf.version);
+	leaf.Insert(*this, row_id);
+	Node::WriteUnlock(leaf.version);
 	return true;
 }
 
-bool ART::Insert(unique_ptr<Node> &node, unique_ptr<Key> value, unsigned depth, row_t row_id) {
+bool ART::Insert(unique_ptr<Node> &node, unique_ptr<Key> value, unsigned depth, row_t row_id,
+                 std::atomic<uint64_t> &parent_version) {
 	Key &key = *value;
 	if (!node) {
 		// node is currently empty, create a leaf here with the key
-		node = make_unique<Leaf>(*this, move(value), row_id);
+		unique_ptr<Node> leaf_node = make_unique<Leaf>(*this, move(value), row_id);
+		Node::WriteLock(parent_version);
+		node = move(leaf_node);
+		Node::WriteUnlock(parent_version);
 		return true;
 	}
 
@@ -319,6 +533,8 @@ bool ART::Insert(unique_ptr<Node> &node, unique_ptr<Key> value, unsigned depth,
 			}
 		}
 
+		// the leaf itself is not modified, only the node holding it
+		Node::WriteLock(parent_version);
 		unique_ptr<Node> new_node = make_unique<Node4>(*this, new_prefix_length);
 		new_node->prefix_length = new_prefix_length;
 		memcpy(new_node->prefix.get(), &key[depth], new_prefix_length);
@@ -326,6 +542,7 @@ bool ART::Insert(unique_ptr<Node> &node, unique_ptr<Key> value, unsigned depth,
 		unique_ptr<Node> leaf_node = make_unique<Leaf>(*this, move(value), row_id);
 		Node4::Insert(*this, new_node, key[depth + new_prefix_length], leaf_node);
 		node = move(new_node);
+		Node::WriteUnlock(parent_version);
 		return true;
 	}
 
@@ -334,17 +551,21 @@ bool ART::Insert(unique_ptr<Node> &node, unique_ptr<Key> value, unsigned depth,
 		uint32_t mismatch_pos = Node::PrefixMismatch(*this, node.get(), key, depth);
 		if (mismatch_pos != node->prefix_length) {
 			// Prefix differs, create new node
+			auto node_ptr = node.get();
+			Node::WriteLock(parent_version);
+			Node::WriteLock(node_ptr->version);
 			unique_ptr<Node> new_node = make_unique<Node4>(*this, mismatch_pos);
 			new_node->prefix_length = mismatch_pos;
 			memcpy(new_node->prefix.get(), node->prefix.get(), mismatch_pos);
 			// Break up prefix
-			auto node_ptr = node.get();
 			Node4::Insert(*this, new_node, node->prefix[mismatch_pos], node);
 			node_ptr->prefix_length -= (mismatch_pos + 1);
 			memmove(node_ptr->prefix.get(), node_ptr->prefix.get() + mismatch_pos + 1, node_ptr->prefix_length);
 			unique_ptr<Node> leaf_node = make_unique<Leaf>(*this, move(value), row_id);
 			Node4::Insert(*this, new_node, key[depth + mismatch_pos], leaf_node);
 			node = move(new_node);
+			Node::WriteUnlock(node_ptr->version);
+			Node::WriteUnlock(parent_version);
 			return true;
 		}
 		depth += node->prefix_length;
@@ -353,14 +574,311 @@ bool ART::Insert(unique_ptr<Node> &node, unique_ptr<Key> value, unsigned depth,
 	// Recurse
 	idx_t pos = node->GetChildPos(key[depth]);
 	if (pos != INVALID_INDEX) {
-		auto child = node->GetChild(pos);
-		return Insert(*child, move(value), depth + 1, row_id);
+		auto child = node->GetChild(*this, pos);
+		return Insert(*child, move(value), depth + 1, row_id, node->version);
 	}
 	unique_ptr<Node> new_node = make_unique<Leaf>(*this, move(value), row_id);
+	// inserting into a full node replaces it with a bigger node, which modifies the parent as well
+	auto node_ptr = node.get();
+	Node::WriteLock(parent_version);
+	Node::WriteLock(node_ptr->version);
 	Node::InsertLeaf(*this, node, key[depth], new_node);
+	Node::WriteUnlock(node_ptr->version);
+	Node::WriteUnlock(parent_version);
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// Construct
+//===--------------------------------------------------------------------===//
+struct ARTEntry {
+	//! The first (up to) eight bytes of the key as a big-endian integer, zero-padded, so that most comparisons
+	//! while sorting do not have to touch the key itself
+	uint64_t prefix;
+	unique_ptr<Key> key;
+	row_t row_id;
+};
+
+static uint64_t GetKeyPrefix(Key &key) {
+	uint64_t prefix = 0;
+	for (idx_t i = 0; i < sizeof(uint64_t); i++) {
+		prefix <<= 8;
+		if (i < key.len) {
+			prefix |= key.data[i];
+		}
+	}
+	return prefix;
+}
+
+//! Returns the byte of the key at the given depth, which must be smaller than the length of the key
+static inline uint8_t GetKeyByte(const ARTEntry &entry, idx_t depth) {
+	if (depth < sizeof(uint64_t)) {
+		return (entry.prefix >> ((sizeof(uint64_t) - 1 - depth) * 8)) & 0xFF;
+	}
+	return (*entry.key)[depth];
+}
+
+static bool EntryIsSmaller(const ARTEntry &a, const ARTEntry &b) {
+	if (a.prefix != b.prefix) {
+		return a.prefix < b.prefix;
+	}
+	auto &left = *a.key;
+	auto &right = *b.key;
+	auto compare = memcmp(left.data.get(), right.data.get(), MinValue<idx_t>(left.len, right.len));
+	if (compare != 0) {
+		return compare < 0;
+	}
+	if (left.len != right.len) {
+		return left.len < right.len;
+	}
+	return a.row_id < b.row_id;
+}
+
+struct ARTConstructState {
+	explicit ARTConstructState(DatabaseInstance &db) : db(db), thread_count(MaxValue<idx_t>(db.NumberOfThreads(), 1)) {
+	}
+
+	DatabaseInstance &db;
+	idx_t thread_count;
+	//! The entries of the ART
+	vector<ARTEntry> entries;
+	//! Subtrees with at most this many entries are constructed by a single task
+	idx_t subtree_size;
+};
+
+//! Execute the work items with the task scheduler, and wait until all of them have finished
+static void ExecuteConstructTasks(ARTConstructState &state, vector<std::function<void()>> &work) {
+	TaskExecutor executor(state.db.GetScheduler());
+	for (auto &work_item : work) {
+		executor.ScheduleTask(move(work_item));
+	}
+	work.clear();
+	executor.WorkOnTasks();
+}
+
+//! Sort the entries in parallel: runs of entries are sorted by separate tasks, after which the runs are merged pairwise
+static void SortEntries(ARTConstructState &state) {
+	auto &entries = state.entries;
+	idx_t run_count = state.thread_count == 1 ? 1 : state.thread_count * 4;
+	vector<idx_t> bounds;
+	for (idx_t i = 0; i <= run_count; i++) {
+		bounds.push_back(entries.size() * i / run_count);
+	}
+	vector<std::function<void()>> work;
+	for (idx_t i = 0; i < run_count; i++) {
+		auto begin = entries.begin() + bounds[i];
+		auto end = entries.begin() + bounds[i + 1];
+		work.push_back([begin, end]() { std::sort(begin, end, EntryIsSmaller); });
+	}
+	ExecuteConstructTasks(state, work);
+
+	while (bounds.size() > 2) {
+		vector<idx_t> merged_bounds;
+		idx_t runs = bounds.size() - 1;
+		for (idx_t i = 0; i + 1 < runs; i += 2) {
+			auto begin = entries.begin() + bounds[i];
+			auto middle = entries.begin() + bounds[i + 1];
+			auto end = entries.begin() + bounds[i + 2];
+			work.push_back([begin, middle, end]() { std::inplace_merge(begin, middle, end, EntryIsSmaller); });
+			merged_bounds.push_back(bounds[i]);
+		}
+		if (runs % 2 == 1) {
+			// the last run has no partner in this round
+			merged_bounds.push_back(bounds[runs - 1]);
+		}
+		merged_bounds.push_back(bounds[runs]);
+		ExecuteConstructTasks(state, work);
+		bounds = move(merged_bounds);
+	}
+}
+
+bool ART::Construct(DatabaseInstance &db, IndexLock &lock, ChunkCollection &input) {
+	D_ASSERT(!tree);
+	ARTConstructState state(db);
+	auto &entries = state.entries;
+	entries.resize(input.Count());
+
+	// generate the keys of all entries in parallel
+	vector<std::function<void()>> work;
+	idx_t chunks_per_task = MaxValue<idx_t>(input.ChunkCount() / (state.thread_count * 4), 1);
+	for (idx_t chunk_start = 0; chunk_start < input.ChunkCount(); chunk_start += chunks_per_task) {
+		idx_t chunk_end = MinValue<idx_t>(chunk_start + chunks_per_task, input.ChunkCount());
+		work.push_back([&, chunk_start, chunk_end]() {
+			DataChunk key_chunk;
+			key_chunk.InitializeEmpty(logical_types);
+			for (idx_t chunk_idx = chunk_start; chunk_idx < chunk_end; chunk_idx++) {
+				auto &chunk = input.GetChunk(chunk_idx);
+				for (idx_t i = 0; i < logical_types.size(); i++) {
+					key_chunk.data[i].Reference(chunk.data[i]);
+				}
+				key_chunk.SetCardinality(chunk);
+				vector<unique_ptr<Key>> keys;
+				GenerateKeys(key_chunk, keys);
+
+				auto &row_ids = chunk.data[logical_types.size()];
+				row_ids.Normalify(chunk.size());
+				auto row_identifiers = FlatVector::GetData<row_t>(row_ids);
+				auto offset = chunk_idx * STANDARD_VECTOR_SIZE;
+				for (idx_t i = 0; i < chunk.size(); i++) {
+					if (keys[i]) {
+						entries[offset + i].prefix = GetKeyPrefix(*keys[i]);
+					}
+					entries[offset + i].key = move(keys[i]);
+					entries[offset + i].row_id = row_identifiers[i];
+				}
+			}
+		});
+	}
+	ExecuteConstructTasks(state, work);
+
+	// NULL values are not part of the index
+	entries.erase(std::remove_if(entries.begin(), entries.end(), [](const ARTEntry &entry) { return !entry.key; }),
+	              entries.end());
+	if (entries.empty()) {
+		return true;
+	}
+	SortEntries(state);
+
+	// check neighbouring entries for duplicate keys (in a unique index) and for keys that are a prefix of another key,
+	// which can only occur for strings containing null characters and which cannot be constructed bottom-up
+	std::atomic<bool> has_duplicates(false);
+	std::atomic<bool> has_prefix_keys(false);
+	idx_t check_size = MaxValue<idx_t>(entries.size() / (state.thread_count * 4), STANDARD_VECTOR_SIZE);
+	for (idx_t check_start = 1; check_start < entries.size(); check_start += check_size) {
+		idx_t check_end = MinValue<idx_t>(check_start + check_size, entries.size());
+		work.push_back([&, check_start, check_end]() {
+			for (idx_t i = check_start; i < check_end; i++) {
+				auto &previous = *entries[i - 1].key;
+				auto &current = *entries[i].key;
+				if (previous.len == current.len) {
+					if (is_unique && memcmp(previous.data.get(), current.data.get(), current.len) == 0) {
+						has_duplicates = true;
+						return;
+					}
+				} else if (previous.len < current.len &&
+				           memcmp(previous.data.get(), current.data.get(), previous.len) == 0) {
+					has_prefix_keys = true;
+					return;
+				}
+			}
+		});
+	}
+	ExecuteConstructTasks(state, work);
+	if (has_duplicates) {
+		return false;
+	}
+	if (has_prefix_keys) {
+		// fall back to inserting the entries one by one
+		for (auto &entry : entries) {
+			if (!Insert(tree, move(entry.key), 0, entry.row_id, root_version)) {
+				tree.reset();
+				return false;
+			}
+		}
+		FreeRetired();
+		return true;
+	}
+
+	// construct the upper levels of the tree in this thread, and the subtrees below them in parallel
+	if (state.thread_count == 1) {
+		ConstructNode(state, 0, entries.size(), 0, tree, nullptr);
+	} else {
+		state.subtree_size = MaxValue<idx_t>(entries.size() / (state.thread_count * 8), STANDARD_VECTOR_SIZE);
+		ConstructNode(state, 0, entries.size(), 0, tree, &work);
+		ExecuteConstructTasks(state, work);
+	}
 	return true;
 }
 
+void ART::ConstructNode(ARTConstructState &state, idx_t start, idx_t end, idx_t depth, unique_ptr<Node> &node,
+                        vector<std::function<void()>> *subtrees) {
+	D_ASSERT(start < end);
+	if (subtrees && end - start <= state.subtree_size) {
+		subtrees->push_back(
+		    [this, &state, start, end, depth, &node]() { ConstructNode(state, start, end, depth, node, nullptr); });
+		return;
+	}
+	auto &entries = state.entries;
+	auto &first = *entries[start].key;
+	auto &last = *entries[end - 1].key;
+	if (end - start == 1 || first == last) {
+		// all entries have the same key: they are stored in a single leaf
+		idx_t count = end - start;
+		auto row_ids = unique_ptr<row_t[]>(new row_t[count]);
+		for (idx_t i = 0; i < count; i++) {
+			row_ids[i] = entries[start + i].row_id;
+		}
+		node = make_unique<Leaf>(*this, move(entries[start].key), move(row_ids), count);
+		return;
+	}
+	// the entries are sorted: the prefix shared by the first and the last key is shared by all keys
+	uint32_t prefix_length = 0;
+	while (first[depth + prefix_length] == last[depth + prefix_length]) {
+		prefix_length++;
+	}
+	idx_t key_depth = depth + prefix_length;
+
+	// find the ranges of entries that have the same byte after the prefix, each range becomes a child
+	vector<uint8_t> child_keys;
+	vector<idx_t> child_starts;
+	idx_t child_start = start;
+	while (child_start < end) {
+		uint8_t key_byte = GetKeyByte(entries[child_start], key_depth);
+		auto child_end = std::upper_bound(entries.begin() + child_start, entries.begin() + end, key_byte,
+		                                  [key_depth](uint8_t byte, const ARTEntry &entry) {
+			                                  return byte < GetKeyByte(entry, key_depth);
+		                                  });
+		child_keys.push_back(key_byte);
+		child_starts.push_back(child_start);
+		child_start = child_end - entries.begin();
+	}
+	child_starts.push_back(end);
+
+	// create the smallest node that can hold all children
+	idx_t child_count = child_keys.size();
+	if (child_count <= 4) {
+		node = make_unique<Node4>(*this, prefix_length);
+	} else if (child_count <= 16) {
+		node = make_unique<Node16>(*this, prefix_length);
+	} else if (child_count <= 48) {
+		node = make_unique<Node48>(*this, prefix_length);
+	} else {
+		node = make_unique<Node256>(*this, prefix_length);
+	}
+	node->prefix_length = prefix_length;
+	memcpy(node->prefix.get(), &first[depth], prefix_length);
+	node->count = child_count;
+	for (idx_t i = 0; i < child_count; i++) {
+		unique_ptr<Node> *child;
+		switch (node->type) {
+		case NodeType::N4: {
+			auto n4 = (Node4 *)node.get();
+			n4->key[i] = child_keys[i];
+			child = &n4->child[i];
+			break;
+		}
+		case NodeType::N16: {
+			auto n16 = (Node16 *)node.get();
+			n16->key[i] = child_keys[i];
+			child = &n16->child[i];
+			break;
+		}
+		case NodeType::N48: {
+			auto n48 = (Node48 *)node.get();
+			n48->child_index[child_keys[i]] = i;
+			child = &n48->child[i];
+			break;
+		}
+		default: {
+			auto n256 = (Node256 *)node.get();
+			child = &n256->child[child_keys[i]];
+			break;
+		}
+		}
+		ConstructNode(state, child_starts[i], child_starts[i + 1], key_depth + 1, *child, subtrees);
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Delete
 //===--------------------------------------------------------------------===//
@@ -383,11 +901,13 @@ void ART::Delete(IndexLock &state, DataChunk &input, Vector &row_ids) {
 		if (!keys[i]) {
 			continue;
 		}
-		Erase(tree, *keys[i], 0, row_identifiers[i]);
+		Erase(tree, *keys[i], 0, row_identifiers[i], root_version);
 	}
+	FreeRetired();
 }
 
-void ART::Erase(unique_ptr<Node> &node, Key &key, unsigned depth, row_t row_id) {
+void ART::Erase(unique_ptr<Node> &node, Key &key, unsigned depth, row_t row_id,
+                std::atomic<uint64_t> &parent_version) {
 	if (!node) {
 		return;
 	}
@@ -396,9 +916,13 @@ void ART::Erase(unique_ptr<Node> &node, Key &key, unsigned depth, row_t row_id)
 		// Make sure we have the right leaf
 		if (ART::LeafMatches(node.get(), key, depth)) {
 			auto leaf = static_cast<Leaf *>(node.get());
+			Node::WriteLock(leaf->version);
 			leaf->Remove(row_id);
+			Node::WriteUnlock(leaf->version);
 			if (leaf->num_elements == 0) {
-				node.reset();
+				Node::WriteLock(parent_version);
+				RetireNode(move(node));
+				Node::WriteUnlock(parent_version);
 			}
 		}
 		return;
@@ -413,21 +937,28 @@ void ART::Erase(unique_ptr<Node> &node, Key &key, unsigned depth, row_t row_id)
 	}
 	idx_t pos = node->GetChildPos(key[depth]);
 	if (pos != INVALID_INDEX) {
-		auto child = node->GetChild(pos);
+		auto child = node->GetChild(*this, pos);
 		D_ASSERT(child);
 
 		unique_ptr<Node> &child_ref = *child;
 		if (child_ref->type == NodeType::NLeaf && LeafMatches(child_ref.get(), key, depth)) {
 			// Leaf found, remove entry
 			auto leaf = static_cast<Leaf *>(child_ref.get());
+			Node::WriteLock(leaf->version);
 			leaf->Remove(row_id);
+			Node::WriteUnlock(leaf->version);
 			if (leaf->num_elements == 0) {
 				// Leaf is empty, delete leaf, decrement node counter and maybe shrink node
+				auto node_ptr = node.get();
+				Node::WriteLock(parent_version);
+				Node::WriteLock(node_ptr->version);
 				Node::Erase(*this, node, pos);
+				Node::WriteUnlock(node_ptr->version);
+				Node::WriteUnlock(parent_version);
 			}
 		} else {
 			// Recurse
-			Erase(*child, key, depth + 1, row_id);
+			Erase(*child, key, depth + 1, row_id, node->version);
 		}
 	}
 }
@@ -470,28 +1001,119 @@ static unique_ptr<Key> CreateKey(ART &art, PhysicalType type, Value &value) {
 
 bool ART::SearchEqual(ARTIndexScanState *state, idx_t max_count, vector<row_t> &result_ids) {
 	auto key = CreateKey(*this, types[0], state->values[0]);
-	auto leaf = static_cast<Leaf *>(Lookup(tree, *key, 0));
-	if (!leaf) {
-		return true;
-	}
-	if (leaf->num_elements > max_count) {
+	vector<row_t> row_ids;
+	LookupRowIds(*key, row_ids);
+	if (row_ids.size() > max_count) {
 		return false;
 	}
-	for (idx_t i = 0; i < leaf->num_elements; i++) {
-		row_t row_id = leaf->GetRowId(i);
-		result_ids.push_back(row_id);
-	}
+	result_ids.insert(result_ids.end(), row_ids.begin(), row_ids.end());
 	return true;
 }
 
 void ART::SearchEqualJoinNoFetch(Value &equal_value, idx_t &result_size) {
 	//! We need to look for a leaf
 	auto key = CreateKey(*this, types[0], equal_value);
-	auto leaf = static_cast<Leaf *>(Lookup(tree, *key, 0));
-	if (!leaf) {
-		return;
+	vector<row_t> row_ids;
+	LookupRowIds(*key, row_ids);
+	result_size = row_ids.size();
+}
+
+//! The amount of times an optimistic lookup is restarted before the lookup takes the lock of the index
+static constexpr idx_t MAX_OPTIMISTIC_LOOKUPS = 8;
+
+void ART::LookupRowIds(Key &key, vector<row_t> &result_ids) {
+	bool requires_load = false;
+	for (idx_t attempt = 0; attempt < MAX_OPTIMISTIC_LOOKUPS && !requires_load; attempt++) {
+		if (OptimisticLookup(key, result_ids, requires_load)) {
+			return;
+		}
+	}
+	// the lookup keeps conflicting with writers or has to load nodes from storage: look up the key under the lock
+	lock_guard<mutex> l(lock);
+	result_ids.clear();
+	auto leaf = static_cast<Leaf *>(Lookup(tree, key, 0));
+	if (leaf) {
+		for (idx_t i = 0; i < leaf->num_elements; i++) {
+			result_ids.push_back(leaf->GetRowId(i));
+		}
+	}
+	FreeRetired();
+}
+
+//! Registers an optimistic reader for as long as it is traversing the tree, nodes retired in the meantime are not freed
+struct OptimisticReader {
+	explicit OptimisticReader(ART &art) : art(art), slot(art.EnterReader()) {
+	}
+	~OptimisticReader() {
+		art.LeaveReader(slot);
+	}
+
+	ART &art;
+	idx_t slot;
+};
+
+bool ART::OptimisticLookup(Key &key, vector<row_t> &result_ids, bool &requires_load) {
+	OptimisticReader reader(*this);
+	result_ids.clear();
+
+	uint64_t parent_version;
+	if (!Node::ReadLock(root_version, parent_version)) {
+		return false;
+	}
+	std::atomic<uint64_t> *parent = &root_version;
+	Node *node = tree.get();
+	idx_t depth = 0;
+	while (true) {
+		if (!node) {
+			// empty slot: the key is not in the tree, unless the parent changed in the meantime
+			return Node::ReadValidate(*parent, parent_version);
+		}
+		uint64_t node_version;
+		if (!Node::ReadLock(node->version, node_version)) {
+			return false;
+		}
+		// the node was read from the parent: verify that the parent did not change before reading from the node
+		if (!Node::ReadValidate(*parent, parent_version)) {
+			return false;
+		}
+		if (node->type == NodeType::NPersistent) {
+			// loading the node from storage modifies the tree: this requires the lock
+			requires_load = true;
+			return false;
+		}
+		if (node->type == NodeType::NLeaf) {
+			auto leaf = static_cast<Leaf *>(node);
+			Key &leaf_key = *leaf->value;
+			if (leaf_key.len != key.len || memcmp(leaf_key.data.get(), key.data.get(), key.len) != 0) {
+				return Node::ReadValidate(node->version, node_version);
+			}
+			idx_t num_elements = leaf->num_elements;
+			std::atomic_thread_fence(std::memory_order_acquire);
+			for (idx_t i = 0; i < num_elements; i++) {
+				result_ids.push_back(leaf->GetRowId(i));
+			}
+			return Node::ReadValidate(node->version, node_version);
+		}
+		uint32_t prefix_length = node->prefix_length;
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (depth + prefix_length >= key.len) {
+			// the key is too short to be in this subtree, unless we read an inconsistent state of the node
+			return Node::ReadValidate(node->version, node_version);
+		}
+		auto prefix = node->prefix.get();
+		for (idx_t pos = 0; pos < prefix_length; pos++) {
+			if (key[depth + pos] != prefix[pos]) {
+				return Node::ReadValidate(node->version, node_version);
+			}
+		}
+		depth += prefix_length;
+		idx_t pos = node->GetChildPos(key[depth]);
+		Node *child = pos == INVALID_INDEX ? nullptr : node->GetChildOptimistic(pos);
+		parent = &node->version;
+		parent_version = node_version;
+		node = child;
+		depth++;
 	}
-	result_size = leaf->num_elements;
 }
 
 Node *ART::Lookup(unique_ptr<Node> &node, Key &key, unsigned depth) {
@@ -521,7 +1143,7 @@ Node *ART::Lookup(unique_ptr<Node> &node, Key &key, unsigned depth) {
 		if (pos == INVALID_INDEX) {
 			return nullptr;
 		}
-		node_val = node_val->GetChild(pos)->get();
+		node_val = node_val->GetChild(*this, pos)->get();
 		D_ASSERT(node_val);
 
 		depth++;
@@ -590,7 +1212,7 @@ bool ART::IteratorNext(Iterator &it) {
 		top.pos = node->GetNextPos(top.pos);
 		if (top.pos != INVALID_INDEX) {
 			// next node found: go there
-			it.SetEntry(it.depth, IteratorEntry(node->GetChild(top.pos)->get(), INVALID_INDEX));
+			it.SetEntry(it.depth, IteratorEntry(node->GetChild(*this, top.pos)->get(), INVALID_INDEX));
 			it.depth++;
 		} else {
 			// no node found: move up the tree
@@ -620,7 +1242,7 @@ bool ART::Bound(unique_ptr<Node> &n, Key &key, Iterator &it, bool inclusive) {
 		it.depth++;
 		if (!equal) {
 			while (node->type != NodeType::NLeaf) {
-				node = node->GetChild(node->GetMin())->get();
+				node = node->GetChild(*this, node->GetMin())->get();
 				auto &c_top = it.stack[it.depth];
 				c_top.node = node;
 				it.depth++;
@@ -681,7 +1303,7 @@ bool ART::Bound(unique_ptr<Node> &n, Key &key, Iterator &it, bool inclusive) {
 			// Find min leaf
 			top.pos = node->GetMin();
 		}
-		node = node->GetChild(top.pos)->get();
+		node = node->GetChild(*this, top.pos)->get();
 		//! This means all children of this node qualify as geq
 
 		depth++;
@@ -709,39 +1331,16 @@ bool ART::SearchGreater(ARTIndexScanState *state, bool inclusive, idx_t max_coun
 //===--------------------------------------------------------------------===//
 // Less Than
 //===--------------------------------------------------------------------===//
-static Leaf &FindMinimum(Iterator &it, Node &node) {
-	Node *next = nullptr;
-	idx_t pos = 0;
-	switch (node.type) {
-	case NodeType::NLeaf:
+static Leaf &FindMinimum(ART &art, Iterator &it, Node &node) {
+	if (node.type == NodeType::NLeaf) {
 		it.node = (Leaf *)&node;
 		return (Leaf &)node;
-	case NodeType::N4:
-		next = ((Node4 &)node).child[0].get();
-		break;
-	case NodeType::N16:
-		next = ((Node16 &)node).child[0].get();
-		break;
-	case NodeType::N48: {
-		auto &n48 = (Node48 &)node;
-		while (n48.child_index[pos] == Node::EMPTY_MARKER) {
-			pos++;
-		}
-		next = n48.child[n48.child_index[pos]].get();
-		break;
-	}
-	case NodeType::N256: {
-		auto &n256 = (Node256 &)node;
-		while (!n256.child[pos]) {
-			pos++;
-		}
-		next = n256.child[pos].get();
-		break;
-	}
 	}
+	idx_t pos = node.GetMin();
+	Node *next = node.GetChild(art, pos)->get();
 	it.SetEntry(it.depth, IteratorEntry(&node, pos));
 	it.depth++;
-	return FindMinimum(it, *next);
+	return FindMinimum(art, it, *next);
 }
 
 bool ART::SearchLess(ARTIndexScanState *state, bool inclusive, idx_t max_count, vector<row_t> &result_ids) {
@@ -754,7 +1353,7 @@ bool ART::SearchLess(ARTIndexScanState *state, bool inclusive, idx_t max_count,
 
 	if (!it->start) {
 		// first find the minimum value in the ART: we start scanning from this value
-		auto &minimum = FindMinimum(state->iterator, *tree);
+		auto &minimum = FindMinimum(*this, state->iterator, *tree);
 		// early out min value higher than upper bound query
 		if (*minimum.value > *upper_bound) {
 			return true;
@@ -801,13 +1400,13 @@ bool ART::Scan(Transaction &transaction, DataTable &table, IndexScanState &table
 
 	vector<row_t> row_ids;
 	bool success = true;
-	if (state->values[1].is_null) {
+	if (state->values[1].is_null && state->expressions[0] == ExpressionType::COMPARE_EQUAL) {
+		// point lookups do not lock the index
+		success = SearchEqual(state, max_count, row_ids);
+	} else if (state->values[1].is_null) {
 		lock_guard<mutex> l(lock);
 		// single predicate
 		switch (state->expressions[0]) {
-		case ExpressionType::COMPARE_EQUAL:
-			success = SearchEqual(state, max_count, row_ids);
-			break;
 		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
 			success = SearchGreater(state, true, max_count, row_ids);
 			break;
@@ -823,6 +1422,7 @@ bool ART::Scan(Transaction &transaction, DataTable &table, IndexScanState &table
 		default:
 			throw NotImplementedException("Operation not implemented");
 		}
+		FreeRetired();
 	} else {
 		lock_guard<mutex> l(lock);
 		// two predicates
@@ -830,6 +1430,7 @@ bool ART::Scan(Transaction &transaction, DataTable &table, IndexScanState &table
 		bool left_inclusive = state->expressions[0] == ExpressionType ::COMPARE_GREATERTHANOREQUALTO;
 		bool right_inclusive = state->expressions[1] == ExpressionType ::COMPARE_LESSTHANOREQUALTO;
 		success = SearchCloseRange(state, left_inclusive, right_inclusive, max_count, row_ids);
+		FreeRetired();
 	}
 	if (!success) {
 		return false;
@@ -1,3 +1,4 @@
+#include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/execution/index/art/node.hpp"
 #include "duckdb/execution/index/art/leaf.hpp"
 
@@ -13,15 +14,30 @@ Leaf::Leaf(ART &art, unique_ptr<Key> value, row_t row_id) : Node(art, NodeType::
 	this->num_elements = 1;
 }
 
-void Leaf::Insert(row_t row_id) {
+Leaf::Leaf(ART &art, unique_ptr<Key> value, unique_ptr<row_t[]> row_ids, idx_t num_elements)
+    : Node(art, NodeType::NLeaf, 0) {
+	D_ASSERT(num_elements > 0);
+	this->value = move(value);
+	this->capacity = num_elements;
+	this->row_ids = move(row_ids);
+	this->num_elements = num_elements;
+}
+
+void Leaf::Insert(ART &art, row_t row_id) {
 	// Grow array
 	if (num_elements == capacity) {
 		auto new_row_id = unique_ptr<row_t[]>(new row_t[capacity * 2]);
 		memcpy(new_row_id.get(), row_ids.get(), capacity * sizeof(row_t));
 		capacity *= 2;
-		row_ids = move(new_row_id);
+		// optimistic readers might still be reading the old array
+		row_ids.swap(new_row_id);
+		art.RetireRowIds(move(new_row_id));
 	}
-	row_ids[num_elements++] = row_id;
+	row_ids[num_elements] = row_id;
+	// the row ids are written before the number of elements is increased, so optimistic readers never read past the
+	// end of the array they observe
+	std::atomic_thread_fence(std::memory_order_release);
+	num_elements++;
 }
 
 //! TODO: Maybe shrink array dynamically?
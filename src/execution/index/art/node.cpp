@@ -1,11 +1,19 @@
 #include "duckdb/execution/index/art/node.hpp"
 #include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/index/art/persistent_node.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/serializer/buffered_serializer.hpp"
+#include "duckdb/storage/buffer/block_handle.hpp"
+#include "duckdb/storage/meta_block_reader.hpp"
+#include "duckdb/storage/meta_block_writer.hpp"
 
 namespace duckdb {
 
-Node::Node(ART &art, NodeType type, size_t compressed_prefix_size) : prefix_length(0), count(0), type(type) {
+Node::Node(ART &art, NodeType type, size_t compressed_prefix_size)
+    : prefix_length(0), count(0), type(type), version(0), persistent_size(0), persistent_version(0) {
 	this->prefix = unique_ptr<uint8_t[]>(new uint8_t[compressed_prefix_size]);
+	persistent_pointer.block_id = INVALID_BLOCK;
+	persistent_pointer.offset = 0;
 }
 
 void Node::CopyPrefix(ART &art, Node *src, Node *dst) {
@@ -13,11 +21,22 @@ void Node::CopyPrefix(ART &art, Node *src, Node *dst) {
 	memcpy(dst->prefix.get(), src->prefix.get(), src->prefix_length);
 }
 
-unique_ptr<Node> *Node::GetChild(idx_t pos) {
+unique_ptr<Node> *Node::GetChild(ART &art, idx_t pos) {
 	D_ASSERT(0);
 	return nullptr;
 }
 
+unique_ptr<Node> *Node::LoadChild(ART &art, unique_ptr<Node> &child) {
+	if (child && child->type == NodeType::NPersistent) {
+		auto loaded_child = Node::Deserialize(art, ((PersistentNode &)*child).pointer);
+		// optimistic readers can observe either the placeholder or the loaded node, but never an empty slot
+		std::atomic_thread_fence(std::memory_order_release);
+		child.swap(loaded_child);
+		art.RetireNode(move(loaded_child));
+	}
+	return &child;
+}
+
 idx_t Node::GetMin() {
 	D_ASSERT(0);
 	return 0;
@@ -75,4 +94,162 @@ void Node::Erase(ART &art, unique_ptr<Node> &node, idx_t pos) {
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Serialization
+//===--------------------------------------------------------------------===//
+BlockPointer Node::Serialize(ART &art, MetaBlockWriter &writer, bool &written) {
+	if (type == NodeType::NPersistent) {
+		// the node has not been loaded, so it has not been modified either
+		written = false;
+		return ((PersistentNode *)this)->pointer;
+	}
+	// the children are written first, so the node can store their location
+	vector<uint8_t> child_keys;
+	vector<BlockPointer> child_pointers;
+	bool children_written = false;
+	if (type != NodeType::NLeaf) {
+		for (idx_t pos = GetNextPos(INVALID_INDEX); pos != INVALID_INDEX; pos = GetNextPos(pos)) {
+			switch (type) {
+			case NodeType::N4:
+				child_keys.push_back(((Node4 *)this)->key[pos]);
+				break;
+			case NodeType::N16:
+				child_keys.push_back(((Node16 *)this)->key[pos]);
+				break;
+			default:
+				// the position in a Node48 or Node256 is the key byte itself
+				child_keys.push_back(pos);
+				break;
+			}
+			auto child = GetChildOptimistic(pos);
+			if (child->type == NodeType::NPersistent &&
+			    art.IsSparseBlock(((PersistentNode *)child)->pointer.block_id)) {
+				// the child is stored in a block that is mostly unused: load it, so it is moved to a new block
+				child = GetChild(art, pos)->get();
+			}
+			bool child_written;
+			child_pointers.push_back(child->Serialize(art, writer, child_written));
+			children_written = children_written || child_written;
+		}
+	}
+	if (!children_written && persistent_pointer.block_id != INVALID_BLOCK && version == persistent_version &&
+	    !art.IsSparseBlock(persistent_pointer.block_id)) {
+		// neither the node nor its children have changed: the node is still stored at the same location
+		written = false;
+		return persistent_pointer;
+	}
+	// the node is written again: the previous copy of the node is no longer used
+	art.ReleaseNode(*this);
+
+	BufferedSerializer serializer;
+	serializer.Write<uint8_t>((uint8_t)type);
+	serializer.Write<uint32_t>(prefix_length);
+	serializer.WriteData(prefix.get(), prefix_length);
+	if (type == NodeType::NLeaf) {
+		auto leaf = (Leaf *)this;
+		serializer.Write<uint32_t>(leaf->value->len);
+		serializer.WriteData(leaf->value->data.get(), leaf->value->len);
+		serializer.Write<idx_t>(leaf->num_elements);
+		for (idx_t i = 0; i < leaf->num_elements; i++) {
+			serializer.Write<row_t>(leaf->GetRowId(i));
+		}
+	} else {
+		serializer.Write<uint16_t>(child_keys.size());
+		for (idx_t i = 0; i < child_keys.size(); i++) {
+			serializer.Write<uint8_t>(child_keys[i]);
+			serializer.Write<block_id_t>(child_pointers[i].block_id);
+			serializer.Write<uint32_t>(child_pointers[i].offset);
+		}
+	}
+	auto data = serializer.GetData();
+
+	BlockPointer pointer;
+	pointer.block_id = writer.block->id;
+	pointer.offset = writer.offset;
+	idx_t flushed_blocks = writer.written_blocks.size();
+	writer.WriteData(data.data.get(), data.size);
+	// the node is stored in the blocks that were filled up while writing it and in the current block of the writer
+	vector<block_id_t> blocks(writer.written_blocks.begin() + flushed_blocks, writer.written_blocks.end());
+	blocks.push_back(writer.block->id);
+	if (pointer.offset == Storage::BLOCK_SIZE) {
+		// the previous node filled up the block: the node starts at the beginning of the next block
+		blocks.erase(blocks.begin());
+		pointer.block_id = blocks[0];
+		pointer.offset = sizeof(block_id_t);
+	}
+	art.AddNodeBlocks(pointer, data.size, blocks);
+
+	persistent_pointer = pointer;
+	persistent_size = data.size;
+	persistent_version = version;
+	written = true;
+	return pointer;
+}
+
+unique_ptr<Node> Node::Deserialize(ART &art, BlockPointer pointer) {
+	D_ASSERT(art.db);
+	// the blocks of the index are kept as long as they store nodes of the tree: reading them does not free them
+	MetaBlockReader reader(*art.db, pointer.block_id, false);
+	reader.offset = pointer.offset;
+	// keep the blocks alive, so other nodes stored in the same blocks do not have to be read from disk again
+	art.loaded_blocks[pointer.block_id] = reader.block;
+
+	auto node_type = (NodeType)reader.Read<uint8_t>();
+	auto prefix_length = reader.Read<uint32_t>();
+	auto prefix = unique_ptr<uint8_t[]>(new uint8_t[prefix_length]);
+	reader.ReadData(prefix.get(), prefix_length);
+	idx_t size = sizeof(uint8_t) + sizeof(uint32_t) + prefix_length;
+
+	unique_ptr<Node> result;
+	switch (node_type) {
+	case NodeType::NLeaf: {
+		auto key_length = reader.Read<uint32_t>();
+		auto key_data = unique_ptr<data_t[]>(new data_t[key_length]);
+		reader.ReadData(key_data.get(), key_length);
+		auto num_elements = reader.Read<idx_t>();
+		auto row_ids = unique_ptr<row_t[]>(new row_t[num_elements]);
+		reader.ReadData((data_ptr_t)row_ids.get(), num_elements * sizeof(row_t));
+		size += sizeof(uint32_t) + key_length + sizeof(idx_t) + num_elements * sizeof(row_t);
+		result = make_unique<Leaf>(art, make_unique<Key>(move(key_data), key_length), move(row_ids), num_elements);
+		break;
+	}
+	case NodeType::N4:
+		result = make_unique<Node4>(art, 0);
+		break;
+	case NodeType::N16:
+		result = make_unique<Node16>(art, 0);
+		break;
+	case NodeType::N48:
+		result = make_unique<Node48>(art, 0);
+		break;
+	case NodeType::N256:
+		result = make_unique<Node256>(art, 0);
+		break;
+	default:
+		throw IOException("Corrupt index node in database file");
+	}
+	result->prefix = move(prefix);
+	result->prefix_length = prefix_length;
+	if (node_type != NodeType::NLeaf) {
+		// the children are inserted in key order, so they end up at the same position as before
+		auto child_count = reader.Read<uint16_t>();
+		size += sizeof(uint16_t) + child_count * (sizeof(uint8_t) + sizeof(block_id_t) + sizeof(uint32_t));
+		for (idx_t i = 0; i < child_count; i++) {
+			auto key_byte = reader.Read<uint8_t>();
+			BlockPointer child_pointer;
+			child_pointer.block_id = reader.Read<block_id_t>();
+			child_pointer.offset = reader.Read<uint32_t>();
+			unique_ptr<Node> child = make_unique<PersistentNode>(art, child_pointer);
+			Node::InsertLeaf(art, result, key_byte, child);
+		}
+	}
+	if (reader.block->BlockId() != pointer.block_id) {
+		art.loaded_blocks[reader.block->BlockId()] = reader.block;
+	}
+	result->persistent_pointer = pointer;
+	result->persistent_size = size;
+	result->persistent_version = result->version;
+	return result;
+}
+
 } // namespace duckdb
@@ -1,26 +1,68 @@
+#include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/execution/index/art/node4.hpp"
 #include "duckdb/execution/index/art/node16.hpp"
 #include "duckdb/execution/index/art/node48.hpp"
 
 #include <cstring>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace duckdb {
 
 Node16::Node16(ART &art, size_t compression_length) : Node(art, NodeType::N16, compression_length) {
 	memset(key, 16, sizeof(key));
 }
 
-// TODO : In the future this can be performed using SIMD (#include <emmintrin.h>  x86 SSE intrinsics)
+#if defined(__SSE2__)
+//! Returns a bitmask with the bits of the first "count" keys set
+static inline uint32_t Node16KeyMask(idx_t count) {
+	return (1U << count) - 1;
+}
+
+//! Returns a bitmask with a bit set for every key that is equal to k
+static inline uint32_t Node16KeysEqual(uint8_t key[], uint8_t k) {
+	auto keys = _mm_loadu_si128((const __m128i *)key);
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(keys, _mm_set1_epi8((char)k)));
+}
+
+//! Returns a bitmask with a bit set for every key that is smaller than k. SSE2 only compares signed bytes, flipping
+//! the sign bit of both sides turns that into an unsigned comparison.
+static inline uint32_t Node16KeysSmaller(uint8_t key[], uint8_t k) {
+	auto sign_bit = _mm_set1_epi8((char)0x80);
+	auto keys = _mm_xor_si128(_mm_loadu_si128((const __m128i *)key), sign_bit);
+	auto search = _mm_xor_si128(_mm_set1_epi8((char)k), sign_bit);
+	return _mm_movemask_epi8(_mm_cmplt_epi8(keys, search));
+}
+#endif
+
 idx_t Node16::GetChildPos(uint8_t k) {
+#if defined(__SSE2__)
+	auto matches = Node16KeysEqual(key, k) & Node16KeyMask(count);
+	if (matches) {
+		return __builtin_ctz(matches);
+	}
+#else
 	for (idx_t pos = 0; pos < count; pos++) {
 		if (key[pos] == k) {
 			return pos;
 		}
 	}
+#endif
 	return Node::GetChildPos(k);
 }
 
 idx_t Node16::GetChildGreaterEqual(uint8_t k, bool &equal) {
+#if defined(__SSE2__)
+	// the keys are sorted: the first key that is not smaller than k is the one we are looking for
+	auto greater_equal = ~Node16KeysSmaller(key, k) & Node16KeyMask(count);
+	if (greater_equal) {
+		idx_t pos = __builtin_ctz(greater_equal);
+		equal = key[pos] == k;
+		return pos;
+	}
+#else
 	for (idx_t pos = 0; pos < count; pos++) {
 		if (key[pos] >= k) {
 			if (key[pos] == k) {
@@ -32,6 +74,7 @@ idx_t Node16::GetChildGreaterEqual(uint8_t k, bool &equal) {
 			return pos;
 		}
 	}
+#endif
 	return Node::GetChildGreaterEqual(k, equal);
 }
 
@@ -43,9 +86,13 @@ idx_t Node16::GetNextPos(idx_t pos) {
 	return pos < count ? pos : INVALID_INDEX;
 }
 
-unique_ptr<Node> *Node16::GetChild(idx_t pos) {
+unique_ptr<Node> *Node16::GetChild(ART &art, idx_t pos) {
 	D_ASSERT(pos < count);
-	return &child[pos];
+	return LoadChild(art, child[pos]);
+}
+
+Node *Node16::GetChildOptimistic(idx_t pos) {
+	return pos < 16 ? child[pos].get() : nullptr;
 }
 
 idx_t Node16::GetMin() {
@@ -57,10 +104,14 @@ void Node16::Insert(ART &art, unique_ptr<Node> &node, uint8_t key_byte, unique_p
 
 	if (n->count < 16) {
 		// Insert element
+#if defined(__SSE2__)
+		idx_t pos = __builtin_popcount(Node16KeysSmaller(n->key, key_byte) & Node16KeyMask(n->count));
+#else
 		idx_t pos = 0;
 		while (pos < node->count && n->key[pos] < key_byte) {
 			pos++;
 		}
+#endif
 		if (n->child[pos] != nullptr) {
 			for (idx_t i = n->count; i > pos; i--) {
 				n->key[i] = n->key[i - 1];
@@ -79,6 +130,7 @@ void Node16::Insert(ART &art, unique_ptr<Node> &node, uint8_t key_byte, unique_p
 		}
 		CopyPrefix(art, n, new_node.get());
 		new_node->count = node->count;
+		art.RetireNode(move(node));
 		node = move(new_node);
 
 		Node48::Insert(art, node, key_byte, child);
@@ -88,7 +140,7 @@ void Node16::Insert(ART &art, unique_ptr<Node> &node, uint8_t key_byte, unique_p
 void Node16::Erase(ART &art, unique_ptr<Node> &node, int pos) {
 	Node16 *n = static_cast<Node16 *>(node.get());
 	// erase the child and decrease the count
-	n->child[pos].reset();
+	art.RetireNode(move(n->child[pos]));
 	n->count--;
 	// potentially move any children backwards
 	for (; pos < n->count; pos++) {
@@ -103,6 +155,7 @@ void Node16::Erase(ART &art, unique_ptr<Node> &node, int pos) {
 			new_node->child[new_node->count++] = move(n->child[i]);
 		}
 		CopyPrefix(art, n, new_node.get());
+		art.RetireNode(move(node));
 		node = move(new_node);
 	}
 }
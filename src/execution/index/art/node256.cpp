@@ -1,3 +1,4 @@
+#include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/execution/index/art/node48.hpp"
 #include "duckdb/execution/index/art/node256.hpp"
 
@@ -46,9 +47,13 @@ idx_t Node256::GetNextPos(idx_t pos) {
 	return Node::GetNextPos(pos);
 }
 
-unique_ptr<Node> *Node256::GetChild(idx_t pos) {
+unique_ptr<Node> *Node256::GetChild(ART &art, idx_t pos) {
 	D_ASSERT(child[pos]);
-	return &child[pos];
+	return LoadChild(art, child[pos]);
+}
+
+Node *Node256::GetChildOptimistic(idx_t pos) {
+	return child[pos].get();
 }
 
 void Node256::Insert(ART &art, unique_ptr<Node> &node, uint8_t key_byte, unique_ptr<Node> &child) {
@@ -61,7 +66,7 @@ void Node256::Insert(ART &art, unique_ptr<Node> &node, uint8_t key_byte, unique_
 void Node256::Erase(ART &art, unique_ptr<Node> &node, int pos) {
 	Node256 *n = static_cast<Node256 *>(node.get());
 
-	n->child[pos].reset();
+	art.RetireNode(move(n->child[pos]));
 	n->count--;
 	if (node->count <= 36) {
 		auto new_node = make_unique<Node48>(art, n->prefix_length);
@@ -73,6 +78,7 @@ void Node256::Erase(ART &art, unique_ptr<Node> &node, int pos) {
 				new_node->count++;
 			}
 		}
+		art.RetireNode(move(node));
 		node = move(new_node);
 	}
 }
@@ -43,9 +43,13 @@ idx_t Node4::GetNextPos(idx_t pos) {
 	return pos < count ? pos : INVALID_INDEX;
 }
 
-unique_ptr<Node> *Node4::GetChild(idx_t pos) {
+unique_ptr<Node> *Node4::GetChild(ART &art, idx_t pos) {
 	D_ASSERT(pos < count);
-	return &child[pos];
+	return LoadChild(art, child[pos]);
+}
+
+Node *Node4::GetChildOptimistic(idx_t pos) {
+	return pos < 4 ? child[pos].get() : nullptr;
 }
 
 void Node4::Insert(ART &art, unique_ptr<Node> &node, uint8_t key_byte, unique_ptr<Node> &child) {
@@ -76,6 +80,7 @@ void Node4::Insert(ART &art, unique_ptr<Node> &node, uint8_t key_byte, unique_pt
 			new_node->key[i] = n->key[i];
 			new_node->child[i] = move(n->child[i]);
 		}
+		art.RetireNode(move(node));
 		node = move(new_node);
 		Node16::Insert(art, node, key_byte, child);
 	}
@@ -86,7 +91,7 @@ void Node4::Erase(ART &art, unique_ptr<Node> &node, int pos) {
 	D_ASSERT(pos < n->count);
 
 	// erase the child and decrease the count
-	n->child[pos].reset();
+	art.RetireNode(move(n->child[pos]));
 	n->count--;
 	// potentially move any children backwards
 	for (; pos < n->count; pos++) {
@@ -96,7 +101,7 @@ void Node4::Erase(ART &art, unique_ptr<Node> &node, int pos) {
 
 	// This is a one way node
 	if (n->count == 1) {
-		auto childref = n->child[0].get();
+		auto childref = n->GetChild(art, 0)->get();
 		//! concatenate prefixes
 		auto new_length = node->prefix_length + childref->prefix_length + 1;
 		//! have to allocate space in our prefix array
@@ -113,10 +118,17 @@ void Node4::Erase(ART &art, unique_ptr<Node> &node, int pos) {
 		for (uint32_t i = 0; i < node->prefix_length; i++) {
 			new_prefix[i] = node->prefix[i];
 		}
-		//! set new prefix and move the child
-		childref->prefix = move(new_prefix);
+		//! set new prefix and move the child. The prefix is replaced before its length is increased, so optimistic
+		//! readers never read past the end of the prefix they observe.
+		Node::WriteLock(childref->version);
+		childref->prefix.swap(new_prefix);
+		art.RetirePrefix(move(new_prefix));
+		std::atomic_thread_fence(std::memory_order_release);
 		childref->prefix_length = new_length;
-		node = move(n->child[0]);
+		Node::WriteUnlock(childref->version);
+		auto merged_child = move(n->child[0]);
+		art.RetireNode(move(node));
+		node = move(merged_child);
 	}
 }
 
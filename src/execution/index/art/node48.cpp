@@ -1,7 +1,12 @@
+#include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/execution/index/art/node16.hpp"
 #include "duckdb/execution/index/art/node48.hpp"
 #include "duckdb/execution/index/art/node256.hpp"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace duckdb {
 
 Node48::Node48(ART &art, size_t compression_length) : Node(art, NodeType::N48, compression_length) {
@@ -10,6 +15,31 @@ Node48::Node48(ART &art, size_t compression_length) : Node(art, NodeType::N48, c
 	}
 }
 
+//! Returns the first position starting from pos that holds a child, or INVALID_INDEX if there is none
+static idx_t Node48NextChild(uint8_t child_index[], idx_t pos) {
+#if defined(__SSE2__)
+	// compare sixteen entries of the child index at a time
+	auto empty = _mm_set1_epi8((char)Node::EMPTY_MARKER);
+	for (idx_t block = pos & ~idx_t(15); block < 256; block += 16) {
+		auto entries = _mm_loadu_si128((const __m128i *)(child_index + block));
+		uint32_t occupied = ~_mm_movemask_epi8(_mm_cmpeq_epi8(entries, empty)) & 0xFFFF;
+		if (block < pos) {
+			occupied &= ~((1U << (pos - block)) - 1);
+		}
+		if (occupied) {
+			return block + __builtin_ctz(occupied);
+		}
+	}
+#else
+	for (; pos < 256; pos++) {
+		if (child_index[pos] != Node::EMPTY_MARKER) {
+			return pos;
+		}
+	}
+#endif
+	return INVALID_INDEX;
+}
+
 idx_t Node48::GetChildPos(uint8_t k) {
 	if (child_index[k] == Node::EMPTY_MARKER) {
 		return INVALID_INDEX;
@@ -19,40 +49,34 @@ idx_t Node48::GetChildPos(uint8_t k) {
 }
 
 idx_t Node48::GetChildGreaterEqual(uint8_t k, bool &equal) {
-	for (idx_t pos = k; pos < 256; pos++) {
-		if (child_index[pos] != Node::EMPTY_MARKER) {
-			if (pos == k) {
-				equal = true;
-			} else {
-				equal = false;
-			}
-			return pos;
-		}
+	auto pos = Node48NextChild(child_index, k);
+	if (pos != INVALID_INDEX) {
+		equal = pos == k;
+		return pos;
 	}
 	return Node::GetChildGreaterEqual(k, equal);
 }
 
 idx_t Node48::GetNextPos(idx_t pos) {
-	for (pos == INVALID_INDEX ? pos = 0 : pos++; pos < 256; pos++) {
-		if (child_index[pos] != Node::EMPTY_MARKER) {
-			return pos;
-		}
+	pos = pos == INVALID_INDEX ? 0 : pos + 1;
+	if (pos < 256) {
+		return Node48NextChild(child_index, pos);
 	}
 	return Node::GetNextPos(pos);
 }
 
-unique_ptr<Node> *Node48::GetChild(idx_t pos) {
+unique_ptr<Node> *Node48::GetChild(ART &art, idx_t pos) {
 	D_ASSERT(child_index[pos] != Node::EMPTY_MARKER);
-	return &child[child_index[pos]];
+	return LoadChild(art, child[child_index[pos]]);
+}
+
+Node *Node48::GetChildOptimistic(idx_t pos) {
+	auto index = child_index[pos];
+	return index < 48 ? child[index].get() : nullptr;
 }
 
 idx_t Node48::GetMin() {
-	for (idx_t i = 0; i < 256; i++) {
-		if (child_index[i] != Node::EMPTY_MARKER) {
-			return i;
-		}
-	}
-	return INVALID_INDEX;
+	return Node48NextChild(child_index, 0);
 }
 
 void Node48::Insert(ART &art, unique_ptr<Node> &node, uint8_t key_byte, unique_ptr<Node> &child) {
@@ -82,6 +106,7 @@ void Node48::Insert(ART &art, unique_ptr<Node> &node, uint8_t key_byte, unique_p
 		}
 		new_node->count = n->count;
 		CopyPrefix(art, n, new_node.get());
+		art.RetireNode(move(node));
 		node = move(new_node);
 		Node256::Insert(art, node, key_byte, child);
 	}
@@ -90,7 +115,7 @@ void Node48::Insert(ART &art, unique_ptr<Node> &node, uint8_t key_byte, unique_p
 void Node48::Erase(ART &art, unique_ptr<Node> &node, int pos) {
 	Node48 *n = static_cast<Node48 *>(node.get());
 
-	n->child[n->child_index[pos]].reset();
+	art.RetireNode(move(n->child[n->child_index[pos]]));
 	n->child_index[pos] = Node::EMPTY_MARKER;
 	n->count--;
 	if (node->count <= 12) {
@@ -102,6 +127,7 @@ void Node48::Erase(ART &art, unique_ptr<Node> &node, int pos) {
 				new_node->child[new_node->count++] = move(n->child[n->child_index[i]]);
 			}
 		}
+		art.RetireNode(move(node));
 		node = move(new_node);
 	}
 }
@@ -0,0 +1,9 @@
+#include "duckdb/execution/index/art/persistent_node.hpp"
+
+namespace duckdb {
+
+PersistentNode::PersistentNode(ART &art, BlockPointer pointer)
+    : Node(art, NodeType::NPersistent, 0), pointer(pointer) {
+}
+
+} // namespace duckdb
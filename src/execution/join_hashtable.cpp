@@ -8,14 +8,20 @@
 #include "duckdb/common/vector_operations/unary_executor.hpp"
 #include "duckdb/common/operator/comparison_operators.hpp"
 
+#include <atomic>
+
 namespace duckdb {
 
 using ScanStructure = JoinHashTable::ScanStructure;
 
+//! The maximum amount of partitions a HT that does not fit in memory is split into
+static constexpr idx_t MAX_PARTITION_COUNT = 1024;
+
 JoinHashTable::JoinHashTable(BufferManager &buffer_manager, vector<JoinCondition> &conditions,
                              vector<LogicalType> btypes, JoinType type)
-    : buffer_manager(buffer_manager), build_types(move(btypes)), equality_size(0), condition_size(0), build_size(0),
-      entry_size(0), tuple_size(0), join_type(type), finalized(false), has_null(false), count(0) {
+    : buffer_manager(buffer_manager), conditions(conditions), build_types(move(btypes)), equality_size(0),
+      condition_size(0), build_size(0), entry_size(0), tuple_size(0), join_type(type), finalized(false),
+      has_null(false), count(0), is_partition(false), radix_bits(0) {
 	for (auto &condition : conditions) {
 		D_ASSERT(condition.left->return_type == condition.right->return_type);
 		auto type = condition.left->return_type;
@@ -224,6 +230,51 @@ idx_t JoinHashTable::AppendToBlock(HTDataBlock &block, BufferHandle &handle, vec
 	return append_count;
 }
 
+void JoinHashTable::AllocateEntries(idx_t entry_count, vector<unique_ptr<BufferHandle>> &handles,
+                                    data_ptr_t key_locations[]) {
+	vector<BlockAppendEntry> append_entries;
+	idx_t remaining = entry_count;
+	{
+		// first append to the last block (if any)
+		lock_guard<mutex> append_lock(ht_lock);
+		if (!blocks.empty()) {
+			auto &last_block = blocks.back();
+			if (last_block.count < last_block.capacity) {
+				// last block has space: pin the buffer of this block
+				auto handle = buffer_manager.Pin(last_block.block);
+				// now append to the block
+				idx_t append_count = AppendToBlock(last_block, *handle, append_entries, remaining);
+				remaining -= append_count;
+				handles.push_back(move(handle));
+			}
+		}
+		while (remaining > 0) {
+			// now for the remaining data, allocate new buffers to store the data and append there
+			auto block = buffer_manager.RegisterMemory(block_capacity * entry_size, false);
+			auto handle = buffer_manager.Pin(block);
+
+			HTDataBlock new_block;
+			new_block.count = 0;
+			new_block.capacity = block_capacity;
+			new_block.block = move(block);
+
+			idx_t append_count = AppendToBlock(new_block, *handle, append_entries, remaining);
+			remaining -= append_count;
+			handles.push_back(move(handle));
+			blocks.push_back(move(new_block));
+		}
+	}
+	// now set up the key_locations based on the append entries
+	idx_t append_idx = 0;
+	for (auto &append_entry : append_entries) {
+		idx_t next = append_idx + append_entry.count;
+		for (; append_idx < next; append_idx++) {
+			key_locations[append_idx] = append_entry.baseptr;
+			append_entry.baseptr += entry_size;
+		}
+	}
+}
+
 static idx_t FilterNullValues(VectorData &vdata, const SelectionVector &sel, idx_t count, SelectionVector &result) {
 	auto &nullmask = *vdata.nullmask;
 	idx_t result_count = 0;
@@ -298,49 +349,9 @@ void JoinHashTable::Build(DataChunk &keys, DataChunk &payload) {
 	count += added_count;
 
 	vector<unique_ptr<BufferHandle>> handles;
-	vector<BlockAppendEntry> append_entries;
 	data_ptr_t key_locations[STANDARD_VECTOR_SIZE];
 	// first allocate space of where to serialize the keys and payload columns
-	idx_t remaining = added_count;
-	{
-		// first append to the last block (if any)
-		lock_guard<mutex> append_lock(ht_lock);
-		if (!blocks.empty()) {
-			auto &last_block = blocks.back();
-			if (last_block.count < last_block.capacity) {
-				// last block has space: pin the buffer of this block
-				auto handle = buffer_manager.Pin(last_block.block);
-				// now append to the block
-				idx_t append_count = AppendToBlock(last_block, *handle, append_entries, remaining);
-				remaining -= append_count;
-				handles.push_back(move(handle));
-			}
-		}
-		while (remaining > 0) {
-			// now for the remaining data, allocate new buffers to store the data and append there
-			auto block = buffer_manager.RegisterMemory(block_capacity * entry_size, false);
-			auto handle = buffer_manager.Pin(block);
-
-			HTDataBlock new_block;
-			new_block.count = 0;
-			new_block.capacity = block_capacity;
-			new_block.block = move(block);
-
-			idx_t append_count = AppendToBlock(new_block, *handle, append_entries, remaining);
-			remaining -= append_count;
-			handles.push_back(move(handle));
-			blocks.push_back(move(new_block));
-		}
-	}
-	// now set up the key_locations based on the append entries
-	idx_t append_idx = 0;
-	for (auto &append_entry : append_entries) {
-		idx_t next = append_idx + append_entry.count;
-		for (; append_idx < next; append_idx++) {
-			key_locations[append_idx] = append_entry.baseptr;
-			append_entry.baseptr += entry_size;
-		}
-	}
+	AllocateEntries(added_count, handles, key_locations);
 
 	// hash the keys and obtain an entry in the list
 	// note that we only hash the keys used in the equality comparison
@@ -364,7 +375,22 @@ void JoinHashTable::Build(DataChunk &keys, DataChunk &payload) {
 	SerializeVector(hash_values, payload.size(), *current_sel, added_count, key_locations);
 }
 
-void JoinHashTable::InsertHashes(Vector &hashes, idx_t count, data_ptr_t key_locations[]) {
+void JoinHashTable::Merge(JoinHashTable &other) {
+	D_ASSERT(!finalized && !other.finalized);
+	D_ASSERT(entry_size == other.entry_size && pointer_offset == other.pointer_offset);
+	lock_guard<mutex> append_lock(ht_lock);
+	// the entries point into the string heap of the other HT: move the blocks and the string heap over
+	for (auto &block : other.blocks) {
+		blocks.push_back(move(block));
+	}
+	other.blocks.clear();
+	string_heap.MergeHeap(other.string_heap);
+	count += other.count;
+	other.count = 0;
+	has_null = has_null || other.has_null;
+}
+
+void JoinHashTable::InsertHashes(Vector &hashes, idx_t count, data_ptr_t key_locations[], bool parallel) {
 	D_ASSERT(hashes.type.id() == LogicalTypeId::HASH);
 
 	// use bitmask to get position in array
@@ -373,8 +399,21 @@ void JoinHashTable::InsertHashes(Vector &hashes, idx_t count, data_ptr_t key_loc
 	hashes.Normalify(count);
 
 	D_ASSERT(hashes.vector_type == VectorType::FLAT_VECTOR);
-	auto pointers = (data_ptr_t *)hash_map->node->buffer;
 	auto indices = FlatVector::GetData<hash_t>(hashes);
+	if (parallel) {
+		// other threads are inserting into the same hash map: swap in the new head of the chain with a CAS
+		auto pointers = (std::atomic<data_ptr_t> *)hash_map->node->buffer;
+		for (idx_t i = 0; i < count; i++) {
+			auto &head = pointers[indices[i]];
+			auto prev_pointer = head.load(std::memory_order_relaxed);
+			do {
+				Store<data_ptr_t>(prev_pointer, key_locations[i] + pointer_offset);
+			} while (!head.compare_exchange_weak(prev_pointer, key_locations[i], std::memory_order_release,
+			                                     std::memory_order_relaxed));
+		}
+		return;
+	}
+	auto pointers = (data_ptr_t *)hash_map->node->buffer;
 	for (idx_t i = 0; i < count; i++) {
 		auto index = indices[i];
 		// set prev in current key to the value (NOTE: this will be nullptr if
@@ -387,26 +426,49 @@ void JoinHashTable::InsertHashes(Vector &hashes, idx_t count, data_ptr_t key_loc
 	}
 }
 
-void JoinHashTable::Finalize() {
-	// the build has finished, now iterate over all the nodes and construct the final hash table
+bool JoinHashTable::InitializeHashMap() {
+	D_ASSERT(!finalized);
+	// the build has finished, now construct the final hash table
 	// select a HT that has at least 50% empty space
 	idx_t capacity = NextPowerOfTwo(MaxValue<idx_t>(count * 2, (Storage::BLOCK_ALLOC_SIZE / sizeof(data_ptr_t)) + 1));
 	// size needs to be a power of 2
 	D_ASSERT((capacity & (capacity - 1)) == 0);
 	bitmask = capacity - 1;
 
+	// check if the pinned blocks and the hash map fit in memory
+	idx_t ht_size = blocks.size() * block_capacity * entry_size + capacity * sizeof(data_ptr_t);
+	idx_t max_memory = buffer_manager.GetMaxMemory();
+	if (ht_size > max_memory / 2 && CanPartition()) {
+		// they do not: partition the HT so that every partition takes up at most an eighth of the memory
+		idx_t partition_count = NextPowerOfTwo(ht_size / MaxValue<idx_t>(max_memory / 8, 1) + 1);
+		partition_count = MinValue<idx_t>(partition_count, MAX_PARTITION_COUNT);
+		idx_t bits = 0;
+		while (((idx_t)1 << bits) < partition_count) {
+			bits++;
+		}
+		Partition(bits);
+		finalized = true;
+		return false;
+	}
+
 	// allocate the HT and initialize it with all-zero entries
+	static_assert(sizeof(std::atomic<data_ptr_t>) == sizeof(data_ptr_t), "atomic pointers must be lock-free");
 	hash_map = buffer_manager.Allocate(capacity * sizeof(data_ptr_t));
 	memset(hash_map->node->buffer, 0, capacity * sizeof(data_ptr_t));
+	pinned_handles.resize(blocks.size());
+	return true;
+}
 
+void JoinHashTable::InsertBlocks(idx_t block_start, idx_t block_end, bool parallel) {
+	D_ASSERT(hash_map && block_start <= block_end && block_end <= blocks.size());
 	Vector hashes(LogicalType::HASH);
 	auto hash_data = FlatVector::GetData<hash_t>(hashes);
 	data_ptr_t key_locations[STANDARD_VECTOR_SIZE];
-	// now construct the actual hash table; scan the nodes
-	// as we can the nodes we pin all the blocks of the HT and keep them pinned until the HT is destroyed
+	// scan the nodes and insert them into the hash map
+	// as we scan the nodes we pin all the blocks of the HT and keep them pinned until the HT is destroyed
 	// this is so that we can keep pointers around to the blocks
-	// FIXME: if we cannot keep everything pinned in memory, we could switch to an out-of-memory merge join or so
-	for (auto &block : blocks) {
+	for (idx_t block_idx = block_start; block_idx < block_end; block_idx++) {
+		auto &block = blocks[block_idx];
 		auto handle = buffer_manager.Pin(block.block);
 		data_ptr_t dataptr = handle->node->buffer;
 		idx_t entry = 0;
@@ -419,18 +481,110 @@ void JoinHashTable::Finalize() {
 				dataptr += entry_size;
 			}
 			// now insert into the hash table
-			InsertHashes(hashes, next, key_locations);
+			InsertHashes(hashes, next, key_locations, parallel);
 
 			entry += next;
 		}
-		pinned_handles.push_back(move(handle));
+		pinned_handles[block_idx] = move(handle);
+	}
+}
+
+void JoinHashTable::Finalize() {
+	if (InitializeHashMap()) {
+		InsertBlocks(0, blocks.size(), false);
+		finalized = true;
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Partitioning
+//===--------------------------------------------------------------------===//
+bool JoinHashTable::CanPartition() {
+	// FULL/RIGHT OUTER joins scan the entire HT after the probe, and correlated MARK joins keep track of the counts per
+	// group in a separate HT: these are not partitioned
+	return !is_partition && !IsRightOuterJoin(join_type) && correlated_mark_join_info.correlated_types.empty();
+}
+
+void JoinHashTable::Partition(idx_t radix_bits_p) {
+	D_ASSERT(radix_bits_p > 0 && radix_bits_p < sizeof(hash_t) * 8);
+	radix_bits = radix_bits_p;
+	idx_t partition_count = (idx_t)1 << radix_bits;
+	for (idx_t i = 0; i < partition_count; i++) {
+		auto partition = make_unique<JoinHashTable>(buffer_manager, conditions, build_types, join_type);
+		partition->is_partition = true;
+		// whether or not the build side has NULL values is a property of the entire HT (used for MARK joins)
+		partition->has_null = has_null;
+		partitions.push_back(move(partition));
+	}
+	// scatter the entries of the HT to the partitions one block at a time
+	// the hashes are still stored in the place of the next pointers, because the hash map has not been built
+	auto shift = sizeof(hash_t) * 8 - radix_bits;
+	vector<vector<data_ptr_t>> partition_entries(partition_count);
+	for (auto &block : blocks) {
+		auto handle = buffer_manager.Pin(block.block);
+		data_ptr_t dataptr = handle->node->buffer;
+		for (idx_t i = 0; i < block.count; i++) {
+			auto hash = Load<hash_t>(dataptr + pointer_offset);
+			partition_entries[hash >> shift].push_back(dataptr);
+			dataptr += entry_size;
+		}
+		for (idx_t partition_idx = 0; partition_idx < partition_count; partition_idx++) {
+			auto &entries = partition_entries[partition_idx];
+			partitions[partition_idx]->AppendEntries(entries.data(), entries.size());
+			entries.clear();
+		}
+		// the entries of the block have been copied, we can destroy the block
+		handle.reset();
+		block.block.reset();
 	}
+	blocks.clear();
+	// partition 0 is kept in memory while the probe side is scanned
+	FinalizePartition(0);
+}
+
+void JoinHashTable::AppendEntries(data_ptr_t entries[], idx_t entry_count) {
+	data_ptr_t key_locations[STANDARD_VECTOR_SIZE];
+	for (idx_t entry_idx = 0; entry_idx < entry_count; entry_idx += STANDARD_VECTOR_SIZE) {
+		idx_t next = MinValue<idx_t>(STANDARD_VECTOR_SIZE, entry_count - entry_idx);
+		vector<unique_ptr<BufferHandle>> handles;
+		AllocateEntries(next, handles, key_locations);
+		for (idx_t i = 0; i < next; i++) {
+			memcpy(key_locations[i], entries[entry_idx + i], entry_size);
+		}
+		count += next;
+	}
+}
+
+void JoinHashTable::ComputePartitions(DataChunk &keys, idx_t partition_indices[]) {
+	D_ASSERT(IsPartitioned());
+	Vector hashes(LogicalType::HASH);
+	Hash(keys, FlatVector::INCREMENTAL_SELECTION_VECTOR, keys.size(), hashes);
+
+	VectorData hdata;
+	hashes.Orrify(keys.size(), hdata);
+	auto hash_data = (hash_t *)hdata.data;
+	auto shift = sizeof(hash_t) * 8 - radix_bits;
+	for (idx_t i = 0; i < keys.size(); i++) {
+		partition_indices[i] = hash_data[hdata.sel->get_index(i)] >> shift;
+	}
+}
+
+void JoinHashTable::FinalizePartition(idx_t partition_idx) {
+	D_ASSERT(partition_idx < partitions.size() && partitions[partition_idx]);
+	partitions[partition_idx]->Finalize();
+}
 
-	finalized = true;
+void JoinHashTable::ReleasePartition(idx_t partition_idx) {
+	D_ASSERT(partition_idx < partitions.size());
+	partitions[partition_idx].reset();
 }
 
+//===--------------------------------------------------------------------===//
+// Probe
+//===--------------------------------------------------------------------===//
 unique_ptr<ScanStructure> JoinHashTable::Probe(DataChunk &keys) {
-	D_ASSERT(count > 0); // should be handled before
+	// empty HTs should be handled before, except for the partitions of a partitioned HT
+	D_ASSERT(count > 0 || is_partition);
 	D_ASSERT(finalized);
 
 	// set up the scan structure
@@ -911,8 +1065,8 @@ void ScanStructure::ConstructMarkJoinResult(DataChunk &join_keys, DataChunk &chi
 void ScanStructure::NextMarkJoin(DataChunk &keys, DataChunk &input, DataChunk &result) {
 	D_ASSERT(result.ColumnCount() == input.ColumnCount() + 1);
 	D_ASSERT(result.data.back().type == LogicalType::BOOLEAN);
-	// this method should only be called for a non-empty HT
-	D_ASSERT(ht.count > 0);
+	// this method should only be called for a non-empty HT (or a partition of a non-empty HT)
+	D_ASSERT(ht.count > 0 || ht.is_partition);
 
 	ScanKeyMatches(keys);
 	if (ht.correlated_mark_join_info.correlated_types.empty()) {
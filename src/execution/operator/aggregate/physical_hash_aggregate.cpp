@@ -3,9 +3,11 @@
 #include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/aggregate_hashtable.hpp"
+#include "duckdb/execution/executor.hpp"
 #include "duckdb/execution/partitionable_hashtable.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parallel/pipeline.hpp"
+#include "duckdb/parallel/task_context.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
@@ -70,13 +72,16 @@ PhysicalHashAggregate::PhysicalHashAggregate(ClientContext &context, vector<Logi
 class HashAggregateGlobalState : public GlobalOperatorState {
 public:
 	HashAggregateGlobalState(PhysicalHashAggregate &op_p, ClientContext &context)
-	    : op(op_p), is_empty(true), lossy_total_groups(0),
+	    : op(op_p), buffer_manager(BufferManager::GetBufferManager(context)), is_empty(true), lossy_total_groups(0),
 	      partition_info((idx_t)TaskScheduler::GetScheduler(context).NumberOfThreads()) {
 	}
 
 	PhysicalHashAggregate &op;
+	BufferManager &buffer_manager;
 	vector<unique_ptr<PartitionableHashTable>> intermediate_hts;
 	vector<unique_ptr<GroupedAggregateHashTable>> finalized_hts;
+	//! The finalized HTs of every radix partition, a partition that does not fit in memory is split into several HTs
+	vector<HashTableList> finalized_partitions;
 
 	//! Whether or not any tuples were added to the HT
 	bool is_empty;
@@ -198,11 +203,21 @@ void PhysicalHashAggregate::Sink(ExecutionContext &context, GlobalOperatorState
 	                         gstate.lossy_total_groups > radix_limit && gstate.partition_info.n_partitions > 1);
 }
 
+class HashAggregateParallelState : public ParallelState {
+public:
+	HashAggregateParallelState() : next_ht(0) {
+	}
+
+	//! The index of the next finalized HT to be scanned
+	std::atomic<idx_t> next_ht;
+};
+
 class PhysicalHashAggregateState : public PhysicalOperatorState {
 public:
 	PhysicalHashAggregateState(PhysicalOperator &op, vector<LogicalType> &group_types,
 	                           vector<LogicalType> &aggregate_types, PhysicalOperator *child)
-	    : PhysicalOperatorState(op, child), ht_index(0), ht_scan_position(0) {
+	    : PhysicalOperatorState(op, child), ht_index(0), ht_scan_position(0), parallel_state(nullptr),
+	      initialized(false) {
 		auto scan_chunk_types = group_types;
 		for (auto &aggr_type : aggregate_types) {
 			scan_chunk_types.push_back(aggr_type);
@@ -216,6 +231,10 @@ public:
 	//! The current position to scan the HT for output tuples
 	idx_t ht_index;
 	idx_t ht_scan_position;
+	//! The state of the parallel scan (if this is a parallel scan of the HTs)
+	HashAggregateParallelState *parallel_state;
+	//! Whether or not the scan has been initialized
+	bool initialized;
 };
 
 void PhysicalHashAggregate::Combine(ExecutionContext &context, GlobalOperatorState &state, LocalSinkState &lstate) {
@@ -261,23 +280,97 @@ public:
 	PhysicalHashAggregateFinalizeTask(Pipeline &parent_p, HashAggregateGlobalState &state_p, idx_t radix_p)
 	    : parent(parent_p), state(state_p), radix(radix_p) {
 	}
+
+	//! Combine the HTs into a single finalized HT. The result is unpinned, so that it can be offloaded to disk until
+	//! it is scanned.
+	static unique_ptr<GroupedAggregateHashTable> CombineHTs(HashAggregateGlobalState &gstate, HashTableList &hts) {
+		auto &op = gstate.op;
+		auto result = make_unique<GroupedAggregateHashTable>(gstate.buffer_manager, op.group_types, op.payload_types,
+		                                                     op.bindings, HtEntryType::HT_WIDTH_64);
+		for (auto &ht : hts) {
+			ht->Pin();
+			result->Combine(*ht);
+			ht.reset();
+		}
+		result->Finalize();
+		result->Unpin();
+		return result;
+	}
+
 	static void FinalizeHT(HashAggregateGlobalState &gstate, idx_t radix) {
-		D_ASSERT(gstate.finalized_hts[radix]);
+		HashTableList partition_hts;
+		idx_t partition_size = 0;
 		for (auto &pht : gstate.intermediate_hts) {
 			for (auto &ht : pht->GetPartition(radix)) {
-				gstate.finalized_hts[radix]->Combine(*ht);
-				ht.reset();
+				partition_size += ht->SizeInBytes();
+				partition_hts.push_back(move(ht));
+			}
+		}
+		auto &result = gstate.finalized_partitions[radix];
+
+		// the finalize tasks of the partitions run concurrently, and the hashes of the combined HT take about as much
+		// space as the payload: if the partition would not fit within its share of memory we split it further
+		auto partition_memory_limit = gstate.buffer_manager.GetMaxMemory() / (2 * gstate.partition_info.n_partitions);
+		idx_t sub_radix_bits = 0;
+		while (sub_radix_bits < 8 && (2 * partition_size >> sub_radix_bits) > partition_memory_limit) {
+			sub_radix_bits++;
+		}
+		if (sub_radix_bits == 0) {
+			result.push_back(CombineHTs(gstate, partition_hts));
+			return;
+		}
+
+		// the bits below the radix bits of the partitions determine the sub-partition
+		idx_t sub_partitions = (idx_t)1 << sub_radix_bits;
+		idx_t sub_radix_shift = RadixPartitionInfo::RADIX_SHIFT - sub_radix_bits;
+		hash_t sub_radix_mask = (hash_t)(sub_partitions - 1) << sub_radix_shift;
+
+		auto &op = gstate.op;
+		vector<HashTableList> sub_partition_hts(sub_partitions);
+		for (auto &ht : partition_hts) {
+			vector<GroupedAggregateHashTable *> targets;
+			for (idx_t r = 0; r < sub_partitions; r++) {
+				sub_partition_hts[r].push_back(make_unique<GroupedAggregateHashTable>(
+				    gstate.buffer_manager, op.group_types, op.payload_types, op.bindings, HtEntryType::HT_WIDTH_32));
+				targets.push_back(sub_partition_hts[r].back().get());
+			}
+			ht->Pin();
+			ht->Partition(targets, sub_radix_mask, sub_radix_shift);
+			ht.reset();
+			for (auto &target : targets) {
+				target->Finalize();
+				target->Unpin();
 			}
 		}
-		gstate.finalized_hts[radix]->Finalize();
+		// now combine the sub-partitions one at a time
+		for (auto &hts : sub_partition_hts) {
+			result.push_back(CombineHTs(gstate, hts));
+		}
+	}
+
+	//! Gather the finalized partitions into the list of HTs that is scanned
+	static void CollectPartitions(HashAggregateGlobalState &gstate) {
+		for (auto &partition : gstate.finalized_partitions) {
+			for (auto &ht : partition) {
+				gstate.finalized_hts.push_back(move(ht));
+			}
+		}
+		gstate.finalized_partitions.clear();
 	}
 
 	void Execute() override {
-		FinalizeHT(state, radix);
+		try {
+			FinalizeHT(state, radix);
+		} catch (std::exception &ex) {
+			parent.executor.PushError(ex.what());
+		} catch (...) {
+			parent.executor.PushError("Unknown exception in hash aggregate finalize!");
+		}
 		lock_guard<mutex> glock(state.lock);
 		parent.finished_tasks++;
 		// finish the whole pipeline
 		if (parent.total_tasks == parent.finished_tasks) {
+			CollectPartitions(state);
 			parent.Finish();
 		}
 	}
@@ -333,11 +426,8 @@ void PhysicalHashAggregate::FinalizeInternal(ClientContext &context, unique_ptr<
 			D_ASSERT(pipeline);
 			pipeline->total_tasks += gstate.partition_info.n_partitions;
 		}
-		gstate.finalized_hts.resize(gstate.partition_info.n_partitions);
+		gstate.finalized_partitions.resize(gstate.partition_info.n_partitions);
 		for (idx_t r = 0; r < gstate.partition_info.n_partitions; r++) {
-			gstate.finalized_hts[r] =
-			    make_unique<GroupedAggregateHashTable>(BufferManager::GetBufferManager(context), group_types,
-			                                           payload_types, bindings, HtEntryType::HT_WIDTH_64);
 			if (immediate) {
 				PhysicalHashAggregateFinalizeTask::FinalizeHT(gstate, r);
 			} else {
@@ -346,6 +436,9 @@ void PhysicalHashAggregate::FinalizeInternal(ClientContext &context, unique_ptr<
 				TaskScheduler::GetScheduler(context).ScheduleTask(pipeline->token, move(new_task));
 			}
 		}
+		if (immediate) {
+			PhysicalHashAggregateFinalizeTask::CollectPartitions(gstate);
+		}
 	} else { // in the non-partitioned case we immediately combine all the unpartitioned hts created by the threads.
 		     // TODO possible optimization, if total count < limit for 32 bit ht, use that one
 		     // create this ht here so finalize needs no lock on gstate
@@ -397,22 +490,38 @@ void PhysicalHashAggregate::GetChunkInternal(ExecutionContext &context, DataChun
 		state.finished = true;
 		return;
 	}
+	if (!state.initialized) {
+		// check if the HTs are scanned in parallel: in that case every task scans entire HTs
+		auto task_info = context.task.task_info.find(this);
+		if (task_info != context.task.task_info.end()) {
+			state.parallel_state = (HashAggregateParallelState *)task_info->second;
+			state.ht_index = state.parallel_state->next_ht++;
+		}
+		state.initialized = true;
+	}
 	idx_t elements_found = 0;
 
 	while (true) {
-		if (state.ht_index == gstate.finalized_hts.size()) {
+		if (state.ht_index >= gstate.finalized_hts.size()) {
 			state.finished = true;
 			return;
 		}
-		elements_found = gstate.finalized_hts[state.ht_index]->Scan(state.ht_scan_position, state.scan_chunk);
+		auto &ht = *gstate.finalized_hts[state.ht_index];
+		// the HT might have been offloaded to disk after it was finalized
+		ht.Pin();
+		elements_found = ht.Scan(state.ht_scan_position, state.scan_chunk);
 
 		if (elements_found > 0) {
 			break;
 		}
 		gstate.finalized_hts[state.ht_index].reset();
-		state.ht_index++;
+		state.ht_index = state.parallel_state ? state.parallel_state->next_ht++ : state.ht_index + 1;
 		state.ht_scan_position = 0;
 	}
+	if (state.parallel_state) {
+		// the HTs are returned in order of their index by a sequential scan
+		context.task.batch_index = state.ht_index;
+	}
 
 	// compute the final projection list
 	idx_t chunk_index = 0;
@@ -435,6 +544,19 @@ unique_ptr<PhysicalOperatorState> PhysicalHashAggregate::GetOperatorState() {
 	                                               children.empty() ? nullptr : children[0].get());
 }
 
+idx_t PhysicalHashAggregate::MaxThreads() {
+	D_ASSERT(sink_state);
+	auto &gstate = (HashAggregateGlobalState &)*sink_state;
+	if (gstate.is_empty) {
+		return 0;
+	}
+	return gstate.finalized_hts.size();
+}
+
+unique_ptr<ParallelState> PhysicalHashAggregate::GetParallelState() {
+	return make_unique<HashAggregateParallelState>();
+}
+
 bool PhysicalHashAggregate::ForceSingleHT(GlobalOperatorState &state) {
 	auto &gstate = (HashAggregateGlobalState &)state;
 
@@ -0,0 +1,152 @@
+#include "duckdb/execution/operator/helper/physical_result_collector.hpp"
+
+#include "duckdb/common/pair.hpp"
+#include "duckdb/common/types/chunk_collection.hpp"
+#include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
+#include "duckdb/execution/operator/join/physical_hash_join.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/parallel/task_context.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+PhysicalResultCollector::PhysicalResultCollector(PhysicalOperator *plan)
+    : PhysicalSink(PhysicalOperatorType::RESULT_COLLECTOR, plan->types), plan(plan) {
+}
+
+bool PhysicalResultCollector::CanCollectInParallel(ClientContext &context, PhysicalOperator *op) {
+	switch (op->type) {
+	case PhysicalOperatorType::FILTER:
+	case PhysicalOperatorType::PROJECTION:
+	case PhysicalOperatorType::UNNEST:
+	case PhysicalOperatorType::CROSS_PRODUCT:
+	case PhysicalOperatorType::STREAMING_SAMPLE:
+		return CanCollectInParallel(context, op->children[0].get());
+	case PhysicalOperatorType::HASH_JOIN: {
+		auto &join = (PhysicalHashJoin &)*op;
+		if (IsRightOuterJoin(join.join_type)) {
+			// the probe of FULL/RIGHT OUTER joins is not parallelized
+			return false;
+		}
+		return CanCollectInParallel(context, op->children[0].get());
+	}
+	case PhysicalOperatorType::HASH_GROUP_BY: {
+		// the aggregate is only radix partitioned (and scanned in parallel) if all aggregates can be combined
+		auto &hash_aggr = (PhysicalHashAggregate &)*op;
+		return context.db->NumberOfThreads() > 1 && hash_aggr.all_combinable && !hash_aggr.any_distinct;
+	}
+	case PhysicalOperatorType::TABLE_SCAN: {
+		auto &get = (PhysicalTableScan &)*op;
+		if (!get.function.max_threads || !get.function.get_batch_index) {
+			// the scan cannot be parallelized, or the order of the scan cannot be restored
+			return false;
+		}
+		// only collect the result if the scan is large enough to be split up
+		return context.db->NumberOfThreads() > 1 && get.function.max_threads(context, get.bind_data.get()) > 1;
+	}
+	default:
+		return false;
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+class ResultCollectorGlobalState : public GlobalOperatorState {
+public:
+	mutex lock;
+	//! The collected batches with their batch index
+	vector<pair<idx_t, unique_ptr<ChunkCollection>>> batches;
+};
+
+class ResultCollectorLocalState : public LocalSinkState {
+public:
+	//! The batch index of the rows in the collection
+	idx_t batch_index;
+	//! The rows of the current batch
+	unique_ptr<ChunkCollection> collection;
+};
+
+static void FlushBatch(ResultCollectorGlobalState &gstate, ResultCollectorLocalState &lstate) {
+	if (!lstate.collection) {
+		return;
+	}
+	lock_guard<mutex> glock(gstate.lock);
+	gstate.batches.push_back(make_pair(lstate.batch_index, move(lstate.collection)));
+}
+
+unique_ptr<GlobalOperatorState> PhysicalResultCollector::GetGlobalState(ClientContext &context) {
+	return make_unique<ResultCollectorGlobalState>();
+}
+
+unique_ptr<LocalSinkState> PhysicalResultCollector::GetLocalSinkState(ExecutionContext &context) {
+	return make_unique<ResultCollectorLocalState>();
+}
+
+void PhysicalResultCollector::Sink(ExecutionContext &context, GlobalOperatorState &state, LocalSinkState &lstate_p,
+                                   DataChunk &input) {
+	auto &gstate = (ResultCollectorGlobalState &)state;
+	auto &lstate = (ResultCollectorLocalState &)lstate_p;
+	if (lstate.collection && lstate.batch_index != context.task.batch_index) {
+		// the scan moved on to the next batch
+		FlushBatch(gstate, lstate);
+	}
+	if (!lstate.collection) {
+		lstate.batch_index = context.task.batch_index;
+		lstate.collection = make_unique<ChunkCollection>();
+	}
+	lstate.collection->Append(input);
+}
+
+void PhysicalResultCollector::Combine(ExecutionContext &context, GlobalOperatorState &gstate, LocalSinkState &lstate) {
+	FlushBatch((ResultCollectorGlobalState &)gstate, (ResultCollectorLocalState &)lstate);
+}
+
+void PhysicalResultCollector::Finalize(Pipeline &pipeline, ClientContext &context,
+                                       unique_ptr<GlobalOperatorState> state) {
+	auto &gstate = (ResultCollectorGlobalState &)*state;
+	// restore the order of the scan
+	std::stable_sort(gstate.batches.begin(), gstate.batches.end(),
+	                 [](const pair<idx_t, unique_ptr<ChunkCollection>> &a,
+	                    const pair<idx_t, unique_ptr<ChunkCollection>> &b) { return a.first < b.first; });
+	PhysicalSink::Finalize(pipeline, context, move(state));
+}
+
+//===--------------------------------------------------------------------===//
+// GetChunkInternal
+//===--------------------------------------------------------------------===//
+class PhysicalResultCollectorState : public PhysicalOperatorState {
+public:
+	explicit PhysicalResultCollectorState(PhysicalOperator &op)
+	    : PhysicalOperatorState(op, nullptr), batch_idx(0), chunk_idx(0) {
+	}
+
+	idx_t batch_idx;
+	idx_t chunk_idx;
+};
+
+void PhysicalResultCollector::GetChunkInternal(ExecutionContext &context, DataChunk &chunk,
+                                               PhysicalOperatorState *state_p) {
+	auto &state = (PhysicalResultCollectorState &)*state_p;
+	auto &gstate = (ResultCollectorGlobalState &)*this->sink_state;
+	while (state.batch_idx < gstate.batches.size()) {
+		auto &collection = *gstate.batches[state.batch_idx].second;
+		if (state.chunk_idx < collection.ChunkCount()) {
+			chunk.Reference(collection.GetChunk(state.chunk_idx++));
+			return;
+		}
+		// the batch has been returned entirely: release it
+		gstate.batches[state.batch_idx].second.reset();
+		state.batch_idx++;
+		state.chunk_idx = 0;
+	}
+}
+
+unique_ptr<PhysicalOperatorState> PhysicalResultCollector::GetOperatorState() {
+	return make_unique<PhysicalResultCollectorState>(*this);
+}
+
+} // namespace duckdb
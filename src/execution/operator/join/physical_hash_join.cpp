@@ -3,6 +3,10 @@
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/sorted_run.hpp"
+#include "duckdb/execution/executor.hpp"
+#include "duckdb/parallel/pipeline.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/function/aggregate/distributive_functions.hpp"
 
@@ -41,6 +45,9 @@ public:
 	DataChunk build_chunk;
 	DataChunk join_keys;
 	ExpressionExecutor build_executor;
+	//! The thread-local HT the build side is inserted into, merged into the global HT in Combine. Correlated MARK joins
+	//! keep track of the counts per group in the global HT, and insert into the global HT directly.
+	unique_ptr<JoinHashTable> hash_table;
 };
 
 class HashJoinGlobalState : public GlobalOperatorState {
@@ -50,6 +57,8 @@ public:
 
 	//! The HT used by the join
 	unique_ptr<JoinHashTable> hash_table;
+	//! Lock held by the finalize tasks when they finish
+	mutex lock;
 	//! Only used for FULL OUTER JOIN: scan state of the final scan to find unmatched tuples in the build-side
 	JoinHTScanState ht_scan_state;
 };
@@ -112,6 +121,10 @@ unique_ptr<LocalSinkState> PhysicalHashJoin::GetLocalSinkState(ExecutionContext
 		state->build_executor.AddExpression(*cond.right);
 	}
 	state->join_keys.Initialize(condition_types);
+	if (delim_types.empty() || join_type != JoinType::MARK) {
+		state->hash_table = make_unique<JoinHashTable>(BufferManager::GetBufferManager(context.client), conditions,
+		                                               build_types, join_type);
+	}
 	return move(state);
 }
 
@@ -119,6 +132,7 @@ void PhysicalHashJoin::Sink(ExecutionContext &context, GlobalOperatorState &stat
                             DataChunk &input) {
 	auto &sink = (HashJoinGlobalState &)state;
 	auto &lstate = (HashJoinLocalState &)lstate_p;
+	auto &hash_table = lstate.hash_table ? *lstate.hash_table : *sink.hash_table;
 	// resolve the join keys for the right chunk
 	lstate.build_executor.Execute(input, lstate.join_keys);
 	// build the HT
@@ -129,21 +143,92 @@ void PhysicalHashJoin::Sink(ExecutionContext &context, GlobalOperatorState &stat
 		for (idx_t i = 0; i < right_projection_map.size(); i++) {
 			lstate.build_chunk.data[i].Reference(input.data[right_projection_map[i]]);
 		}
-		sink.hash_table->Build(lstate.join_keys, lstate.build_chunk);
+		hash_table.Build(lstate.join_keys, lstate.build_chunk);
 	} else {
 		// there is not a projected map: place the entire right chunk in the HT
-		sink.hash_table->Build(lstate.join_keys, input);
+		hash_table.Build(lstate.join_keys, input);
+	}
+}
+
+void PhysicalHashJoin::Combine(ExecutionContext &context, GlobalOperatorState &state, LocalSinkState &lstate_p) {
+	auto &sink = (HashJoinGlobalState &)state;
+	auto &lstate = (HashJoinLocalState &)lstate_p;
+	if (lstate.hash_table) {
+		sink.hash_table->Merge(*lstate.hash_table);
 	}
 }
 
 //===--------------------------------------------------------------------===//
 // Finalize
 //===--------------------------------------------------------------------===//
+//! The minimum amount of blocks every finalize task inserts into the hash map
+static constexpr idx_t MIN_BLOCKS_PER_FINALIZE_TASK = 4;
+
+//! The HashJoinFinalizeTask inserts a range of the blocks of the HT into the hash map
+class HashJoinFinalizeTask : public Task {
+public:
+	HashJoinFinalizeTask(Pipeline &parent_p, HashJoinGlobalState &state_p, idx_t block_start_p, idx_t block_end_p)
+	    : parent(parent_p), state(state_p), block_start(block_start_p), block_end(block_end_p) {
+	}
+
+	void Execute() override {
+		try {
+			state.hash_table->InsertBlocks(block_start, block_end, true);
+		} catch (std::exception &ex) {
+			parent.executor.PushError(ex.what());
+		} catch (...) {
+			parent.executor.PushError("Unknown exception in hash join finalize!");
+		}
+		lock_guard<mutex> glock(state.lock);
+		parent.finished_tasks++;
+		// finish the whole pipeline
+		if (parent.total_tasks == parent.finished_tasks) {
+			// all blocks have been inserted: the HT can be probed
+			state.hash_table->finalized = true;
+			parent.Finish();
+		}
+	}
+
+private:
+	Pipeline &parent;
+	HashJoinGlobalState &state;
+	idx_t block_start;
+	idx_t block_end;
+};
+
 void PhysicalHashJoin::Finalize(Pipeline &pipeline, ClientContext &context, unique_ptr<GlobalOperatorState> state) {
-	auto &sink = (HashJoinGlobalState &)*state;
-	sink.hash_table->Finalize();
+	this->sink_state = move(state);
+	auto &sink = (HashJoinGlobalState &)*this->sink_state;
+	auto &ht = *sink.hash_table;
 
-	PhysicalSink::Finalize(pipeline, context, move(state));
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	idx_t block_count = ht.BlockCount();
+	idx_t n_tasks = MinValue<idx_t>(scheduler.NumberOfThreads(), block_count / MIN_BLOCKS_PER_FINALIZE_TASK);
+	if (n_tasks <= 1) {
+		// not enough blocks to be worth parallelizing: construct the hash map in this thread
+		ht.Finalize();
+		return;
+	}
+	if (!ht.InitializeHashMap()) {
+		// the HT was partitioned instead
+		return;
+	}
+	// schedule tasks that insert disjoint ranges of blocks into the hash map
+	pipeline.total_tasks += n_tasks;
+	for (idx_t task_idx = 0; task_idx < n_tasks; task_idx++) {
+		idx_t block_start = block_count * task_idx / n_tasks;
+		idx_t block_end = block_count * (task_idx + 1) / n_tasks;
+		auto task = make_unique<HashJoinFinalizeTask>(pipeline, sink, block_start, block_end);
+		scheduler.ScheduleTask(pipeline.token, move(task));
+	}
+}
+
+bool PhysicalHashJoin::IsPartitioned() {
+	if (!sink_state) {
+		return false;
+	}
+	auto &sink = (HashJoinGlobalState &)*sink_state;
+	return sink.hash_table->IsPartitioned();
 }
 
 //===--------------------------------------------------------------------===//
@@ -153,13 +238,22 @@ class PhysicalHashJoinState : public PhysicalOperatorState {
 public:
 	PhysicalHashJoinState(PhysicalOperator &op, PhysicalOperator *left, PhysicalOperator *right,
 	                      vector<JoinCondition> &conditions)
-	    : PhysicalOperatorState(op, left) {
+	    : PhysicalOperatorState(op, left), partition_idx(0) {
 	}
 
 	DataChunk cached_chunk;
 	DataChunk join_keys;
 	ExpressionExecutor probe_executor;
 	unique_ptr<JoinHashTable::ScanStructure> scan_structure;
+
+	//! Partitioned HT only: the probe rows of every partition that is not in memory while the probe side is scanned
+	vector<unique_ptr<SortedRun>> partition_runs;
+	//! Partitioned HT only: the partition that is currently probed
+	idx_t partition_idx;
+	//! Partitioned HT only: the scanner over the buffered probe rows of the current partition
+	unique_ptr<SortedRunScanner> partition_scanner;
+	//! Partitioned HT only: chunk used to buffer the probe rows of a partition
+	DataChunk partition_chunk;
 };
 
 unique_ptr<PhysicalOperatorState> PhysicalHashJoin::GetOperatorState() {
@@ -235,6 +329,16 @@ void PhysicalHashJoin::ProbeHashTable(ExecutionContext &context, DataChunk &chun
 
 	// probe the HT
 	do {
+		if (sink.hash_table->IsPartitioned()) {
+			// partitioned HT: fetch the next chunk of probe rows together with the partition they have to probe
+			auto partition = FetchPartitionedChunk(context, *state);
+			if (!partition) {
+				return;
+			}
+			state->scan_structure = partition->Probe(state->join_keys);
+			state->scan_structure->Next(state->join_keys, state->child_chunk, chunk);
+			continue;
+		}
 		// fetch the chunk from the left side
 		children[0]->GetChunk(context, state->child_chunk, state->child_state.get());
 		if (state->child_chunk.size() == 0) {
@@ -253,4 +357,91 @@ void PhysicalHashJoin::ProbeHashTable(ExecutionContext &context, DataChunk &chun
 	} while (chunk.size() == 0);
 }
 
+JoinHashTable *PhysicalHashJoin::FetchPartitionedChunk(ExecutionContext &context, PhysicalHashJoinState &state) {
+	auto &sink = (HashJoinGlobalState &)*sink_state;
+	auto &ht = *sink.hash_table;
+	auto partition_count = ht.PartitionCount();
+	if (state.partition_idx == 0) {
+		// first phase: scan the probe side
+		// the probe rows of partition 0 are probed right away, the other rows are buffered until the scan is done
+		if (state.partition_runs.empty()) {
+			auto &buffer_manager = ht.buffer_manager;
+			state.partition_runs.resize(partition_count);
+			for (idx_t i = 1; i < partition_count; i++) {
+				state.partition_runs[i] = make_unique<SortedRun>(buffer_manager, children[0]->types, 0);
+			}
+			state.partition_chunk.InitializeEmpty(children[0]->types);
+		}
+		idx_t partition_indices[STANDARD_VECTOR_SIZE];
+		vector<idx_t> partition_offsets(partition_count + 1);
+		SelectionVector partition_sel(STANDARD_VECTOR_SIZE);
+		while (true) {
+			children[0]->GetChunk(context, state.child_chunk, state.child_state.get());
+			if (state.child_chunk.size() == 0) {
+				break;
+			}
+			state.join_keys.Reset();
+			state.probe_executor.Execute(state.child_chunk, state.join_keys);
+			ht.ComputePartitions(state.join_keys, partition_indices);
+
+			// order the rows by their partition
+			std::fill(partition_offsets.begin(), partition_offsets.end(), 0);
+			for (idx_t i = 0; i < state.child_chunk.size(); i++) {
+				partition_offsets[partition_indices[i] + 1]++;
+			}
+			for (idx_t i = 1; i <= partition_count; i++) {
+				partition_offsets[i] += partition_offsets[i - 1];
+			}
+			for (idx_t i = 0; i < state.child_chunk.size(); i++) {
+				partition_sel.set_index(partition_offsets[partition_indices[i]]++, i);
+			}
+			// buffer the rows of the other partitions
+			idx_t start = partition_offsets[0];
+			for (idx_t i = 1; i < partition_count; i++) {
+				idx_t end = partition_offsets[i];
+				if (end > start) {
+					SelectionVector sel(partition_sel.data() + start);
+					state.partition_chunk.Slice(state.child_chunk, sel, end - start);
+					state.partition_runs[i]->Append(state.partition_chunk);
+				}
+				start = end;
+			}
+			idx_t resident_count = partition_offsets[0];
+			if (resident_count > 0) {
+				// probe the rows of partition 0
+				state.child_chunk.Slice(partition_sel, resident_count);
+				state.join_keys.Slice(partition_sel, resident_count);
+				return &ht.GetPartition(0);
+			}
+		}
+		// the probe side has been scanned: move on to the buffered rows of the other partitions
+		ht.ReleasePartition(0);
+		state.partition_idx++;
+	}
+	// second phase: probe the partitions one at a time
+	while (state.partition_idx < partition_count) {
+		auto &run = state.partition_runs[state.partition_idx];
+		if (!state.partition_scanner) {
+			run->Finalize();
+			if (run->count > 0) {
+				ht.FinalizePartition(state.partition_idx);
+				state.partition_scanner = make_unique<SortedRunScanner>(*run, 0, run->count);
+			}
+		}
+		if (state.partition_scanner && !state.partition_scanner->Done()) {
+			state.child_chunk.Reset();
+			state.partition_scanner->Scan(state.child_chunk, 0);
+			state.join_keys.Reset();
+			state.probe_executor.Execute(state.child_chunk, state.join_keys);
+			return &ht.GetPartition(state.partition_idx);
+		}
+		// all probe rows of this partition have been processed
+		state.partition_scanner.reset();
+		run.reset();
+		ht.ReleasePartition(state.partition_idx);
+		state.partition_idx++;
+	}
+	return nullptr;
+}
+
 } // namespace duckdb
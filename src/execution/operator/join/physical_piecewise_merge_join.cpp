@@ -4,6 +4,7 @@
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/execution/merge_join.hpp"
 #include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/types/sort_keys.hpp"
 
 namespace duckdb {
 
@@ -400,6 +401,23 @@ static void TemplatedQuicksort(VectorData &vdata, const SelectionVector &not_nul
 	TemplatedQuicksort<T, duckdb::LessThanEquals>((T *)vdata.data, *vdata.sel, not_null_sel, not_null_count, result);
 }
 
+static void RadixOrderVector(Vector &input, idx_t count, MergeOrder &order) {
+	// radix sort the normalized keys, NULL values are placed at the end and ignored
+	vector<LogicalType> key_types {input.type};
+	DataChunk keys;
+	keys.InitializeEmpty(key_types);
+	keys.data[0].Reference(input);
+	keys.SetCardinality(count);
+
+	SortKeys sort_keys(key_types, {OrderType::ASCENDING}, {OrderByNullType::NULLS_LAST});
+	sort_keys.Append(keys);
+	idx_t sorted[STANDARD_VECTOR_SIZE];
+	sort_keys.Sort(sorted);
+	for (idx_t i = 0; i < order.count; i++) {
+		order.order.set_index(i, sorted[i]);
+	}
+}
+
 void OrderVector(Vector &vector, idx_t count, MergeOrder &order) {
 	if (count == 0) {
 		order.count = 0;
@@ -420,6 +438,10 @@ void OrderVector(Vector &vector, idx_t count, MergeOrder &order) {
 
 	order.count = not_null_count;
 	order.order.Initialize(STANDARD_VECTOR_SIZE);
+	if (SortKeys::CanEncode({vector.type})) {
+		RadixOrderVector(vector, count, order);
+		return;
+	}
 	switch (vector.type.InternalType()) {
 	case PhysicalType::BOOL:
 	case PhysicalType::INT8:
@@ -3,7 +3,12 @@
 #include "duckdb/common/assert.hpp"
 #include "duckdb/common/value_operations/value_operations.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/executor.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/sorted_run.hpp"
+#include "duckdb/parallel/pipeline.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/data_table.hpp"
 
 namespace duckdb {
@@ -11,10 +16,12 @@ namespace duckdb {
 class PhysicalOrderOperatorState : public PhysicalOperatorState {
 public:
 	PhysicalOrderOperatorState(PhysicalOperator &op, PhysicalOperator *child)
-	    : PhysicalOperatorState(op, child), position(0) {
+	    : PhysicalOperatorState(op, child), run_idx(0) {
 	}
 
-	idx_t position;
+	//! The run that is currently being scanned
+	idx_t run_idx;
+	unique_ptr<SortedRunScanner> scanner;
 };
 
 //===--------------------------------------------------------------------===//
@@ -22,63 +29,264 @@ public:
 //===--------------------------------------------------------------------===//
 class OrderByGlobalOperatorState : public GlobalOperatorState {
 public:
-	//! The lock for updating the global aggregate state
+	explicit OrderByGlobalOperatorState(BufferManager &buffer_manager)
+	    : buffer_manager(buffer_manager), max_fan_in(0), merge_failed(false) {
+	}
+
+	BufferManager &buffer_manager;
+	//! The lock for updating the global sort state
 	mutex lock;
-	//! The sorted data
-	ChunkCollection sorted_data;
-	//! The sorted vector
-	unique_ptr<idx_t[]> sorted_vector;
+	//! The sorted runs; after Finalize the concatenation of these runs is the sorted result
+	vector<unique_ptr<SortedRun>> runs;
+	//! The runs produced by the current merge round: either longer runs made from groups of runs, or the partitions
+	//! of the result
+	vector<unique_ptr<SortedRun>> merged_runs;
+	//! The boundaries of the partitions in each of the runs (empty if the current merge round merges groups of runs)
+	vector<vector<idx_t>> boundaries;
+	//! The maximum amount of runs that a single task merges at once. Every run that is merged has one deserialized
+	//! block in memory, so this bounds the memory used by the merge.
+	idx_t max_fan_in;
+	//! Whether or not any of the merge tasks failed
+	bool merge_failed;
+};
+
+class OrderByLocalState : public LocalSinkState {
+public:
+	OrderByLocalState(ClientContext &context, vector<BoundOrderByNode> &orders, vector<LogicalType> &payload_types) {
+		vector<LogicalType> key_types;
+		idx_t row_width = 0;
+		for (auto &order : orders) {
+			key_types.push_back(order.expression->return_type);
+			row_width += GetTypeIdSize(order.expression->return_type.InternalType());
+			executor.AddExpression(*order.expression);
+		}
+		for (auto &type : payload_types) {
+			row_width += GetTypeIdSize(type.InternalType());
+		}
+		key_chunk.Initialize(key_types);
+		// every thread buffers at most a fraction of the memory limit before sorting it into a run
+		auto &buffer_manager = BufferManager::GetBufferManager(context);
+		idx_t threads = TaskScheduler::GetScheduler(context).NumberOfThreads();
+		run_size = MaxValue<idx_t>(STANDARD_VECTOR_SIZE,
+		                           buffer_manager.GetMaxMemory() / (4 * MaxValue<idx_t>(threads, 1) * row_width));
+	}
+
+	//! Executor for the sort keys
+	ExpressionExecutor executor;
+	DataChunk key_chunk;
+	//! The sort keys and payload of the rows that are not yet part of a run
+	ChunkCollection keys;
+	ChunkCollection payload;
+	//! The amount of rows after which the buffered rows are sorted into a run
+	idx_t run_size;
 };
 
 unique_ptr<GlobalOperatorState> PhysicalOrder::GetGlobalState(ClientContext &context) {
-	return make_unique<OrderByGlobalOperatorState>();
+	return make_unique<OrderByGlobalOperatorState>(BufferManager::GetBufferManager(context));
+}
+
+unique_ptr<LocalSinkState> PhysicalOrder::GetLocalSinkState(ExecutionContext &context) {
+	return make_unique<OrderByLocalState>(context.client, orders, types);
 }
 
-void PhysicalOrder::Sink(ExecutionContext &context, GlobalOperatorState &state, LocalSinkState &lstate,
+void PhysicalOrder::SortLocalRun(OrderByGlobalOperatorState &gstate, OrderByLocalState &lstate) {
+	auto &keys = lstate.keys;
+	auto &payload = lstate.payload;
+	if (keys.Count() == 0) {
+		return;
+	}
+	vector<OrderType> order_types;
+	vector<OrderByNullType> null_order_types;
+	GetOrderTypes(order_types, null_order_types);
+
+	// sort the buffered rows
+	auto sorted_vector = unique_ptr<idx_t[]>(new idx_t[keys.Count()]);
+	keys.Sort(order_types, null_order_types, sorted_vector.get());
+
+	// now write them to a sorted run
+	auto run_types = keys.Types();
+	run_types.insert(run_types.end(), types.begin(), types.end());
+	auto run = make_unique<SortedRun>(gstate.buffer_manager, run_types, orders.size());
+
+	DataChunk key_chunk, payload_chunk, run_chunk;
+	key_chunk.Initialize(keys.Types());
+	payload_chunk.Initialize(types);
+	run_chunk.InitializeEmpty(run_types);
+	for (idx_t offset = 0; offset < keys.Count(); offset += STANDARD_VECTOR_SIZE) {
+		key_chunk.Reset();
+		payload_chunk.Reset();
+		keys.MaterializeSortedChunk(key_chunk, sorted_vector.get(), offset);
+		payload.MaterializeSortedChunk(payload_chunk, sorted_vector.get(), offset);
+		for (idx_t col_idx = 0; col_idx < key_chunk.ColumnCount(); col_idx++) {
+			run_chunk.data[col_idx].Reference(key_chunk.data[col_idx]);
+		}
+		for (idx_t col_idx = 0; col_idx < payload_chunk.ColumnCount(); col_idx++) {
+			run_chunk.data[key_chunk.ColumnCount() + col_idx].Reference(payload_chunk.data[col_idx]);
+		}
+		run_chunk.SetCardinality(key_chunk);
+		run->Append(run_chunk);
+	}
+	run->Finalize();
+	keys.Reset();
+	payload.Reset();
+
+	lock_guard<mutex> glock(gstate.lock);
+	gstate.runs.push_back(move(run));
+}
+
+void PhysicalOrder::Sink(ExecutionContext &context, GlobalOperatorState &state, LocalSinkState &lstate_p,
                          DataChunk &input) {
-	// concatenate all the data of the child chunks
 	auto &gstate = (OrderByGlobalOperatorState &)state;
-	lock_guard<mutex> glock(gstate.lock);
-	gstate.sorted_data.Append(input);
+	auto &lstate = (OrderByLocalState &)lstate_p;
+
+	// compute the sort keys and buffer them together with the payload in the thread-local state
+	lstate.key_chunk.Reset();
+	lstate.executor.Execute(input, lstate.key_chunk);
+	lstate.keys.Append(lstate.key_chunk);
+	lstate.payload.Append(input);
+	if (lstate.payload.Count() >= lstate.run_size) {
+		// the local buffer is full: sort it into a run that can be offloaded to disk
+		SortLocalRun(gstate, lstate);
+	}
+}
+
+void PhysicalOrder::Combine(ExecutionContext &context, GlobalOperatorState &state, LocalSinkState &lstate) {
+	SortLocalRun((OrderByGlobalOperatorState &)state, (OrderByLocalState &)lstate);
 }
 
 //===--------------------------------------------------------------------===//
 // Finalize
 //===--------------------------------------------------------------------===//
-void PhysicalOrder::Finalize(Pipeline &pipeline, ClientContext &context, unique_ptr<GlobalOperatorState> state) {
-	// finalize: perform the actual sorting
-	auto &sink = (OrderByGlobalOperatorState &)*state;
-	ChunkCollection &big_data = sink.sorted_data;
+void PhysicalOrder::GetOrderTypes(vector<OrderType> &order_types, vector<OrderByNullType> &null_order_types) {
+	for (auto &order : orders) {
+		order_types.push_back(order.type);
+		null_order_types.push_back(order.null_order);
+	}
+}
 
-	// compute the sorting columns from the input data
-	ExpressionExecutor executor;
-	vector<LogicalType> sort_types;
+void PhysicalOrder::MergePartition(OrderByGlobalOperatorState &gstate, idx_t partition) {
 	vector<OrderType> order_types;
 	vector<OrderByNullType> null_order_types;
-	for (idx_t i = 0; i < orders.size(); i++) {
-		auto &expr = orders[i].expression;
-		sort_types.push_back(expr->return_type);
-		order_types.push_back(orders[i].type);
-		null_order_types.push_back(orders[i].null_order);
-		executor.AddExpression(*expr);
+	GetOrderTypes(order_types, null_order_types);
+
+	vector<unique_ptr<SortedRunScanner>> scanners;
+	if (gstate.boundaries.empty()) {
+		// merge a group of consecutive runs into a single run
+		idx_t group_start = partition * gstate.max_fan_in;
+		idx_t group_end = MinValue<idx_t>(group_start + gstate.max_fan_in, gstate.runs.size());
+		for (idx_t run_idx = group_start; run_idx < group_end; run_idx++) {
+			auto &run = *gstate.runs[run_idx];
+			scanners.push_back(make_unique<SortedRunScanner>(run, 0, run.count));
+		}
+	} else {
+		// merge a key range of all of the runs
+		auto &start = gstate.boundaries[partition];
+		auto &end = gstate.boundaries[partition + 1];
+		for (idx_t run_idx = 0; run_idx < gstate.runs.size(); run_idx++) {
+			scanners.push_back(make_unique<SortedRunScanner>(*gstate.runs[run_idx], start[run_idx], end[run_idx]));
+		}
 	}
+	auto &first_run = *gstate.runs[0];
+	auto result = make_unique<SortedRun>(gstate.buffer_manager, first_run.types, first_run.key_count);
+	SortedRunMerger merger(move(scanners), order_types, null_order_types);
+	merger.Merge(*result);
+	gstate.merged_runs[partition] = move(result);
+}
 
-	ChunkCollection sort_collection;
-	for (idx_t i = 0; i < big_data.ChunkCount(); i++) {
-		DataChunk sort_chunk;
-		sort_chunk.Initialize(sort_types);
+// this task is run in multiple threads and merges one partition (or one group) of the sorted runs
+class PhysicalOrderMergeTask : public Task {
+public:
+	PhysicalOrderMergeTask(Pipeline &parent_p, PhysicalOrder &op_p, OrderByGlobalOperatorState &state_p,
+	                       idx_t partition_p)
+	    : parent(parent_p), op(op_p), state(state_p), partition(partition_p) {
+	}
 
-		executor.Execute(big_data.GetChunk(i), sort_chunk);
-		sort_collection.Append(sort_chunk);
+	void Execute() override {
+		bool failed = true;
+		try {
+			op.MergePartition(state, partition);
+			failed = false;
+		} catch (std::exception &ex) {
+			parent.executor.PushError(ex.what());
+		} catch (...) {
+			parent.executor.PushError("Unknown exception in ORDER BY merge!");
+		}
+		lock_guard<mutex> glock(state.lock);
+		state.merge_failed = state.merge_failed || failed;
+		parent.finished_tasks++;
+		if (parent.total_tasks != parent.finished_tasks) {
+			return;
+		}
+		// all tasks of this round are finished: the merged runs replace the original runs
+		bool final_round = !state.boundaries.empty();
+		state.runs = move(state.merged_runs);
+		if (!final_round && !state.merge_failed) {
+			// the groups of runs have been merged into longer runs: start the next round
+			try {
+				if (op.ScheduleMergeTasks(parent, parent.executor.context, state)) {
+					return;
+				}
+			} catch (std::exception &ex) {
+				parent.executor.PushError(ex.what());
+			} catch (...) {
+				parent.executor.PushError("Unknown exception in ORDER BY merge!");
+			}
+		}
+		// finish the whole pipeline
+		parent.Finish();
 	}
 
-	D_ASSERT(sort_collection.Count() == big_data.Count());
+private:
+	Pipeline &parent;
+	PhysicalOrder &op;
+	OrderByGlobalOperatorState &state;
+	idx_t partition;
+};
 
-	// now perform the actual sort
-	sink.sorted_vector = unique_ptr<idx_t[]>(new idx_t[sort_collection.Count()]);
-	sort_collection.Sort(order_types, null_order_types, sink.sorted_vector.get());
+bool PhysicalOrder::ScheduleMergeTasks(Pipeline &pipeline, ClientContext &context, OrderByGlobalOperatorState &sink) {
+	idx_t n_tasks;
+	if (sink.runs.size() > sink.max_fan_in) {
+		// there are too many runs to merge at once: merge groups of runs into longer runs first
+		sink.boundaries.clear();
+		n_tasks = (sink.runs.size() + sink.max_fan_in - 1) / sink.max_fan_in;
+	} else {
+		// split the runs into key ranges that can be merged independently
+		vector<OrderType> order_types;
+		vector<OrderByNullType> null_order_types;
+		GetOrderTypes(order_types, null_order_types);
+		idx_t n_partitions = TaskScheduler::GetScheduler(context).NumberOfThreads();
+		sink.boundaries = PartitionSortedRuns(sink.runs, n_partitions, order_types, null_order_types);
+		n_tasks = sink.boundaries.size() - 1;
+	}
+	sink.merged_runs.resize(n_tasks);
+	if (n_tasks == 1) {
+		D_ASSERT(!sink.boundaries.empty());
+		MergePartition(sink, 0);
+		sink.runs = move(sink.merged_runs);
+		return false;
+	}
+	// schedule additional tasks to merge the partitions (or groups) in parallel
+	pipeline.total_tasks += n_tasks;
+	for (idx_t partition = 0; partition < n_tasks; partition++) {
+		auto new_task = make_unique<PhysicalOrderMergeTask>(pipeline, *this, sink, partition);
+		TaskScheduler::GetScheduler(context).ScheduleTask(pipeline.token, move(new_task));
+	}
+	return true;
+}
 
-	PhysicalSink::Finalize(pipeline, context, move(state));
+void PhysicalOrder::Finalize(Pipeline &pipeline, ClientContext &context, unique_ptr<GlobalOperatorState> state) {
+	this->sink_state = move(state);
+	auto &sink = (OrderByGlobalOperatorState &)*this->sink_state;
+	if (sink.runs.size() <= 1) {
+		// zero or one run: the data is already sorted
+		return;
+	}
+	// every merging thread gets the same fraction of the memory limit as a thread that sorts its input into runs,
+	// which holds one deserialized block per run it merges and one block of the run it produces
+	idx_t threads = MaxValue<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads(), 1);
+	idx_t blocks_per_thread = sink.buffer_manager.GetMaxMemory() / (4 * threads * Storage::BLOCK_ALLOC_SIZE);
+	sink.max_fan_in = MaxValue<idx_t>(2, blocks_per_thread > 0 ? blocks_per_thread - 1 : 0);
+	ScheduleMergeTasks(pipeline, context, sink);
 }
 
 //===--------------------------------------------------------------------===//
@@ -87,13 +295,19 @@ void PhysicalOrder::Finalize(Pipeline &pipeline, ClientContext &context, unique_
 void PhysicalOrder::GetChunkInternal(ExecutionContext &context, DataChunk &chunk, PhysicalOperatorState *state_p) {
 	auto state = reinterpret_cast<PhysicalOrderOperatorState *>(state_p);
 	auto &sink = (OrderByGlobalOperatorState &)*this->sink_state;
-	ChunkCollection &big_data = sink.sorted_data;
-	if (state->position >= big_data.Count()) {
-		return;
+	while (state->run_idx < sink.runs.size()) {
+		auto &run = *sink.runs[state->run_idx];
+		if (!state->scanner) {
+			state->scanner = make_unique<SortedRunScanner>(run, 0, run.count);
+		}
+		state->scanner->Scan(chunk, run.key_count);
+		if (chunk.size() > 0) {
+			return;
+		}
+		// this run is exhausted: move to the next one
+		state->scanner.reset();
+		state->run_idx++;
 	}
-
-	big_data.MaterializeSortedChunk(chunk, sink.sorted_vector.get(), state->position);
-	state->position += STANDARD_VECTOR_SIZE;
 }
 
 unique_ptr<PhysicalOperatorState> PhysicalOrder::GetOperatorState() {
@@ -1,6 +1,7 @@
 #include "duckdb/execution/operator/persistent/buffered_csv_reader.hpp"
 
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/file_handle_stream.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/gzip_stream.hpp"
 #include "duckdb/common/string_util.hpp"
@@ -17,7 +18,10 @@
 #include <algorithm>
 #include <cctype>
 #include <cstring>
-#include <fstream>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 namespace duckdb {
 
@@ -26,6 +30,32 @@ static string GetLineNumberStr(idx_t linenr, bool linenr_estimated) {
 	return to_string(linenr + 1) + estimated;
 }
 
+//! Returns the position of the first character in buffer[position, end) that is equal to c1, c2 or c3, or end if there
+//! is no such character. With SSE2 the buffer is searched 16 bytes at a time.
+static inline idx_t FindSpecialCharacter(const char *buffer, idx_t position, idx_t end, char c1, char c2, char c3) {
+#if defined(__SSE2__)
+	auto search1 = _mm_set1_epi8(c1);
+	auto search2 = _mm_set1_epi8(c2);
+	auto search3 = _mm_set1_epi8(c3);
+	for (; position + 16 <= end; position += 16) {
+		auto data = _mm_loadu_si128((const __m128i *)(buffer + position));
+		auto matches = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(data, search1), _mm_cmpeq_epi8(data, search2)),
+		                            _mm_cmpeq_epi8(data, search3));
+		auto mask = (uint32_t)_mm_movemask_epi8(matches);
+		if (mask) {
+			return position + __builtin_ctz(mask);
+		}
+	}
+#endif
+	for (; position < end; position++) {
+		auto c = buffer[position];
+		if (c == c1 || c == c2 || c == c3) {
+			break;
+		}
+	}
+	return position;
+}
+
 static bool StartsWithNumericDate(string &separator, const string_t &value) {
 	auto begin = value.GetDataUnsafe();
 	auto end = begin + value.GetSize();
@@ -91,6 +121,13 @@ string GenerateDateFormat(const string &separator, const char *format_template)
 	return format_specifier;
 }
 
+bool BufferedCSVReaderOptions::IsGzipCompressed(const string &path) const {
+	if (compression == "infer") {
+		return StringUtil::EndsWith(StringUtil::Lower(path), ".gz");
+	}
+	return compression == "gzip";
+}
+
 TextSearchShiftArray::TextSearchShiftArray() {
 }
 
@@ -135,8 +172,25 @@ BufferedCSVReader::BufferedCSVReader(BufferedCSVReaderOptions options_p, const v
 	Initialize(requested_types);
 }
 
+BufferedCSVReader::BufferedCSVReader(ClientContext &context, BufferedCSVReaderOptions options_p,
+                                     const vector<LogicalType> &requested_types, idx_t range_start_p,
+                                     idx_t range_end_p, bool range_start_in_quotes_p)
+    : options(move(options_p)), buffer_size(0), position(0), start(0), range_start(range_start_p),
+      range_end(range_end_p), range_start_in_quotes(range_start_in_quotes_p) {
+	source = OpenCSV(context, options);
+	if (!plain_file_source) {
+		throw InternalException("Byte ranges can only be read from uncompressed CSV files");
+	}
+	Initialize(requested_types);
+}
+
 void BufferedCSVReader::Initialize(const vector<LogicalType> &requested_types) {
-	if (options.auto_detect) {
+	if (range_start != INVALID_INDEX) {
+		// the dialect and types of a byte range have been detected beforehand
+		D_ASSERT(!options.auto_detect);
+		sql_types = requested_types;
+		JumpToRangeStart();
+	} else if (options.auto_detect) {
 		sql_types = SniffCSV(requested_types);
 		if (cached_chunks.empty()) {
 			JumpToBeginning(options.skip_rows, options.header);
@@ -157,34 +211,21 @@ void BufferedCSVReader::PrepareComplexParser() {
 }
 
 unique_ptr<std::istream> BufferedCSVReader::OpenCSV(ClientContext &context, const BufferedCSVReaderOptions &options) {
-	if (!FileSystem::GetFileSystem(context).FileExists(options.file_path)) {
+	file_system = &FileSystem::GetFileSystem(context);
+	if (!file_system->FileExists(options.file_path)) {
 		throw IOException("File \"%s\" not found", options.file_path.c_str());
 	}
 	unique_ptr<std::istream> result;
 
-	gzip_compressed = false;
-	if (options.compression == "infer") {
-		if (StringUtil::EndsWith(StringUtil::Lower(options.file_path), ".gz")) {
-			gzip_compressed = true;
-		}
-	} else if (options.compression == "gzip") {
-		gzip_compressed = true;
-	}
-
+	gzip_compressed = options.IsGzipCompressed(options.file_path);
 	if (gzip_compressed) {
-		result = make_unique<GzipStream>(options.file_path);
+		result = make_unique<GzipStream>(*file_system, options.file_path);
 		plain_file_source = false;
 	} else {
-		auto csv_local = make_unique<std::ifstream>();
-		csv_local->open(options.file_path);
+		auto csv_local = make_unique<FileHandleStream>(*file_system, options.file_path);
+		file_size = csv_local->GetFileSize();
 		result = move(csv_local);
-
-		// determine filesize
 		plain_file_source = true;
-		result->seekg(0, result->end);
-		file_size = (idx_t)result->tellg();
-		result->clear();
-		result->seekg(0, result->beg);
 	}
 	return result;
 }
@@ -195,6 +236,7 @@ void BufferedCSVReader::SkipRowsAndReadHeader(idx_t skip_rows, bool skip_header)
 		string read_line;
 		getline(*source, read_line);
 		linenr++;
+		buffer_offset += read_line.size() + 1;
 	}
 
 	if (skip_header) {
@@ -218,6 +260,7 @@ void BufferedCSVReader::ResetBuffer() {
 	buffer_size = 0;
 	position = 0;
 	start = 0;
+	buffer_offset = 0;
 	cached_buffers.clear();
 }
 
@@ -225,7 +268,8 @@ void BufferedCSVReader::ResetStream() {
 	if (!plain_file_source && gzip_compressed) {
 		// seeking to the beginning appears to not be supported in all compiler/os-scenarios,
 		// so we have to create a new stream source here for now
-		source = make_unique<GzipStream>(options.file_path);
+		D_ASSERT(file_system);
+		source = make_unique<GzipStream>(*file_system, options.file_path);
 	} else {
 		source->clear();
 		source->seekg(0, source->beg);
@@ -259,6 +303,51 @@ void BufferedCSVReader::JumpToBeginning(idx_t skip_rows = 0, bool skip_header =
 	sample_chunk_idx = 0;
 }
 
+void BufferedCSVReader::JumpToRangeStart() {
+	ResetBuffer();
+	ResetStream();
+	if (range_start == 0) {
+		SkipRowsAndReadHeader(options.skip_rows, options.header);
+	} else {
+		// skip ahead to the first row that starts within the range: the row that is cut off by the start of the
+		// range is read by the reader of the previous range. Newlines within quoted values do not end a row: the
+		// quote state at the start of the range is known, and every quote we pass opens or closes a quoted value
+		// (should the rows of adjacent ranges still not line up, the range is read again by ReadCSVStartRange)
+		source->seekg(range_start - 1);
+		buffer_offset = range_start - 1;
+		int quote = options.quote.empty() ? EOF : (unsigned char)options.quote[0];
+		bool in_quotes = range_start_in_quotes;
+		if (source->peek() == quote) {
+			// the byte before the range is a quote: the state before it is the opposite of the state after it
+			in_quotes = !in_quotes;
+		}
+		int c;
+		while ((c = source->get()) != EOF) {
+			buffer_offset++;
+			if (c == quote) {
+				in_quotes = !in_quotes;
+				continue;
+			}
+			if (in_quotes) {
+				continue;
+			}
+			if (c == '\n') {
+				break;
+			}
+			if (c == '\r') {
+				if (source->peek() == '\n') {
+					source->get();
+					buffer_offset++;
+				}
+				break;
+			}
+		}
+		// we do not know how many lines precede the range
+		linenr_estimated = true;
+	}
+	range_first_row = GetCurrentOffset();
+}
+
 bool BufferedCSVReader::JumpToNextSample() {
 	// get bytes contained in the previously read chunk
 	idx_t remaining_bytes_in_buffer = buffer_size - start;
@@ -843,6 +932,11 @@ value_start:
 	/* state: value_start */
 	// this state parses the first characters of a value
 	offset = 0;
+	if (ReachedRangeEnd(column)) {
+		// the remaining rows are read by the reader of the next byte range
+		start = position;
+		goto final_state;
+	}
 	delimiter_pos = 0;
 	quote_pos = 0;
 	do {
@@ -1061,6 +1155,11 @@ void BufferedCSVReader::ParseSimpleCSV(DataChunk &insert_chunk) {
 	goto value_start;
 value_start:
 	offset = 0;
+	if (ReachedRangeEnd(column)) {
+		// the remaining rows are read by the reader of the next byte range
+		start = position;
+		goto final_state;
+	}
 	/* state: value_start */
 	// this state parses the first character of a value
 	if (buffer[position] == options.quote[0]) {
@@ -1077,11 +1176,13 @@ normal:
 	/* state: normal parsing state */
 	// this state parses the remainder of a non-quoted value until we reach a delimiter or newline
 	do {
-		for (; position < buffer_size; position++) {
+		// skip ahead to the first delimiter or newline
+		position = FindSpecialCharacter(buffer.get(), position, buffer_size, options.delimiter[0], '\n', '\r');
+		if (position < buffer_size) {
 			if (buffer[position] == options.delimiter[0]) {
 				// delimiter: end the value and add it to the chunk
 				goto add_value;
-			} else if (StringUtil::CharacterIsNewline(buffer[position])) {
+			} else {
 				// newline: add row
 				goto add_row;
 			}
@@ -1127,7 +1228,10 @@ in_quotes:
 	// this state parses the remainder of a quoted value
 	position++;
 	do {
-		for (; position < buffer_size; position++) {
+		// skip ahead to the first quote or escape character
+		position = FindSpecialCharacter(buffer.get(), position, buffer_size, options.quote[0], options.escape[0],
+		                                options.quote[0]);
+		if (position < buffer_size) {
 			if (buffer[position] == options.quote[0]) {
 				// quote: move to unquoted state
 				goto unquote;
@@ -1223,17 +1327,28 @@ final_state:
 
 bool BufferedCSVReader::ReadBuffer(idx_t &start) {
 	auto old_buffer = move(buffer);
+	auto old_buffer_capacity = buffer_capacity;
+	// the remaining part of the last buffer moves to the front of the new buffer
+	buffer_offset += start;
 
 	// the remaining part of the last buffer
 	idx_t remaining = buffer_size - start;
-	idx_t buffer_read_size = INITIAL_BUFFER_SIZE;
+	// while sniffing we read small blocks, so that the samples stay small
+	idx_t buffer_read_size = mode == ParserMode::PARSING ? PARSING_BUFFER_SIZE : INITIAL_BUFFER_SIZE;
 	while (remaining > buffer_read_size) {
 		buffer_read_size *= 2;
 	}
 	if (remaining + buffer_read_size > MAXIMUM_CSV_LINE_SIZE) {
 		throw InvalidInputException("Maximum line size of %llu bytes exceeded!", MAXIMUM_CSV_LINE_SIZE);
 	}
-	buffer = unique_ptr<char[]>(new char[buffer_read_size + remaining + 1]);
+	if (spare_buffer && spare_buffer_capacity >= buffer_read_size + remaining + 1) {
+		// reuse a buffer that is no longer referenced
+		buffer = move(spare_buffer);
+		buffer_capacity = spare_buffer_capacity;
+	} else {
+		buffer_capacity = buffer_read_size + remaining + 1;
+		buffer = unique_ptr<char[]>(new char[buffer_capacity]);
+	}
 	buffer_size = remaining + buffer_read_size;
 	if (remaining > 0) {
 		// remaining from last buffer: copy it here
@@ -1247,6 +1362,7 @@ bool BufferedCSVReader::ReadBuffer(idx_t &start) {
 	buffer[buffer_size] = '\0';
 	if (old_buffer) {
 		cached_buffers.push_back(move(old_buffer));
+		cached_buffer_capacity = old_buffer_capacity;
 	}
 	start = 0;
 	position = remaining;
@@ -1257,6 +1373,11 @@ bool BufferedCSVReader::ReadBuffer(idx_t &start) {
 void BufferedCSVReader::ParseCSV(DataChunk &insert_chunk) {
 	// if no auto-detect or auto-detect with jumping samples, we have nothing cached and start from the beginning
 	if (cached_chunks.empty()) {
+		// the values of the previous chunk are no longer referenced: the most recent buffer can be reused
+		if (!cached_buffers.empty()) {
+			spare_buffer = move(cached_buffers.back());
+			spare_buffer_capacity = cached_buffer_capacity;
+		}
 		cached_buffers.clear();
 	} else {
 		auto &chunk = cached_chunks.front();
@@ -1,7 +1,9 @@
 #include "duckdb/execution/operator/persistent/physical_copy_to_file.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/parallel/task_context.hpp"
 
 #include <algorithm>
+#include <atomic>
 
 namespace duckdb {
 
@@ -11,7 +13,7 @@ public:
 	    : rows_copied(0), global_state(move(global_state)) {
 	}
 
-	idx_t rows_copied;
+	std::atomic<idx_t> rows_copied;
 	unique_ptr<GlobalFunctionData> global_state;
 };
 
@@ -37,6 +39,7 @@ void PhysicalCopyToFile::Sink(ExecutionContext &context, GlobalOperatorState &gs
 	auto &l = (CopyToFunctionLocalState &)lstate;
 
 	g.rows_copied += input.size();
+	l.local_state->batch_index = context.task.batch_index;
 	function.copy_to_sink(context.client, *bind_data, *g.global_state, *l.local_state, input);
 }
 
@@ -53,14 +56,20 @@ void PhysicalCopyToFile::Finalize(Pipeline &pipeline, ClientContext &context, un
 	if (function.copy_to_finalize) {
 		function.copy_to_finalize(context, *bind_data, *g->global_state);
 	}
+	// all thread-local states have been created and combined: the global state is no longer handed out
+	global_function_data = nullptr;
 	PhysicalSink::Finalize(pipeline, context, move(gstate));
 }
 
 unique_ptr<LocalSinkState> PhysicalCopyToFile::GetLocalSinkState(ExecutionContext &context) {
-	return make_unique<CopyToFunctionLocalState>(function.copy_to_initialize_local(context.client, *bind_data));
+	D_ASSERT(global_function_data);
+	return make_unique<CopyToFunctionLocalState>(
+	    function.copy_to_initialize_local(context.client, *bind_data, *global_function_data));
 }
 unique_ptr<GlobalOperatorState> PhysicalCopyToFile::GetGlobalState(ClientContext &context) {
-	return make_unique<CopyToFunctionGlobalState>(function.copy_to_initialize_global(context, *bind_data));
+	auto state = make_unique<CopyToFunctionGlobalState>(function.copy_to_initialize_global(context, *bind_data));
+	global_function_data = state->global_state.get();
+	return move(state);
 }
 
 } // namespace duckdb
@@ -78,6 +78,10 @@ void PhysicalTableScan::GetChunkInternal(ExecutionContext &context, DataChunk &c
 					break;
 				}
 			} else {
+				if (function.get_batch_index) {
+					context.task.batch_index = function.get_batch_index(
+					    context.client, bind_data.get(), state.operator_data.get(), state.parallel_state);
+				}
 				return;
 			}
 		} while (true);
@@ -47,14 +47,25 @@ PartitionableHashTable::PartitionableHashTable(BufferManager &buffer_manager_p,
 	for (hash_t r = 0; r < partition_info.n_partitions; r++) {
 		sel_vectors[r].Initialize();
 	}
+
+	// every thread keeps an open HT per partition, and there are at most twice as many threads as partitions: keep
+	// the open HTs within half of the memory limit, the closed ones are unpinned and can be offloaded to disk
+	partition_ht_memory_limit = MaxValue<idx_t>(
+	    buffer_manager.GetMaxMemory() / (4 * partition_info.n_partitions * partition_info.n_partitions),
+	    Storage::BLOCK_ALLOC_SIZE);
 }
 
 idx_t PartitionableHashTable::ListAddChunk(HashTableList &list, DataChunk &groups, Vector &group_hashes,
                                            DataChunk &payload) {
-	if (list.empty() || list.back()->Size() + groups.size() > list.back()->MaxCapacity()) {
+	if (list.empty() || list.back()->Size() + groups.size() > list.back()->MaxCapacity() ||
+	    (IsPartitioned() && list.back()->SizeInBytes() > partition_ht_memory_limit)) {
 		if (!list.empty()) {
 			// early release first part of ht and prevent adding of more data
 			list.back()->Finalize();
+			if (IsPartitioned()) {
+				// the partition is only needed again when it is combined, so it can be offloaded until then
+				list.back()->Unpin();
+			}
 		}
 		list.push_back(make_unique<GroupedAggregateHashTable>(buffer_manager, group_types, payload_types, bindings,
 		                                                      HtEntryType::HT_WIDTH_32));
@@ -126,6 +137,13 @@ void PartitionableHashTable::Partition() {
 	}
 	unpartitioned_hts.clear();
 	is_partitioned = true;
+	// only the last HT of every partition receives new data
+	for (auto &ht_list : radix_partitioned_hts) {
+		for (idx_t ht_idx = 0; ht_idx + 1 < ht_list.second.size(); ht_idx++) {
+			ht_list.second[ht_idx]->Finalize();
+			ht_list.second[ht_idx]->Unpin();
+		}
+	}
 }
 
 bool PartitionableHashTable::IsPartitioned() {
@@ -148,13 +166,18 @@ void PartitionableHashTable::Finalize() {
 		for (auto &ht_list : radix_partitioned_hts) {
 			for (auto &ht : ht_list.second) {
 				D_ASSERT(ht);
-				ht->Finalize();
+				if (!ht->IsFinalized()) {
+					ht->Finalize();
+				}
+				ht->Unpin();
 			}
 		}
 	} else {
 		for (auto &ht : unpartitioned_hts) {
 			D_ASSERT(ht);
-			ht->Finalize();
+			if (!ht->IsFinalized()) {
+				ht->Finalize();
+			}
 		}
 	}
 }
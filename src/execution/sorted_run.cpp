@@ -0,0 +1,453 @@
+#include "duckdb/execution/sorted_run.hpp"
+
+#include "duckdb/common/serializer/buffered_deserializer.hpp"
+#include "duckdb/common/serializer/buffered_serializer.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Spill format
+//===--------------------------------------------------------------------===//
+// Note that we cannot use Vector::Serialize here: that stores NULL values as NullValue<T>, which is lossy for
+// e.g. the minimum integer. Blocks are only ever read back by the same process, so we can write the raw nullmask.
+static void SerializeSpillVector(Vector &vector, idx_t count, Serializer &serializer) {
+	D_ASSERT(vector.vector_type == VectorType::FLAT_VECTOR);
+	auto &nullmask = FlatVector::Nullmask(vector);
+	serializer.WriteData((const_data_ptr_t)&nullmask, sizeof(nullmask_t));
+	auto type = vector.type.InternalType();
+	if (TypeIsConstantSize(type)) {
+		serializer.WriteData(FlatVector::GetData(vector), GetTypeIdSize(type) * count);
+		return;
+	}
+	D_ASSERT(type == PhysicalType::VARCHAR);
+	auto strings = FlatVector::GetData<string_t>(vector);
+	for (idx_t i = 0; i < count; i++) {
+		if (!nullmask[i]) {
+			serializer.WriteStringLen((const_data_ptr_t)strings[i].GetDataUnsafe(), strings[i].GetSize());
+		}
+	}
+}
+
+static void DeserializeSpillVector(Vector &vector, idx_t count, Deserializer &source) {
+	auto &nullmask = FlatVector::Nullmask(vector);
+	source.ReadData((data_ptr_t)&nullmask, sizeof(nullmask_t));
+	auto type = vector.type.InternalType();
+	if (TypeIsConstantSize(type)) {
+		source.ReadData(FlatVector::GetData(vector), GetTypeIdSize(type) * count);
+		return;
+	}
+	D_ASSERT(type == PhysicalType::VARCHAR);
+	auto strings = FlatVector::GetData<string_t>(vector);
+	for (idx_t i = 0; i < count; i++) {
+		if (!nullmask[i]) {
+			auto length = source.Read<uint32_t>();
+			auto str = StringVector::EmptyString(vector, length);
+			source.ReadData((data_ptr_t)str.GetDataWriteable(), length);
+			str.Finalize();
+			strings[i] = str;
+		}
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Sorted Run
+//===--------------------------------------------------------------------===//
+SortedRun::SortedRun(BufferManager &buffer_manager, vector<LogicalType> types_p, idx_t key_count)
+    : types(move(types_p)), key_count(key_count), count(0), buffer_manager(buffer_manager),
+      spillable(CanSpill(types)) {
+	// size the blocks so that a block of fixed-width rows roughly fills up a single buffer-managed block
+	idx_t row_width = 0;
+	for (auto &type : types) {
+		row_width += GetTypeIdSize(type.InternalType());
+	}
+	rows_per_block = Storage::BLOCK_ALLOC_SIZE / MaxValue<idx_t>(row_width, 1);
+	rows_per_block = MaxValue<idx_t>(STANDARD_VECTOR_SIZE, rows_per_block - rows_per_block % STANDARD_VECTOR_SIZE);
+}
+
+bool SortedRun::CanSpill(const vector<LogicalType> &types) {
+	for (auto &type : types) {
+		auto internal_type = type.InternalType();
+		if (!TypeIsConstantSize(internal_type) && internal_type != PhysicalType::VARCHAR) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void SortedRun::Append(DataChunk &chunk) {
+	if (chunk.size() == 0) {
+		return;
+	}
+	buffer.Append(chunk);
+	count += chunk.size();
+	if (buffer.Count() >= rows_per_block) {
+		FlushBlock();
+	}
+}
+
+void SortedRun::Finalize() {
+	FlushBlock();
+}
+
+void SortedRun::FlushBlock() {
+	if (buffer.Count() == 0) {
+		return;
+	}
+	auto new_block = make_unique<SortedRunBlock>();
+	new_block->start = count - buffer.Count();
+	new_block->count = buffer.Count();
+
+	if (key_count > 0) {
+		// store the sort keys of the first row separately
+		vector<LogicalType> key_types(types.begin(), types.begin() + key_count);
+		new_block->first_key.Initialize(key_types);
+		auto &first_chunk = buffer.GetChunk(0);
+		for (idx_t col_idx = 0; col_idx < key_count; col_idx++) {
+			VectorOperations::Copy(first_chunk.data[col_idx], new_block->first_key.data[col_idx], 1, 0, 0);
+		}
+		new_block->first_key.SetCardinality(1);
+	}
+
+	if (!spillable) {
+		// the rows cannot be serialized: keep them in memory
+		new_block->data = make_unique<ChunkCollection>();
+		new_block->data->Merge(buffer);
+		buffer.Reset();
+		blocks.push_back(move(new_block));
+		return;
+	}
+	// serialize the rows and write them into a buffer-managed block that can be offloaded to disk
+	BufferedSerializer serializer(Storage::BLOCK_ALLOC_SIZE);
+	for (auto &chunk : buffer.Chunks()) {
+		chunk->Normalify();
+		serializer.Write<idx_t>(chunk->size());
+		for (idx_t col_idx = 0; col_idx < chunk->ColumnCount(); col_idx++) {
+			SerializeSpillVector(chunk->data[col_idx], chunk->size(), serializer);
+		}
+	}
+	buffer.Reset();
+	auto blob = serializer.GetData();
+	new_block->block = buffer_manager.RegisterMemory(
+	    MaxValue<idx_t>(Storage::BLOCK_ALLOC_SIZE, blob.size + Storage::BLOCK_HEADER_SIZE), false);
+	auto handle = buffer_manager.Pin(new_block->block);
+	memcpy(handle->node->buffer, blob.data.get(), blob.size);
+	blocks.push_back(move(new_block));
+}
+
+ChunkCollection &SortedRun::LoadBlock(idx_t block_idx, ChunkCollection &scratch) {
+	D_ASSERT(block_idx < blocks.size());
+	auto &block = *blocks[block_idx];
+	if (block.data) {
+		return *block.data;
+	}
+	scratch.Reset();
+	auto handle = buffer_manager.Pin(block.block);
+	BufferedDeserializer source(handle->node->buffer, handle->node->size);
+	idx_t remaining = block.count;
+	DataChunk chunk;
+	chunk.Initialize(types);
+	while (remaining > 0) {
+		chunk.Reset();
+		auto chunk_count = source.Read<idx_t>();
+		for (idx_t col_idx = 0; col_idx < chunk.ColumnCount(); col_idx++) {
+			DeserializeSpillVector(chunk.data[col_idx], chunk_count, source);
+		}
+		chunk.SetCardinality(chunk_count);
+		scratch.Append(chunk);
+		remaining -= chunk_count;
+	}
+	return scratch;
+}
+
+idx_t SortedRun::LocateBlock(idx_t row_idx) {
+	D_ASSERT(row_idx < count);
+	// find the first block that starts after the row, the row is in the block before it
+	auto entry =
+	    std::upper_bound(blocks.begin(), blocks.end(), row_idx,
+	                     [](idx_t row, const unique_ptr<SortedRunBlock> &block) { return row < block->start; });
+	D_ASSERT(entry != blocks.begin());
+	return (entry - blocks.begin()) - 1;
+}
+
+//===--------------------------------------------------------------------===//
+// Sorted Run Scanner
+//===--------------------------------------------------------------------===//
+SortedRunScanner::SortedRunScanner(SortedRun &run, idx_t start, idx_t end)
+    : run(run), position(start), end(end), block_idx(0), block_start(0), current(nullptr), chunk_idx(0) {
+	D_ASSERT(start <= end && end <= run.count);
+	if (!Done()) {
+		LoadCurrentBlock();
+	}
+}
+
+void SortedRunScanner::LoadCurrentBlock() {
+	block_idx = run.LocateBlock(position);
+	block_start = run.blocks[block_idx]->start;
+	current = &run.LoadBlock(block_idx, block_data);
+	chunk_idx = (position - block_start) / STANDARD_VECTOR_SIZE;
+}
+
+idx_t SortedRunScanner::RemainingInChunk() {
+	return MinValue<idx_t>(CurrentChunk().size() - CurrentIndex(), end - position);
+}
+
+bool SortedRunScanner::AdvanceLoadsBlock(idx_t amount) {
+	auto &block = *run.blocks[block_idx];
+	return position + amount < end && position + amount >= block.start + block.count;
+}
+
+void SortedRunScanner::Advance(idx_t amount) {
+	D_ASSERT(amount <= RemainingInChunk());
+	bool load_block = AdvanceLoadsBlock(amount);
+	position += amount;
+	if (Done()) {
+		return;
+	}
+	if (load_block) {
+		LoadCurrentBlock();
+	} else {
+		chunk_idx = (position - block_start) / STANDARD_VECTOR_SIZE;
+	}
+}
+
+void SortedRunScanner::Scan(DataChunk &result, idx_t column_offset) {
+	D_ASSERT(result.ColumnCount() + column_offset == run.types.size());
+	idx_t result_count = 0;
+	while (result_count < STANDARD_VECTOR_SIZE && !Done()) {
+		auto &chunk = CurrentChunk();
+		auto index = CurrentIndex();
+		auto scan_count = MinValue<idx_t>(RemainingInChunk(), STANDARD_VECTOR_SIZE - result_count);
+		for (idx_t col_idx = 0; col_idx < result.ColumnCount(); col_idx++) {
+			VectorOperations::Copy(chunk.data[column_offset + col_idx], result.data[col_idx], index + scan_count,
+			                       index, result_count);
+		}
+		result_count += scan_count;
+		Advance(scan_count);
+	}
+	result.SetCardinality(result_count);
+}
+
+//===--------------------------------------------------------------------===//
+// Sorted Run Merger
+//===--------------------------------------------------------------------===//
+SortedRunMerger::SortedRunMerger(vector<unique_ptr<SortedRunScanner>> scanners_p, vector<OrderType> &order_types,
+                                 vector<OrderByNullType> &null_order_types)
+    : scanners(move(scanners_p)), order_types(order_types), null_order_types(null_order_types) {
+}
+
+template <class T>
+static void TemplatedGather(DataChunk *chunks[], idx_t rows[], idx_t col_idx, idx_t count, Vector &target) {
+	auto target_data = FlatVector::GetData<T>(target);
+	auto &target_mask = FlatVector::Nullmask(target);
+	for (idx_t i = 0; i < count; i++) {
+		auto &source = chunks[i]->data[col_idx];
+		if (FlatVector::IsNull(source, rows[i])) {
+			target_mask[i] = true;
+		} else {
+			target_data[i] = FlatVector::GetData<T>(source)[rows[i]];
+		}
+	}
+}
+
+//! Gathers the rows from the (flat) source chunks into the target vector. Strings are not copied: the source chunks
+//! must remain valid until the target has been appended to the result run.
+static void GatherColumn(DataChunk *chunks[], idx_t rows[], idx_t col_idx, idx_t count, Vector &target) {
+	switch (target.type.InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+		TemplatedGather<int8_t>(chunks, rows, col_idx, count, target);
+		break;
+	case PhysicalType::INT16:
+		TemplatedGather<int16_t>(chunks, rows, col_idx, count, target);
+		break;
+	case PhysicalType::INT32:
+		TemplatedGather<int32_t>(chunks, rows, col_idx, count, target);
+		break;
+	case PhysicalType::INT64:
+		TemplatedGather<int64_t>(chunks, rows, col_idx, count, target);
+		break;
+	case PhysicalType::UINT8:
+		TemplatedGather<uint8_t>(chunks, rows, col_idx, count, target);
+		break;
+	case PhysicalType::UINT16:
+		TemplatedGather<uint16_t>(chunks, rows, col_idx, count, target);
+		break;
+	case PhysicalType::UINT32:
+		TemplatedGather<uint32_t>(chunks, rows, col_idx, count, target);
+		break;
+	case PhysicalType::UINT64:
+		TemplatedGather<uint64_t>(chunks, rows, col_idx, count, target);
+		break;
+	case PhysicalType::INT128:
+		TemplatedGather<hugeint_t>(chunks, rows, col_idx, count, target);
+		break;
+	case PhysicalType::FLOAT:
+		TemplatedGather<float>(chunks, rows, col_idx, count, target);
+		break;
+	case PhysicalType::DOUBLE:
+		TemplatedGather<double>(chunks, rows, col_idx, count, target);
+		break;
+	case PhysicalType::INTERVAL:
+		TemplatedGather<interval_t>(chunks, rows, col_idx, count, target);
+		break;
+	case PhysicalType::VARCHAR:
+		TemplatedGather<string_t>(chunks, rows, col_idx, count, target);
+		break;
+	default:
+		// nested types: copy row by row
+		for (idx_t i = 0; i < count; i++) {
+			VectorOperations::Copy(chunks[i]->data[col_idx], target, rows[i] + 1, rows[i], i);
+		}
+		break;
+	}
+}
+
+void SortedRunMerger::Merge(SortedRun &result) {
+	DataChunk output;
+	output.Initialize(result.types);
+	DataChunk *source_chunks[STANDARD_VECTOR_SIZE];
+	idx_t source_rows[STANDARD_VECTOR_SIZE];
+	idx_t output_count = 0;
+
+	auto flush = [&]() {
+		if (output_count == 0) {
+			return;
+		}
+		for (idx_t col_idx = 0; col_idx < output.ColumnCount(); col_idx++) {
+			GatherColumn(source_chunks, source_rows, col_idx, output_count, output.data[col_idx]);
+		}
+		output.SetCardinality(output_count);
+		result.Append(output);
+		output.Reset();
+		output_count = 0;
+	};
+	auto compare = [&](idx_t left, idx_t right) {
+		auto &l = *scanners[left];
+		auto &r = *scanners[right];
+		return ChunkCollection::CompareRows(l.CurrentChunk(), l.CurrentIndex(), r.CurrentChunk(), r.CurrentIndex(),
+		                                    order_types, null_order_types);
+	};
+	// min-heap of the scanners, ordered by their current row (ties are broken by the scanner index)
+	auto greater = [&](idx_t left, idx_t right) {
+		auto cmp = compare(left, right);
+		return cmp > 0 || (cmp == 0 && left > right);
+	};
+	vector<idx_t> heap;
+	for (idx_t i = 0; i < scanners.size(); i++) {
+		if (!scanners[i]->Done()) {
+			heap.push_back(i);
+		}
+	}
+	std::make_heap(heap.begin(), heap.end(), greater);
+	while (!heap.empty()) {
+		std::pop_heap(heap.begin(), heap.end(), greater);
+		auto min_idx = heap.back();
+		heap.pop_back();
+
+		auto &scanner = *scanners[min_idx];
+		auto &chunk = scanner.CurrentChunk();
+		auto row = scanner.CurrentIndex();
+		// take as many consecutive rows from this scanner as we can before another scanner has a smaller row
+		auto available = MinValue<idx_t>(scanner.RemainingInChunk(), STANDARD_VECTOR_SIZE - output_count);
+		idx_t take = available;
+		if (!heap.empty()) {
+			auto &next = *scanners[heap.front()];
+			auto &next_chunk = next.CurrentChunk();
+			auto next_row = next.CurrentIndex();
+			for (take = 1; take < available; take++) {
+				auto cmp = ChunkCollection::CompareRows(chunk, row + take, next_chunk, next_row, order_types,
+				                                        null_order_types);
+				if (cmp > 0 || (cmp == 0 && min_idx > heap.front())) {
+					break;
+				}
+			}
+		}
+		for (idx_t i = 0; i < take; i++) {
+			source_chunks[output_count] = &chunk;
+			source_rows[output_count] = row + i;
+			output_count++;
+		}
+		// loading a new block invalidates the rows we gathered so far: flush them first
+		if (output_count == STANDARD_VECTOR_SIZE || scanner.AdvanceLoadsBlock(take)) {
+			flush();
+		}
+		scanner.Advance(take);
+		if (!scanner.Done()) {
+			heap.push_back(min_idx);
+			std::push_heap(heap.begin(), heap.end(), greater);
+		}
+	}
+	flush();
+	result.Finalize();
+}
+
+//===--------------------------------------------------------------------===//
+// Partitioning
+//===--------------------------------------------------------------------===//
+//! Returns the index of the first row in the run that is not smaller than the key
+static idx_t SortedRunLowerBound(SortedRun &run, DataChunk &key, vector<OrderType> &order_types,
+                                 vector<OrderByNullType> &null_order_types) {
+	// find the first block whose first row is not smaller than the key
+	auto entry = std::lower_bound(run.blocks.begin(), run.blocks.end(), &key,
+	                              [&](const unique_ptr<SortedRunBlock> &block, DataChunk *key) {
+		                              return ChunkCollection::CompareRows(block->first_key, 0, *key, 0, order_types,
+		                                                                  null_order_types) < 0;
+	                              });
+	if (entry == run.blocks.begin()) {
+		return 0;
+	}
+	// the boundary lies within the block before it
+	idx_t block_idx = (entry - run.blocks.begin()) - 1;
+	auto &block = *run.blocks[block_idx];
+	ChunkCollection scratch;
+	auto &data = run.LoadBlock(block_idx, scratch);
+	idx_t lower = 0, upper = block.count;
+	while (lower < upper) {
+		idx_t middle = lower + (upper - lower) / 2;
+		auto &chunk = data.GetChunk(middle / STANDARD_VECTOR_SIZE);
+		if (ChunkCollection::CompareRows(chunk, middle % STANDARD_VECTOR_SIZE, key, 0, order_types,
+		                                 null_order_types) < 0) {
+			lower = middle + 1;
+		} else {
+			upper = middle;
+		}
+	}
+	return block.start + lower;
+}
+
+vector<vector<idx_t>> PartitionSortedRuns(vector<unique_ptr<SortedRun>> &runs, idx_t n_partitions,
+                                          vector<OrderType> &order_types, vector<OrderByNullType> &null_order_types) {
+	// the first keys of the blocks are the candidate splitters
+	vector<DataChunk *> candidates;
+	for (auto &run : runs) {
+		for (idx_t block_idx = 1; block_idx < run->blocks.size(); block_idx++) {
+			candidates.push_back(&run->blocks[block_idx]->first_key);
+		}
+	}
+	std::sort(candidates.begin(), candidates.end(), [&](DataChunk *left, DataChunk *right) {
+		return ChunkCollection::CompareRows(*left, 0, *right, 0, order_types, null_order_types) < 0;
+	});
+	n_partitions = MaxValue<idx_t>(1, MinValue<idx_t>(n_partitions, candidates.size() + 1));
+
+	vector<vector<idx_t>> boundaries;
+	boundaries.push_back(vector<idx_t>(runs.size(), 0));
+	for (idx_t partition = 1; partition < n_partitions; partition++) {
+		auto &splitter = *candidates[partition * candidates.size() / n_partitions];
+		vector<idx_t> boundary;
+		for (auto &run : runs) {
+			boundary.push_back(SortedRunLowerBound(*run, splitter, order_types, null_order_types));
+		}
+		boundaries.push_back(move(boundary));
+	}
+	vector<idx_t> end;
+	for (auto &run : runs) {
+		end.push_back(run->count);
+	}
+	boundaries.push_back(move(end));
+	return boundaries;
+}
+
+} // namespace duckdb
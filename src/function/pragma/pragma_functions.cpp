@@ -60,6 +60,20 @@ static void PragmaMemoryLimit(ClientContext &context, const FunctionParameters &
 	BufferManager::GetBufferManager(context).SetLimit(new_limit);
 }
 
+static void PragmaBufferEvictionPolicy(ClientContext &context, const FunctionParameters &parameters) {
+	auto policy_name = StringUtil::Lower(parameters.values[0].ToString());
+	BufferEvictionPolicy policy;
+	if (policy_name == "lru") {
+		policy = BufferEvictionPolicy::LRU;
+	} else if (policy_name == "2q") {
+		policy = BufferEvictionPolicy::TWO_QUEUE;
+	} else {
+		throw ParserException("Unrecognized eviction policy '%s', expected either LRU or 2Q", policy_name);
+	}
+	DBConfig::GetConfig(context).eviction_policy = policy;
+	BufferManager::GetBufferManager(context).SetEvictionPolicy(policy);
+}
+
 static void PragmaCollation(ClientContext &context, const FunctionParameters &parameters) {
 	auto collation_param = StringUtil::Lower(parameters.values[0].ToString());
 	// bind the collation to verify that it exists
@@ -184,6 +198,14 @@ static void PragmaAutoCheckpointThreshold(ClientContext &context, const Function
 	DBConfig::GetConfig(context).checkpoint_wal_size = new_limit;
 }
 
+static void PragmaWALCommitDelay(ClientContext &context, const FunctionParameters &parameters) {
+	auto commit_delay = parameters.values[0].GetValue<int64_t>();
+	if (commit_delay < 0) {
+		throw ParserException("WAL commit delay cannot be negative");
+	}
+	DBConfig::GetConfig(context).wal_commit_delay = commit_delay;
+}
+
 static void PragmaDebugCheckpointAbort(ClientContext &context, const FunctionParameters &parameters) {
 	auto checkpoint_abort = StringUtil::Lower(parameters.values[0].ToString());
 	auto &config = DBConfig::GetConfig(context);
@@ -209,6 +231,8 @@ void PragmaFunctions::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(PragmaFunction::PragmaAssignment("profiling_output", PragmaProfileOutput, LogicalType::VARCHAR));
 
 	set.AddFunction(PragmaFunction::PragmaAssignment("memory_limit", PragmaMemoryLimit, LogicalType::VARCHAR));
+	set.AddFunction(PragmaFunction::PragmaAssignment("buffer_eviction_policy", PragmaBufferEvictionPolicy,
+	                                                 LogicalType::VARCHAR));
 
 	set.AddFunction(PragmaFunction::PragmaAssignment("collation", PragmaCollation, LogicalType::VARCHAR));
 	set.AddFunction(PragmaFunction::PragmaAssignment("default_collation", PragmaCollation, LogicalType::VARCHAR));
@@ -252,6 +276,8 @@ void PragmaFunctions::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(
 	    PragmaFunction::PragmaAssignment("checkpoint_threshold", PragmaAutoCheckpointThreshold, LogicalType::VARCHAR));
 
+	set.AddFunction(PragmaFunction::PragmaAssignment("wal_commit_delay", PragmaWALCommitDelay, LogicalType::BIGINT));
+
 	set.AddFunction(
 	    PragmaFunction::PragmaAssignment("debug_checkpoint_abort", PragmaDebugCheckpointAbort, LogicalType::VARCHAR));
 }
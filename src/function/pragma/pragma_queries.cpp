@@ -57,6 +57,14 @@ string PragmaDatabaseSize(ClientContext &context, const FunctionParameters &para
 	return "SELECT * FROM pragma_database_size()";
 }
 
+string PragmaBufferManagerStats(ClientContext &context, const FunctionParameters &parameters) {
+	return "SELECT * FROM pragma_buffer_manager_stats()";
+}
+
+string PragmaWALStats(ClientContext &context, const FunctionParameters &parameters) {
+	return "SELECT * FROM pragma_wal_stats()";
+}
+
 void PragmaQueries::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(PragmaFunction::PragmaCall("table_info", PragmaTableInfo, {LogicalType::VARCHAR}));
 	set.AddFunction(PragmaFunction::PragmaStatement("show_tables", PragmaShowTables));
@@ -65,6 +73,8 @@ void PragmaQueries::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(PragmaFunction::PragmaCall("show", PragmaShow, {LogicalType::VARCHAR}));
 	set.AddFunction(PragmaFunction::PragmaStatement("version", PragmaVersion));
 	set.AddFunction(PragmaFunction::PragmaStatement("database_size", PragmaDatabaseSize));
+	set.AddFunction(PragmaFunction::PragmaStatement("buffer_manager_stats", PragmaBufferManagerStats));
+	set.AddFunction(PragmaFunction::PragmaStatement("wal_stats", PragmaWALStats));
 	set.AddFunction(PragmaFunction::PragmaStatement("functions", PragmaFunctionsQuery));
 	set.AddFunction(PragmaFunction::PragmaCall("import_database", PragmaImportDatabase, {LogicalType::VARCHAR}));
 }
@@ -5,10 +5,14 @@
 #include "duckdb/parser/parsed_data/copy_info.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/pair.hpp"
 #include "duckdb/common/types/string_type.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/function/scalar/string_functions.hpp"
+#include <condition_variable>
+#include <cstring>
 #include <limits>
+#include <map>
 
 namespace duckdb {
 
@@ -170,6 +174,8 @@ static unique_ptr<FunctionData> WriteCSVBind(ClientContext &context, CopyInfo &i
 			continue;
 		} else if (loption == "force_quote") {
 			bind_data->force_quote = ParseColumnList(set, names);
+		} else if (loption == "per_thread_output") {
+			bind_data->per_thread_output = ParseBoolean(set);
 		} else {
 			throw NotImplementedException("Unrecognized option for CSV: %s", option.first.c_str());
 		}
@@ -392,15 +398,37 @@ static void WriteQuotedString(Serializer &serializer, WriteCSVData &csv_data, co
 //===--------------------------------------------------------------------===//
 // Sink
 //===--------------------------------------------------------------------===//
+struct GlobalWriteCSVData;
+
 struct LocalReadCSVData : public LocalFunctionData {
+	~LocalReadCSVData() override;
+
 	//! The thread-local buffer to write data into
 	BufferedSerializer serializer;
 	//! A chunk with VARCHAR columns to cast intermediates into
 	DataChunk cast_chunk;
+	//! The index of the thread in the global state (when writing to a single file)
+	idx_t thread_index = 0;
+	//! The batch index of the rows that are currently buffered in the serializer
+	idx_t buffered_batch_index = 0;
+	//! The file that the thread writes to (when writing a file per thread)
+	unique_ptr<FileHandle> handle;
+	//! The global state the thread is registered in (when writing to a single file), until the thread has finished
+	GlobalWriteCSVData *registered_state = nullptr;
 };
 
+//! The maximum amount of formatted rows (in bytes) that are kept in memory while they wait for a preceding batch
+static constexpr idx_t MAX_DEFERRED_SIZE = 16 * 1024 * 1024;
+
 struct GlobalWriteCSVData : public GlobalFunctionData {
-	GlobalWriteCSVData(FileSystem &fs, string file_path) : fs(fs) {
+	GlobalWriteCSVData(FileSystem &fs, string file_path, bool per_thread_output) : fs(fs) {
+		if (per_thread_output) {
+			// the threads create their own files in the directory
+			if (!fs.DirectoryExists(file_path)) {
+				fs.CreateDirectory(file_path);
+			}
+			return;
+		}
 		handle = fs.OpenFile(file_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW,
 		                     FileLockType::WRITE_LOCK);
 	}
@@ -410,15 +438,123 @@ struct GlobalWriteCSVData : public GlobalFunctionData {
 		fs.Write(*handle, (void *)data, size);
 	}
 
+	//! Registers a thread that writes to the file, and returns its index
+	idx_t RegisterThread() {
+		lock_guard<mutex> flock(lock);
+		thread_batches.push_back(0);
+		return thread_batches.size() - 1;
+	}
+
+	//! Writes the rows of the given batch to the file. If a thread is still formatting the rows of a preceding batch,
+	//! the rows are kept in memory until the preceding rows have been written. If too many rows are kept in memory
+	//! already, this waits until the minimum batch has advanced.
+	void WriteBatchData(idx_t batch_index, const_data_ptr_t data, idx_t size) {
+		std::unique_lock<mutex> flock(lock);
+		// the thread formatting the minimum batch never waits, so the minimum batch always advances eventually
+		batch_advanced.wait(flock, [&] {
+			return aborted || batch_index <= MinimumThreadBatch() || deferred_size < MAX_DEFERRED_SIZE;
+		});
+		// all deferred rows belong to batches after the minimum batch, so these rows can be written before them
+		if (batch_index <= MinimumThreadBatch()) {
+			fs.Write(*handle, (void *)data, size);
+			return;
+		}
+		BinaryData deferred;
+		deferred.data = unique_ptr<data_t[]>(new data_t[size]);
+		deferred.size = size;
+		memcpy(deferred.data.get(), data, size);
+		deferred_data[make_pair(batch_index, deferred_count++)] = move(deferred);
+		deferred_size += size;
+	}
+
+	//! Sets the batch of which the thread formats the rows (INVALID_INDEX if the thread has finished), and writes the
+	//! deferred rows that no longer have to wait for a preceding batch
+	void SetThreadBatch(idx_t thread_index, idx_t batch_index) {
+		lock_guard<mutex> flock(lock);
+		D_ASSERT(thread_index < thread_batches.size());
+		thread_batches[thread_index] = batch_index;
+		auto minimum_batch = MinimumThreadBatch();
+		while (!deferred_data.empty() && deferred_data.begin()->first.first <= minimum_batch) {
+			auto &deferred = deferred_data.begin()->second;
+			fs.Write(*handle, deferred.data.get(), deferred.size);
+			deferred_size -= deferred.size;
+			deferred_data.erase(deferred_data.begin());
+		}
+		batch_advanced.notify_all();
+	}
+
+	//! Called when a thread stops without finishing (i.e. because of an error): threads waiting for its batch to be
+	//! written are woken up
+	void AbortThread(idx_t thread_index) {
+		lock_guard<mutex> flock(lock);
+		D_ASSERT(thread_index < thread_batches.size());
+		thread_batches[thread_index] = INVALID_INDEX;
+		aborted = true;
+		batch_advanced.notify_all();
+	}
+
+	//! Opens a new file in the directory for a single thread to write to
+	unique_ptr<FileHandle> OpenThreadFile(const string &directory) {
+		idx_t file_index;
+		{
+			lock_guard<mutex> flock(lock);
+			file_index = file_count++;
+		}
+		auto file_path = fs.JoinPath(directory, "data_" + to_string(file_index) + ".csv");
+		return fs.OpenFile(file_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW,
+		                   FileLockType::WRITE_LOCK);
+	}
+
 	FileSystem &fs;
 	//! The mutex for writing to the physical file
 	mutex lock;
 	//! The file handle to write to
 	unique_ptr<FileHandle> handle;
+	//! The batch that every registered thread is formatting (INVALID_INDEX for threads that have finished)
+	vector<idx_t> thread_batches;
+	//! The formatted rows that wait for the rows of a preceding batch, by batch index and order of arrival
+	std::map<pair<idx_t, idx_t>, BinaryData> deferred_data;
+	idx_t deferred_count = 0;
+	//! The total size of the deferred rows
+	idx_t deferred_size = 0;
+	//! Signaled when the minimum batch has advanced and the deferred rows of the batches up to it have been written
+	std::condition_variable batch_advanced;
+	//! Whether or not a thread has stopped without finishing
+	bool aborted = false;
+	//! The amount of files that have been opened for the threads
+	idx_t file_count = 0;
+
+private:
+	idx_t MinimumThreadBatch() {
+		idx_t minimum_batch = INVALID_INDEX;
+		for (auto &batch_index : thread_batches) {
+			minimum_batch = MinValue<idx_t>(minimum_batch, batch_index);
+		}
+		return minimum_batch;
+	}
 };
 
-static unique_ptr<LocalFunctionData> WriteCSVInitializeLocal(ClientContext &context, FunctionData &bind_data) {
+LocalReadCSVData::~LocalReadCSVData() {
+	if (registered_state) {
+		// the thread did not reach the combine: do not let other threads wait for its batch
+		registered_state->AbortThread(thread_index);
+	}
+}
+
+static void WriteCSVHeader(BufferedSerializer &serializer, WriteCSVData &csv_data) {
+	for (idx_t i = 0; i < csv_data.names.size(); i++) {
+		if (i != 0) {
+			serializer.WriteBufferData(csv_data.options.delimiter);
+		}
+		WriteQuotedString(serializer, csv_data, csv_data.names[i].c_str(), csv_data.names[i].size(), false);
+	}
+	serializer.WriteBufferData(csv_data.newline);
+}
+
+static unique_ptr<LocalFunctionData> WriteCSVInitializeLocal(ClientContext &context, FunctionData &bind_data,
+                                                             GlobalFunctionData &gstate) {
 	auto &csv_data = (WriteCSVData &)bind_data;
+	auto &global_state = (GlobalWriteCSVData &)gstate;
 	auto local_data = make_unique<LocalReadCSVData>();
 
 	// create the chunk with VARCHAR types
@@ -426,36 +562,67 @@ static unique_ptr<LocalFunctionData> WriteCSVInitializeLocal(ClientContext &cont
 	types.resize(csv_data.names.size(), LogicalType::VARCHAR);
 
 	local_data->cast_chunk.Initialize(types);
+	if (!csv_data.per_thread_output) {
+		// register the thread before it produces any rows, so that no rows of a later batch are written before the
+		// rows of the batch that this thread is going to format
+		local_data->thread_index = global_state.RegisterThread();
+		local_data->registered_state = &global_state;
+	}
 	return move(local_data);
 }
 
 static unique_ptr<GlobalFunctionData> WriteCSVInitializeGlobal(ClientContext &context, FunctionData &bind_data) {
 	auto &csv_data = (WriteCSVData &)bind_data;
 	auto &options = csv_data.options;
-	auto global_data = make_unique<GlobalWriteCSVData>(FileSystem::GetFileSystem(context), csv_data.files[0]);
+	auto global_data = make_unique<GlobalWriteCSVData>(FileSystem::GetFileSystem(context), csv_data.files[0],
+	                                                   csv_data.per_thread_output);
 
-	if (options.header) {
-		BufferedSerializer serializer;
+	if (options.header && !csv_data.per_thread_output) {
 		// write the header line to the file
-		for (idx_t i = 0; i < csv_data.names.size(); i++) {
-			if (i != 0) {
-				serializer.WriteBufferData(options.delimiter);
-			}
-			WriteQuotedString(serializer, csv_data, csv_data.names[i].c_str(), csv_data.names[i].size(), false);
-		}
-		serializer.WriteBufferData(csv_data.newline);
+		BufferedSerializer serializer;
+		WriteCSVHeader(serializer, csv_data);
 
 		global_data->WriteData(serializer.blob.data.get(), serializer.blob.size);
 	}
 	return move(global_data);
 }
 
+//! Writes the rows that the thread has buffered to its own file, or hands them over to the global state
+static void FlushLocalCSVData(GlobalWriteCSVData &global_state, LocalReadCSVData &local_data) {
+	auto &writer = local_data.serializer;
+	if (writer.blob.size == 0) {
+		return;
+	}
+	if (local_data.handle) {
+		global_state.fs.Write(*local_data.handle, writer.blob.data.get(), writer.blob.size);
+	} else {
+		global_state.WriteBatchData(local_data.buffered_batch_index, writer.blob.data.get(), writer.blob.size);
+	}
+	writer.Reset();
+}
+
 static void WriteCSVSink(ClientContext &context, FunctionData &bind_data, GlobalFunctionData &gstate,
                          LocalFunctionData &lstate, DataChunk &input) {
 	auto &csv_data = (WriteCSVData &)bind_data;
 	auto &options = csv_data.options;
 	auto &local_data = (LocalReadCSVData &)lstate;
 	auto &global_state = (GlobalWriteCSVData &)gstate;
+	auto &writer = local_data.serializer;
+
+	if (csv_data.per_thread_output) {
+		if (!local_data.handle) {
+			// first rows of this thread: open the file of the thread
+			local_data.handle = global_state.OpenThreadFile(csv_data.files[0]);
+			if (options.header) {
+				WriteCSVHeader(writer, csv_data);
+			}
+		}
+	} else if (local_data.batch_index != local_data.buffered_batch_index) {
+		// the rows belong to a new batch: hand over the rows of the previous batch first
+		FlushLocalCSVData(global_state, local_data);
+		local_data.buffered_batch_index = local_data.batch_index;
+		global_state.SetThreadBatch(local_data.thread_index, local_data.batch_index);
+	}
 
 	// write data into the local buffer
 
@@ -473,7 +640,6 @@ static void WriteCSVSink(ClientContext &context, FunctionData &bind_data, Global
 	}
 
 	cast_chunk.Normalify();
-	auto &writer = local_data.serializer;
 	// now loop over the vectors and output the values
 	for (idx_t row_idx = 0; row_idx < cast_chunk.size(); row_idx++) {
 		// write values
@@ -500,8 +666,7 @@ static void WriteCSVSink(ClientContext &context, FunctionData &bind_data, Global
 	}
 	// check if we should flush what we have currently written
 	if (writer.blob.size >= csv_data.flush_size) {
-		global_state.WriteData(writer.blob.data.get(), writer.blob.size);
-		writer.Reset();
+		FlushLocalCSVData(global_state, local_data);
 	}
 }
 
@@ -510,16 +675,27 @@ static void WriteCSVSink(ClientContext &context, FunctionData &bind_data, Global
 //===--------------------------------------------------------------------===//
 static void WriteCSVCombine(ClientContext &context, FunctionData &bind_data, GlobalFunctionData &gstate,
                             LocalFunctionData &lstate) {
+	auto &csv_data = (WriteCSVData &)bind_data;
 	auto &local_data = (LocalReadCSVData &)lstate;
 	auto &global_state = (GlobalWriteCSVData &)gstate;
-	auto &writer = local_data.serializer;
 	// flush the local writer
-	if (writer.blob.size > 0) {
-		global_state.WriteData(writer.blob.data.get(), writer.blob.size);
-		writer.Reset();
+	FlushLocalCSVData(global_state, local_data);
+	if (csv_data.per_thread_output) {
+		// close the file of this thread
+		local_data.handle.reset();
+	} else {
+		// the thread has finished: the rows of later batches no longer have to wait for it
+		global_state.SetThreadBatch(local_data.thread_index, INVALID_INDEX);
+		local_data.registered_state = nullptr;
 	}
 }
 
+static bool WriteCSVPreservesOrder(FunctionData &bind_data) {
+	auto &csv_data = (WriteCSVData &)bind_data;
+	// with a file per thread, every thread writes its rows in the order in which it receives them
+	return !csv_data.per_thread_output;
+}
+
 void CSVCopyFunction::RegisterFunction(BuiltinFunctions &set) {
 	CopyFunction info("csv");
 	info.copy_to_bind = WriteCSVBind;
@@ -527,6 +703,8 @@ void CSVCopyFunction::RegisterFunction(BuiltinFunctions &set) {
 	info.copy_to_initialize_global = WriteCSVInitializeGlobal;
 	info.copy_to_sink = WriteCSVSink;
 	info.copy_to_combine = WriteCSVCombine;
+	info.copy_to_preserves_order = WriteCSVPreservesOrder;
+	info.parallel = true;
 
 	info.copy_from_bind = ReadCSVBind;
 	info.copy_from_function = ReadCSVTableFunction::GetFunction();
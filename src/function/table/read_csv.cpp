@@ -1,14 +1,63 @@
 #include "duckdb/function/table/read_csv.hpp"
 
+#include "duckdb/common/pair.hpp"
 #include "duckdb/execution/operator/persistent/buffered_csv_reader.hpp"
 #include "duckdb/function/function_set.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/parallel/parallel_state.hpp"
 
+#include <algorithm>
+#include <condition_variable>
 #include <limits>
 
 namespace duckdb {
 
+constexpr idx_t ReadCSVData::PARALLEL_RANGE_SIZE;
+
+//! Count the quotes in the byte range [start, end) of a file
+static idx_t CountQuotes(FileSystem &fs, const string &path, idx_t start, idx_t end, char quote) {
+	static constexpr idx_t QUOTE_COUNT_BUFFER_SIZE = 1 << 16;
+	auto handle = fs.OpenFile(path.c_str(), FileFlags::FILE_FLAGS_READ);
+	auto buffer = unique_ptr<char[]>(new char[QUOTE_COUNT_BUFFER_SIZE]);
+	idx_t quote_count = 0;
+	for (idx_t location = start; location < end; location += QUOTE_COUNT_BUFFER_SIZE) {
+		auto read_size = MinValue<idx_t>(QUOTE_COUNT_BUFFER_SIZE, end - location);
+		fs.Read(*handle, buffer.get(), read_size, location);
+		quote_count += std::count(buffer.get(), buffer.get() + read_size, quote);
+	}
+	return quote_count;
+}
+
+vector<CSVFileRange> ReadCSVData::GetRanges(ClientContext &context) {
+	vector<CSVFileRange> ranges;
+	if (!parallel) {
+		return ranges;
+	}
+	// a range starts at the first newline that is not part of a quoted value, which follows from the amount of quotes
+	// that precede the range. Quotes can only be counted if every quote opens or closes a quoted value, i.e. if quotes
+	// are escaped by doubling them: otherwise the files are read by a single thread each
+	const auto &quote = range_options.quote;
+	const auto &escape = range_options.escape;
+	bool split_files = quote.empty() || (quote.size() == 1 && (escape.empty() || escape == quote));
+	// with forced parallelism we split up even small files, so that the parallel reading is exercised
+	idx_t range_size = context.force_parallelism ? 1024 : PARALLEL_RANGE_SIZE;
+	auto &fs = FileSystem::GetFileSystem(context);
+	for (idx_t file_idx = 0; file_idx < files.size(); file_idx++) {
+		if (!split_files || range_options.IsGzipCompressed(files[file_idx])) {
+			// compressed files cannot be split up: they are read as a whole by a single thread
+			ranges.emplace_back(file_idx, 0, INVALID_INDEX);
+			continue;
+		}
+		auto handle = fs.OpenFile(files[file_idx], FileFlags::FILE_FLAGS_READ);
+		idx_t file_size = fs.GetFileSize(*handle);
+		for (idx_t range_start = 0; range_start < file_size; range_start += range_size) {
+			ranges.emplace_back(file_idx, range_start, MinValue<idx_t>(range_start + range_size, file_size));
+		}
+	}
+	return ranges;
+}
+
 static unique_ptr<FunctionData> ReadCSVBind(ClientContext &context, vector<Value> &inputs,
                                             unordered_map<string, Value> &named_parameters,
                                             vector<LogicalType> &return_types, vector<string> &names) {
@@ -105,6 +154,8 @@ static unique_ptr<FunctionData> ReadCSVBind(ClientContext &context, vector<Value
 			options.compression = kv.second.str_value;
 		} else if (kv.first == "filename") {
 			result->include_file_name = kv.second.value_.boolean;
+		} else if (kv.first == "parallel") {
+			result->parallel = kv.second.value_.boolean;
 		}
 	}
 	if (!options.auto_detect && return_types.empty()) {
@@ -121,9 +172,13 @@ static unique_ptr<FunctionData> ReadCSVBind(ClientContext &context, vector<Value
 
 		return_types.assign(initial_reader->sql_types.begin(), initial_reader->sql_types.end());
 		names.assign(initial_reader->col_names.begin(), initial_reader->col_names.end());
+		result->sql_types = initial_reader->sql_types;
+		result->range_options = initial_reader->options;
+		result->range_options.auto_detect = false;
 		result->initial_reader = move(initial_reader);
 	} else {
 		result->sql_types = return_types;
+		result->range_options = options;
 		D_ASSERT(return_types.size() == names.size());
 	}
 	if (result->include_file_name) {
@@ -133,11 +188,119 @@ static unique_ptr<FunctionData> ReadCSVBind(ClientContext &context, vector<Value
 	return move(result);
 }
 
+struct ReadCSVParallelState : public ParallelState {
+	explicit ReadCSVParallelState(vector<CSVFileRange> ranges_p)
+	    : ranges(move(ranges_p)), next_range(0), quote_counts(ranges.size(), INVALID_INDEX),
+	      range_ends(ranges.size(), INVALID_INDEX), aborted(false) {
+	}
+
+	mutex lock;
+	//! The byte ranges of the files, in the order of the files
+	vector<CSVFileRange> ranges;
+	//! The next byte range to read
+	idx_t next_range;
+	//! The amount of quotes in every byte range (INVALID_INDEX if they have not been counted (yet))
+	vector<idx_t> quote_counts;
+	//! For every byte range: the offset of the row after the last row of the range (INVALID_INDEX if not known yet)
+	vector<idx_t> range_ends;
+	//! Signaled when the quotes of a range have been counted or the end of a range is known
+	std::condition_variable range_progress;
+	//! Whether or not a thread has stopped without finishing its range
+	bool aborted;
+
+public:
+	//! Hands out the next byte range to read, returns false if there are none left
+	bool NextRange(idx_t &range_index) {
+		lock_guard<mutex> parallel_lock(lock);
+		if (aborted || next_range >= ranges.size()) {
+			return false;
+		}
+		range_index = next_range++;
+		return true;
+	}
+
+	void SetQuoteCount(idx_t range_index, idx_t quote_count) {
+		lock_guard<mutex> parallel_lock(lock);
+		quote_counts[range_index] = quote_count;
+		range_progress.notify_all();
+	}
+
+	//! Waits until the quotes that precede the range in its file have been counted. A range starts within quotes if
+	//! an odd amount of quotes precedes it. Returns false if a thread stopped without counting its quotes.
+	bool WaitForStartInQuotes(idx_t range_index, bool &start_in_quotes) {
+		auto file_index = ranges[range_index].file_index;
+		idx_t first_range = range_index;
+		while (first_range > 0 && ranges[first_range - 1].file_index == file_index) {
+			first_range--;
+		}
+		std::unique_lock<mutex> parallel_lock(lock);
+		// the preceding ranges have been handed out before this one, their threads count the quotes right away
+		range_progress.wait(parallel_lock, [&] {
+			return aborted || std::find(quote_counts.begin() + first_range, quote_counts.begin() + range_index,
+			                            INVALID_INDEX) == quote_counts.begin() + range_index;
+		});
+		if (aborted) {
+			return false;
+		}
+		idx_t quote_count = 0;
+		for (idx_t i = first_range; i < range_index; i++) {
+			quote_count += quote_counts[i];
+		}
+		start_in_quotes = quote_count % 2 == 1;
+		return true;
+	}
+
+	//! Waits until the offset of the row after the last row of the range is known. Returns false if a thread stopped
+	//! without finishing its range.
+	bool WaitForRangeEnd(idx_t range_index, idx_t &range_end) {
+		std::unique_lock<mutex> parallel_lock(lock);
+		// only the rows of ranges that follow the range wait for it, so the thread of the first unfinished range never
+		// waits for its end and every range finishes eventually
+		range_progress.wait(parallel_lock, [&] { return aborted || range_ends[range_index] != INVALID_INDEX; });
+		if (aborted) {
+			return false;
+		}
+		range_end = range_ends[range_index];
+		return true;
+	}
+
+	void FinishRange(idx_t range_index, idx_t range_end) {
+		lock_guard<mutex> parallel_lock(lock);
+		range_ends[range_index] = range_end;
+		range_progress.notify_all();
+	}
+
+	//! Called when a thread stops without finishing its range (i.e. because of an error): threads waiting for it are
+	//! woken up and stop as well
+	void Abort() {
+		lock_guard<mutex> parallel_lock(lock);
+		aborted = true;
+		range_progress.notify_all();
+	}
+};
+
 struct ReadCSVOperatorData : public FunctionOperatorData {
+	~ReadCSVOperatorData() override {
+		if (parallel_state && !range_finished) {
+			// the thread did not finish its range: do not let other threads wait for it
+			parallel_state->Abort();
+		}
+	}
+
 	//! The CSV reader
 	unique_ptr<BufferedCSVReader> csv_reader;
 	//! The index of the next file to read (i.e. current file + 1)
 	idx_t file_index;
+	//! The state of the parallel reading (if the byte ranges of the files are read in parallel)
+	ReadCSVParallelState *parallel_state = nullptr;
+	//! The byte range that is currently read (parallel reading only)
+	idx_t range_index = INVALID_INDEX;
+	//! Whether or not the end of the current byte range is known to the other threads
+	bool range_finished = true;
+	//! The rows of the current byte range, if they have been read ahead before they are returned
+	ChunkCollection range_rows;
+	//! The next chunk of range_rows to return
+	idx_t range_chunk = 0;
 };
 
 static unique_ptr<FunctionOperatorData> ReadCSVInit(ClientContext &context, const FunctionData *bind_data_p,
@@ -154,6 +317,140 @@ static unique_ptr<FunctionOperatorData> ReadCSVInit(ClientContext &context, cons
 	return move(result);
 }
 
+static idx_t ReadCSVMaxThreads(ClientContext &context, const FunctionData *bind_data_p) {
+	auto &bind_data = (ReadCSVData &)*bind_data_p;
+	if (!bind_data.parallel) {
+		return 0;
+	}
+	if (bind_data.files.size() >= context.db->NumberOfThreads()) {
+		// every file is read as at least one range: no need to look at the file sizes
+		return bind_data.files.size();
+	}
+	return bind_data.GetRanges(context).size();
+}
+
+static unique_ptr<ParallelState> ReadCSVInitParallelState(ClientContext &context, const FunctionData *bind_data_p) {
+	auto &bind_data = (ReadCSVData &)*bind_data_p;
+	return make_unique<ReadCSVParallelState>(bind_data.GetRanges(context));
+}
+
+//! Start reading a byte range. A range that does not start at the beginning of its file starts at the first newline
+//! outside of quotes, which only lines up with the rows of the previous range if every quote before it opens or closes
+//! a quoted value. Its rows are therefore read ahead and only returned if the first row starts where the previous
+//! range ended; otherwise the range is read again from there. Returns false if another thread stopped reading.
+static bool ReadCSVStartRange(ClientContext &context, ReadCSVData &bind_data, ReadCSVOperatorData &data) {
+	auto &parallel_state = *data.parallel_state;
+	auto range_index = data.range_index;
+	auto &range = parallel_state.ranges[range_index];
+	auto options = bind_data.range_options;
+	options.file_path = bind_data.files[range.file_index];
+	if (range.end == INVALID_INDEX) {
+		// the range covers the entire file
+		data.csv_reader = make_unique<BufferedCSVReader>(context, move(options), bind_data.sql_types);
+		return true;
+	}
+	const auto &quote = options.quote;
+	auto &ranges = parallel_state.ranges;
+	bool next_range_in_file = range_index + 1 < ranges.size() && ranges[range_index + 1].file_index == range.file_index;
+	if (!quote.empty() && next_range_in_file) {
+		// the quotes of the range are only needed to find out where the ranges after it start
+		auto &fs = FileSystem::GetFileSystem(context);
+		parallel_state.SetQuoteCount(range_index, CountQuotes(fs, options.file_path, range.start, range.end, quote[0]));
+	}
+	if (range.start == 0) {
+		data.csv_reader =
+		    make_unique<BufferedCSVReader>(context, move(options), bind_data.sql_types, range.start, range.end, false);
+		return true;
+	}
+	bool start_in_quotes = false;
+	if (!quote.empty() && !parallel_state.WaitForStartInQuotes(range_index, start_in_quotes)) {
+		return false;
+	}
+	// read the rows of the range ahead
+	BufferedCSVReader reader(context, options, bind_data.sql_types, range.start, range.end, start_in_quotes);
+	bool read_ahead = true;
+	try {
+		DataChunk chunk;
+		chunk.Initialize(bind_data.sql_types);
+		while (true) {
+			chunk.Reset();
+			reader.ParseCSV(chunk);
+			if (chunk.size() == 0) {
+				break;
+			}
+			data.range_rows.Append(chunk);
+		}
+	} catch (Exception &) {
+		// rows that do not start at a row boundary can fail to parse: the range is read again below
+		read_ahead = false;
+	}
+	idx_t first_row;
+	if (!parallel_state.WaitForRangeEnd(range_index - 1, first_row)) {
+		return false;
+	}
+	if (read_ahead && reader.range_first_row == first_row) {
+		parallel_state.FinishRange(range_index, reader.GetCurrentOffset());
+		data.range_finished = true;
+		return true;
+	}
+	// the range was not split up at a row boundary (e.g. because an unquoted value contains a quote): read it again,
+	// starting exactly at the row after the last row of the previous range
+	data.range_rows.Reset();
+	if (first_row >= range.end) {
+		// the last row of the previous range extends beyond this range: no rows start within it
+		parallel_state.FinishRange(range_index, first_row);
+		data.range_finished = true;
+		return true;
+	}
+	data.csv_reader =
+	    make_unique<BufferedCSVReader>(context, move(options), bind_data.sql_types, first_row, range.end, false);
+	return true;
+}
+
+static bool ReadCSVParallelStateNext(ClientContext &context, const FunctionData *bind_data_p,
+                                     FunctionOperatorData *operator_state, ParallelState *parallel_state_p) {
+	auto &bind_data = (ReadCSVData &)*bind_data_p;
+	auto &data = (ReadCSVOperatorData &)*operator_state;
+	auto &parallel_state = (ReadCSVParallelState &)*parallel_state_p;
+	data.parallel_state = &parallel_state;
+
+	if (data.csv_reader) {
+		// finished reading the previous range: the row after its last row is known now
+		if (!data.range_finished) {
+			parallel_state.FinishRange(data.range_index, data.csv_reader->GetCurrentOffset());
+			data.range_finished = true;
+		}
+		data.csv_reader.reset();
+	}
+	data.range_rows.Reset();
+	data.range_chunk = 0;
+	idx_t range_index;
+	if (!parallel_state.NextRange(range_index)) {
+		return false;
+	}
+	data.range_index = range_index;
+	data.range_finished = false;
+	return ReadCSVStartRange(context, bind_data, data);
+}
+
+static unique_ptr<FunctionOperatorData> ReadCSVParallelInit(ClientContext &context, const FunctionData *bind_data_p,
+                                                            ParallelState *parallel_state_p,
+                                                            vector<column_t> &column_ids,
+                                                            TableFilterCollection *filters) {
+	auto result = make_unique<ReadCSVOperatorData>();
+	if (!ReadCSVParallelStateNext(context, bind_data_p, result.get(), parallel_state_p)) {
+		return nullptr;
+	}
+	return move(result);
+}
+
+static idx_t ReadCSVGetBatchIndex(ClientContext &context, const FunctionData *bind_data_p,
+                                  FunctionOperatorData *operator_state, ParallelState *parallel_state_p) {
+	auto &data = (ReadCSVOperatorData &)*operator_state;
+	// the ranges are handed out in the order in which they appear in the files
+	return data.range_index;
+}
+
 static unique_ptr<FunctionData> ReadCSVAutoBind(ClientContext &context, vector<Value> &inputs,
                                                 unordered_map<string, Value> &named_parameters,
                                                 vector<LogicalType> &return_types, vector<string> &names) {
@@ -165,21 +462,39 @@ static void ReadCSVFunction(ClientContext &context, const FunctionData *bind_dat
                             FunctionOperatorData *operator_state, DataChunk &output) {
 	auto &bind_data = (ReadCSVData &)*bind_data_p;
 	auto &data = (ReadCSVOperatorData &)*operator_state;
-	do {
-		data.csv_reader->ParseCSV(output);
-		if (output.size() == 0 && data.file_index < bind_data.files.size()) {
-			// exhausted this file, but we have more files we can read
-			// open the next file and increment the counter
-			bind_data.options.file_path = bind_data.files[data.file_index];
-			data.csv_reader = make_unique<BufferedCSVReader>(context, bind_data.options, data.csv_reader->sql_types);
-			data.file_index++;
-		} else {
-			break;
+	if (data.parallel_state) {
+		if (data.csv_reader) {
+			data.csv_reader->ParseCSV(output);
+		} else if (data.range_chunk < data.range_rows.ChunkCount()) {
+			// return the rows that have been read ahead
+			auto &chunk = data.range_rows.GetChunk(data.range_chunk++);
+			for (idx_t col_idx = 0; col_idx < chunk.ColumnCount(); col_idx++) {
+				output.data[col_idx].Reference(chunk.data[col_idx]);
+			}
+			output.SetCardinality(chunk);
 		}
-	} while (true);
+	} else {
+		do {
+			data.csv_reader->ParseCSV(output);
+			if (output.size() == 0 && data.file_index < bind_data.files.size()) {
+				// exhausted this file, but we have more files we can read
+				// open the next file and increment the counter
+				bind_data.options.file_path = bind_data.files[data.file_index];
+				data.csv_reader =
+				    make_unique<BufferedCSVReader>(context, bind_data.options, data.csv_reader->sql_types);
+				data.file_index++;
+			} else {
+				break;
+			}
+		} while (true);
+	}
 	if (bind_data.include_file_name) {
 		auto &col = output.data.back();
-		col.SetValue(0, Value(data.csv_reader->options.file_path));
+		if (data.parallel_state) {
+			col.SetValue(0, Value(bind_data.files[data.parallel_state->ranges[data.range_index].file_index]));
+		} else {
+			col.SetValue(0, Value(data.csv_reader->options.file_path));
+		}
 		col.vector_type = VectorType::CONSTANT_VECTOR;
 	}
 }
@@ -201,11 +516,21 @@ static void ReadCSVAddNamedParameters(TableFunction &table_function) {
 	table_function.named_parameters["timestampformat"] = LogicalType::VARCHAR;
 	table_function.named_parameters["compression"] = LogicalType::VARCHAR;
 	table_function.named_parameters["filename"] = LogicalType::BOOLEAN;
+	table_function.named_parameters["parallel"] = LogicalType::BOOLEAN;
+}
+
+static void ReadCSVAddParallelCallbacks(TableFunction &table_function) {
+	table_function.max_threads = ReadCSVMaxThreads;
+	table_function.init_parallel_state = ReadCSVInitParallelState;
+	table_function.parallel_init = ReadCSVParallelInit;
+	table_function.parallel_state_next = ReadCSVParallelStateNext;
+	table_function.get_batch_index = ReadCSVGetBatchIndex;
 }
 
 TableFunction ReadCSVTableFunction::GetFunction() {
 	TableFunction read_csv("read_csv", {LogicalType::VARCHAR}, ReadCSVFunction, ReadCSVBind, ReadCSVInit);
 	ReadCSVAddNamedParameters(read_csv);
+	ReadCSVAddParallelCallbacks(read_csv);
 	return read_csv;
 }
 
@@ -214,6 +539,7 @@ void ReadCSVTableFunction::RegisterFunction(BuiltinFunctions &set) {
 
 	TableFunction read_csv_auto("read_csv_auto", {LogicalType::VARCHAR}, ReadCSVFunction, ReadCSVAutoBind, ReadCSVInit);
 	ReadCSVAddNamedParameters(read_csv_auto);
+	ReadCSVAddParallelCallbacks(read_csv_auto);
 	set.AddFunction(read_csv_auto);
 }
 
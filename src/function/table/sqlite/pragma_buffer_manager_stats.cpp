@@ -0,0 +1,72 @@
+#include "duckdb/function/table/sqlite_functions.hpp"
+
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+struct PragmaBufferManagerStatsData : public FunctionOperatorData {
+	PragmaBufferManagerStatsData() : finished(false) {
+	}
+
+	bool finished;
+};
+
+static unique_ptr<FunctionData> PragmaBufferManagerStatsBind(ClientContext &context, vector<Value> &inputs,
+                                                             unordered_map<string, Value> &named_parameters,
+                                                             vector<LogicalType> &return_types,
+                                                             vector<string> &names) {
+	names.emplace_back("eviction_policy");
+	return_types.push_back(LogicalType::VARCHAR);
+
+	names.emplace_back("hits");
+	return_types.push_back(LogicalType::BIGINT);
+
+	names.emplace_back("misses");
+	return_types.push_back(LogicalType::BIGINT);
+
+	names.emplace_back("evictions");
+	return_types.push_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<FunctionOperatorData> PragmaBufferManagerStatsInit(ClientContext &context, const FunctionData *bind_data,
+                                                              vector<column_t> &column_ids,
+                                                              TableFilterCollection *filters) {
+	return make_unique<PragmaBufferManagerStatsData>();
+}
+
+static string EvictionPolicyToString(BufferEvictionPolicy policy) {
+	switch (policy) {
+	case BufferEvictionPolicy::LRU:
+		return "LRU";
+	case BufferEvictionPolicy::TWO_QUEUE:
+		return "2Q";
+	default:
+		throw InternalException("Unrecognized eviction policy");
+	}
+}
+
+void PragmaBufferManagerStatsFunction(ClientContext &context, const FunctionData *bind_data,
+                                      FunctionOperatorData *operator_state, DataChunk &output) {
+	auto &data = (PragmaBufferManagerStatsData &)*operator_state;
+	if (data.finished) {
+		return;
+	}
+	auto &buffer_manager = BufferManager::GetBufferManager(context);
+
+	output.SetCardinality(1);
+	output.data[0].SetValue(0, Value(EvictionPolicyToString(buffer_manager.GetEvictionPolicy())));
+	output.data[1].SetValue(0, Value::BIGINT(buffer_manager.GetPinHits()));
+	output.data[2].SetValue(0, Value::BIGINT(buffer_manager.GetPinMisses()));
+	output.data[3].SetValue(0, Value::BIGINT(buffer_manager.GetEvictedBlocks()));
+
+	data.finished = true;
+}
+
+void PragmaBufferManagerStats::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("pragma_buffer_manager_stats", {}, PragmaBufferManagerStatsFunction,
+	                              PragmaBufferManagerStatsBind, PragmaBufferManagerStatsInit));
+}
+
+} // namespace duckdb
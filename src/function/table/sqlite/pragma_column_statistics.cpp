@@ -0,0 +1,92 @@
+#include "duckdb/function/table/sqlite_functions.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/parser/qualified_name.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/statistics/distinct_statistics.hpp"
+
+namespace duckdb {
+
+struct PragmaColumnStatisticsFunctionData : public TableFunctionData {
+	explicit PragmaColumnStatisticsFunctionData(TableCatalogEntry *table_p) : table(table_p) {
+	}
+
+	TableCatalogEntry *table;
+};
+
+struct PragmaColumnStatisticsOperatorData : public FunctionOperatorData {
+	PragmaColumnStatisticsOperatorData() : offset(0) {
+	}
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> PragmaColumnStatisticsBind(ClientContext &context, vector<Value> &inputs,
+                                                           unordered_map<string, Value> &named_parameters,
+                                                           vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("cid");
+	return_types.push_back(LogicalType::INTEGER);
+
+	names.emplace_back("name");
+	return_types.push_back(LogicalType::VARCHAR);
+
+	names.emplace_back("type");
+	return_types.push_back(LogicalType::VARCHAR);
+
+	names.emplace_back("has_null");
+	return_types.push_back(LogicalType::BOOLEAN);
+
+	names.emplace_back("approx_unique");
+	return_types.push_back(LogicalType::BIGINT);
+
+	auto qname = QualifiedName::Parse(inputs[0].GetValue<string>());
+
+	// look up the table name in the catalog
+	auto &catalog = Catalog::GetCatalog(context);
+	auto table = catalog.GetEntry<TableCatalogEntry>(context, qname.schema, qname.name);
+	return make_unique<PragmaColumnStatisticsFunctionData>(table);
+}
+
+unique_ptr<FunctionOperatorData> PragmaColumnStatisticsInit(ClientContext &context, const FunctionData *bind_data,
+                                                            vector<column_t> &column_ids,
+                                                            TableFilterCollection *filters) {
+	return make_unique<PragmaColumnStatisticsOperatorData>();
+}
+
+static void PragmaColumnStatisticsFunction(ClientContext &context, const FunctionData *bind_data_p,
+                                           FunctionOperatorData *operator_state, DataChunk &output) {
+	auto &bind_data = (PragmaColumnStatisticsFunctionData &)*bind_data_p;
+	auto &data = (PragmaColumnStatisticsOperatorData &)*operator_state;
+	auto table = bind_data.table;
+	if (data.offset >= table->columns.size()) {
+		// finished returning values
+		return;
+	}
+	// either fill up the chunk or return all the remaining columns
+	idx_t next = MinValue<idx_t>(data.offset + STANDARD_VECTOR_SIZE, table->columns.size());
+	output.SetCardinality(next - data.offset);
+
+	for (idx_t i = data.offset; i < next; i++) {
+		auto index = i - data.offset;
+		auto &column = table->columns[i];
+		auto stats = table->storage->GetStatistics(context, column.oid);
+
+		output.SetValue(0, index, Value::INTEGER((int32_t)column.oid));
+		output.SetValue(1, index, Value(column.name));
+		output.SetValue(2, index, Value(column.type.ToString()));
+		output.SetValue(3, index, stats ? Value::BOOLEAN(stats->has_null) : Value());
+		if (stats && stats->distinct_stats) {
+			output.SetValue(4, index, Value::BIGINT(stats->distinct_stats->GetCount()));
+		} else {
+			output.SetValue(4, index, Value());
+		}
+	}
+	data.offset = next;
+}
+
+void PragmaColumnStatistics::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("pragma_column_statistics", {LogicalType::VARCHAR}, PragmaColumnStatisticsFunction,
+	                              PragmaColumnStatisticsBind, PragmaColumnStatisticsInit));
+}
+
+} // namespace duckdb
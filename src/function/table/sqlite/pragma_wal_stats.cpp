@@ -0,0 +1,69 @@
+#include "duckdb/function/table/sqlite_functions.hpp"
+
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/storage_manager.hpp"
+
+namespace duckdb {
+
+struct PragmaWALStatsData : public FunctionOperatorData {
+	PragmaWALStatsData() : finished(false) {
+	}
+
+	bool finished;
+};
+
+static unique_ptr<FunctionData> PragmaWALStatsBind(ClientContext &context, vector<Value> &inputs,
+                                                   unordered_map<string, Value> &named_parameters,
+                                                   vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("commits");
+	return_types.push_back(LogicalType::BIGINT);
+
+	names.emplace_back("syncs");
+	return_types.push_back(LogicalType::BIGINT);
+
+	names.emplace_back("commits_per_sync");
+	return_types.push_back(LogicalType::DOUBLE);
+
+	names.emplace_back("commit_delay");
+	return_types.push_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<FunctionOperatorData> PragmaWALStatsInit(ClientContext &context, const FunctionData *bind_data,
+                                                    vector<column_t> &column_ids, TableFilterCollection *filters) {
+	return make_unique<PragmaWALStatsData>();
+}
+
+void PragmaWALStatsFunction(ClientContext &context, const FunctionData *bind_data,
+                            FunctionOperatorData *operator_state, DataChunk &output) {
+	auto &data = (PragmaWALStatsData &)*operator_state;
+	if (data.finished) {
+		return;
+	}
+	auto &storage = StorageManager::GetStorageManager(context);
+	auto log = storage.GetWriteAheadLog();
+
+	output.SetCardinality(1);
+	if (log) {
+		auto commits = log->GetCommitCount();
+		auto syncs = log->GetSyncCount();
+		output.data[0].SetValue(0, Value::BIGINT(commits));
+		output.data[1].SetValue(0, Value::BIGINT(syncs));
+		output.data[2].SetValue(0, syncs == 0 ? Value() : Value::DOUBLE(double(commits) / double(syncs)));
+	} else {
+		output.data[0].SetValue(0, Value());
+		output.data[1].SetValue(0, Value());
+		output.data[2].SetValue(0, Value());
+	}
+	output.data[3].SetValue(0, Value::BIGINT(DBConfig::GetConfig(context).wal_commit_delay));
+
+	data.finished = true;
+}
+
+void PragmaWALStats::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(
+	    TableFunction("pragma_wal_stats", {}, PragmaWALStatsFunction, PragmaWALStatsBind, PragmaWALStatsInit));
+}
+
+} // namespace duckdb
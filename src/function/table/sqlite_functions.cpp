@@ -15,6 +15,9 @@ void BuiltinFunctions::RegisterSQLiteFunctions() {
 	PragmaTableInfo::RegisterFunction(*this);
 	SQLiteMaster::RegisterFunction(*this);
 	PragmaDatabaseSize::RegisterFunction(*this);
+	PragmaBufferManagerStats::RegisterFunction(*this);
+	PragmaWALStats::RegisterFunction(*this);
+	PragmaColumnStatistics::RegisterFunction(*this);
 	PragmaDatabaseList::RegisterFunction(*this);
 
 	// CreateViewInfo info;
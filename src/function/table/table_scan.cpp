@@ -27,6 +27,8 @@ struct TableScanOperatorData : public FunctionOperatorData {
 	//! The current position in the scan
 	TableScanState scan_state;
 	vector<column_t> column_ids;
+	//! The first row of the morsel that is currently scanned (parallel scans only)
+	idx_t batch_index;
 };
 
 static unique_ptr<FunctionOperatorData> TableScanInit(ClientContext &context, const FunctionData *bind_data_p,
@@ -96,10 +98,19 @@ bool TableScanParallelStateNext(ClientContext &context, const FunctionData *bind
 	auto &state = (TableScanOperatorData &)*operator_state;
 
 	lock_guard<mutex> parallel_lock(parallel_state.lock);
+	// morsels are handed out in order: the first row of the morsel identifies its position in the scan
+	// the transaction-local data is scanned last, and starts after all rows of the base table
+	state.batch_index = parallel_state.state.current_row;
 	return bind_data.table->storage->NextParallelScan(context, parallel_state.state, state.scan_state,
 	                                                  state.column_ids);
 }
 
+idx_t TableScanGetBatchIndex(ClientContext &context, const FunctionData *bind_data_p,
+                             FunctionOperatorData *operator_state, ParallelState *parallel_state_p) {
+	auto &state = (TableScanOperatorData &)*operator_state;
+	return state.batch_index;
+}
+
 void TableScanDependency(unordered_set<CatalogEntry *> &entries, const FunctionData *bind_data_p) {
 	auto &bind_data = (const TableScanBindData &)*bind_data_p;
 	entries.insert(bind_data.table);
@@ -301,6 +312,7 @@ void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, Fun
 				get.function.max_threads = nullptr;
 				get.function.init_parallel_state = nullptr;
 				get.function.parallel_state_next = nullptr;
+				get.function.get_batch_index = nullptr;
 				get.function.filter_pushdown = false;
 			} else {
 				bind_data.result_ids.clear();
@@ -328,6 +340,7 @@ TableFunction TableScanFunction::GetFunction() {
 	scan_function.init_parallel_state = TableScanInitParallelState;
 	scan_function.parallel_init = TableScanParallelInit;
 	scan_function.parallel_state_next = TableScanParallelStateNext;
+	scan_function.get_batch_index = TableScanGetBatchIndex;
 	scan_function.projection_pushdown = true;
 	scan_function.filter_pushdown = true;
 	return scan_function;
@@ -0,0 +1,22 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/buffer_eviction_policy.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! The order in which the buffer manager evicts unpinned blocks
+//! - LRU evicts the least recently unpinned block first
+//! - TWO_QUEUE (2Q) keeps blocks that are loaded for the first time in a probationary queue that is evicted first.
+//! Blocks that are loaded again shortly after being evicted from it are protected, so that a large scan cannot flush
+//! the blocks that are used frequently.
+enum class BufferEvictionPolicy : uint8_t { LRU = 0, TWO_QUEUE = 1 };
+
+} // namespace duckdb
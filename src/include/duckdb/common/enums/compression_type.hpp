@@ -0,0 +1,23 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/compression_type.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! The compression scheme used for a persistent segment
+//! - RLE stores every vector as a list of (value, run length) pairs
+//! - BITPACKING stores every value using the amount of bits required for the maximum value of the segment
+//! - FOR (frame-of-reference) stores the difference with the minimum value of the segment, using the amount of bits
+//! required for the difference between the maximum and the minimum
+//! - DICTIONARY stores every distinct string once, and a code that refers to the string for every row
+enum class CompressionType : uint8_t { UNCOMPRESSED = 0, RLE = 1, BITPACKING = 2, FOR = 3, DICTIONARY = 4 };
+
+} // namespace duckdb
@@ -0,0 +1,101 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/file_handle_stream.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/thread.hpp"
+
+#include <condition_variable>
+#include <istream>
+
+namespace duckdb {
+
+//! A read-only stream buffer that reads a file through the FileSystem, so that files of all registered file systems
+//! can be read as a std::istream. Reads are positional and happen in large blocks. While the current block is consumed,
+//! the next block is read in the background by a single prefetch thread that lives as long as the stream. Reads that
+//! span an entire block that is not read in the background are read directly into the target.
+class FileHandleStreamBuf : public std::streambuf {
+public:
+	//! The amount of bytes that are read from the file at once
+	static constexpr idx_t BUFFER_SIZE = 1048576;
+
+public:
+	FileHandleStreamBuf(FileSystem &fs, const string &path);
+	~FileHandleStreamBuf() override;
+
+	FileHandleStreamBuf(const FileHandleStreamBuf &) = delete;
+	FileHandleStreamBuf &operator=(const FileHandleStreamBuf &) = delete;
+
+	idx_t GetFileSize() {
+		return file_size;
+	}
+
+protected:
+	std::streambuf::int_type underflow() override;
+	std::streamsize xsgetn(char *s, std::streamsize n) override;
+	std::streambuf::pos_type seekoff(std::streambuf::off_type off, std::ios_base::seekdir dir,
+	                                 std::ios_base::openmode which) override;
+	std::streambuf::pos_type seekpos(std::streambuf::pos_type pos, std::ios_base::openmode which) override;
+
+private:
+	//! Returns the offset in the file of the next byte that is read
+	idx_t GetPosition() {
+		return buffer_offset + (gptr() - eback());
+	}
+	//! Start reading the block at the given offset into the prefetch buffer in the background
+	void StartPrefetch(idx_t offset);
+	//! Wait for the background read (if any) to finish. If the read failed, the prefetched block is discarded.
+	void FinishPrefetch();
+	//! The loop of the prefetch thread, which reads the requested blocks until the stream is destroyed
+	void PrefetchBlocks();
+
+	FileSystem &fs;
+	unique_ptr<FileHandle> handle;
+	idx_t file_size;
+	//! The buffered part of the file
+	unique_ptr<char[]> buffer;
+	//! The offset in the file of the start of the buffer
+	idx_t buffer_offset;
+	//! The block of the file that is read in the background
+	unique_ptr<char[]> prefetch_buffer;
+	//! The offset in the file and the size of the block in the prefetch buffer (INVALID_INDEX if there is none)
+	idx_t prefetch_offset;
+	idx_t prefetch_size;
+	//! The thread that reads the blocks in the background, started by the first prefetch
+	unique_ptr<thread> prefetch_thread;
+	//! The lock and condition variable with which blocks are requested from and handed over by the prefetch thread
+	mutex prefetch_lock;
+	std::condition_variable prefetch_condition;
+	//! Whether or not a block has been requested that the prefetch thread has not finished reading yet
+	bool prefetch_requested;
+	//! Whether or not the last read of the prefetch thread failed
+	bool prefetch_failed;
+	//! Whether or not the prefetch thread should stop
+	bool prefetch_shutdown;
+};
+
+class FileHandleStream : public std::istream {
+public:
+	FileHandleStream(FileSystem &fs, const string &path) : std::istream(new FileHandleStreamBuf(fs, path)) {
+		exceptions(std::ios_base::badbit);
+	}
+	~FileHandleStream() override {
+		if (rdbuf()) {
+			delete rdbuf();
+		}
+	}
+
+	idx_t GetFileSize() {
+		return ((FileHandleStreamBuf *)rdbuf())->GetFileSize();
+	}
+};
+
+} // namespace duckdb
@@ -13,6 +13,7 @@
 #include "duckdb/common/vector.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/mutex.hpp"
 
 #include <functional>
 
@@ -77,11 +78,14 @@ public:
 	unique_ptr<FileHandle> OpenFile(string &path, uint8_t flags, FileLockType lock = FileLockType::NO_LOCK) {
 		return OpenFile(path.c_str(), flags, lock);
 	}
-	//! Read exactly nr_bytes from the specified location in the file. Fails if nr_bytes could not be read. This is
-	//! equivalent to calling SetFilePointer(location) followed by calling Read().
+	//! Read exactly nr_bytes from the specified location in the file. Fails if nr_bytes could not be read. Handles of
+	//! the local file system are read without moving the file pointer, so positional reads and writes on the same
+	//! handle can happen concurrently. Other handles are read by calling SetFilePointer(location) followed by
+	//! Read(), serialized by a lock.
 	virtual void Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location);
-	//! Write exactly nr_bytes to the specified location in the file. Fails if nr_bytes could not be read. This is
-	//! equivalent to calling SetFilePointer(location) followed by calling Write().
+	//! Write exactly nr_bytes to the specified location in the file. Fails if nr_bytes could not be written. Handles
+	//! of the local file system are written without moving the file pointer. Other handles are written by calling
+	//! SetFilePointer(location) followed by Write(), serialized by a lock.
 	virtual void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location);
 	//! Read nr_bytes from the specified file into the buffer, moving the file pointer forward by nr_bytes. Returns the
 	//! amount of bytes read.
@@ -137,9 +141,13 @@ public:
 		throw NotImplementedException("Can't register a protocol handler on a non-virtual file system");
 	}
 
-private:
+protected:
 	//! Set the file pointer of a file handle to a specified location. Reads and writes will happen from this location
-	void SetFilePointer(FileHandle &handle, idx_t location);
+	virtual void SetFilePointer(FileHandle &handle, idx_t location);
+
+private:
+	//! Serializes the positional reads and writes of handles that are read and written at the file pointer
+	mutex file_pointer_lock;
 };
 
 // bunch of wrappers to allow registering protocol handlers
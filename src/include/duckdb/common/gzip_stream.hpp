@@ -9,15 +9,15 @@
 #pragma once
 
 #include "duckdb/common/constants.hpp"
+#include "duckdb/common/file_system.hpp"
 
-#include <fstream>
-#include <sstream>
+#include <istream>
 
 namespace duckdb {
 
 class GzipStreamBuf : public std::streambuf {
 public:
-	explicit GzipStreamBuf(std::string filename) : filename(filename) {
+	GzipStreamBuf(FileSystem &fs, std::string filename) : fs(fs), filename(filename) {
 	}
 
 	GzipStreamBuf(const GzipStreamBuf &) = delete;
@@ -31,19 +31,26 @@ public:
 
 private:
 	void Initialize();
-
-	std::fstream input;
+	//! Read the next block of the file into the input buffer, returns the amount of bytes read
+	idx_t ReadInput();
+
+	FileSystem &fs;
+	unique_ptr<FileHandle> input;
+	//! The size of the compressed file
+	idx_t file_size = 0;
+	//! The offset in the file at which the next block is read
+	idx_t read_position = 0;
 	idx_t data_start = 0;
 	void *mz_stream_ptr = nullptr; // void* so we don't have to include the header
 	data_ptr_t in_buff = nullptr, in_buff_start, in_buff_end, out_buff = nullptr; // various buffers & pointers
 	bool is_initialized = false;
 	std::string filename;
-	idx_t BUFFER_SIZE = 1024;
+	idx_t BUFFER_SIZE = 65536;
 };
 
 class GzipStream : public std::istream {
 public:
-	explicit GzipStream(std::string filename) : std::istream(new GzipStreamBuf(filename)) {
+	GzipStream(FileSystem &fs, std::string filename) : std::istream(new GzipStreamBuf(fs, filename)) {
 		exceptions(std::ios_base::badbit);
 	}
 	~GzipStream() override {
@@ -101,6 +101,10 @@ public:
 	}
 
 	void Sort(vector<OrderType> &desc, vector<OrderByNullType> &null_order, idx_t result[]);
+	//! Compares the row at left_idx in left with the row at right_idx in right on the first desc.size() columns.
+	//! Returns a negative number if left sorts before right, 0 if they are equal and a positive number otherwise.
+	static int CompareRows(DataChunk &left, idx_t left_idx, DataChunk &right, idx_t right_idx,
+	                       vector<OrderType> &desc, vector<OrderByNullType> &null_order);
 	//! Reorders the rows in the collection according to the given indices. NB: order is changed!
 	void Reorder(idx_t order[]);
 
@@ -11,6 +11,8 @@
 #include "duckdb/common/types/vector.hpp"
 
 namespace duckdb {
+class Serializer;
+class Deserializer;
 
 //! The HyperLogLog class holds a HyperLogLog counter for approximate cardinality counting
 class HyperLogLog {
@@ -22,6 +24,9 @@ public:
 
 	//! Adds an element of the specified size to the HyperLogLog counter
 	void Add(data_ptr_t element, idx_t size);
+	//! Adds a batch of hashed elements to the HyperLogLog counter. This converts the counter to the dense
+	//! representation, which takes up more space but is much faster to add to than the sparse representation.
+	void AddHashes(hash_t hashes[], idx_t count);
 	//! Return the count of this HyperLogLog counter
 	idx_t Count();
 	//! Merge this HyperLogLog counter with another counter to create a new one
@@ -29,6 +34,13 @@ public:
 	HyperLogLog *MergePointer(HyperLogLog &other);
 	//! Merge a set of HyperLogLogs to create one big one
 	static unique_ptr<HyperLogLog> Merge(HyperLogLog logs[], idx_t count);
+	//! Create an explicit copy of this HyperLogLog counter
+	unique_ptr<HyperLogLog> Copy();
+
+	//! Serialize the registers of the HyperLogLog counter
+	void Serialize(Serializer &serializer);
+	//! Deserialize a HyperLogLog counter written by Serialize
+	static unique_ptr<HyperLogLog> Deserialize(Deserializer &source);
 
 private:
 	HyperLogLog(void *hll);
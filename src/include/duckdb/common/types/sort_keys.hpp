@@ -0,0 +1,70 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/types/sort_keys.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/enums/order_type.hpp"
+#include "duckdb/common/types/data_chunk.hpp"
+
+namespace duckdb {
+
+//! SortKeys holds normalized sort keys for a set of rows. The sort key of a row is a fixed-width byte string that
+//! encodes the ORDER BY columns (including the ordering and NULL ordering) such that comparing two keys with memcmp
+//! yields the same result as comparing the rows column by column. VARCHAR columns only store a prefix of the string in
+//! the key, the full strings are compared only when the prefixes of two keys are equal.
+class SortKeys {
+public:
+	SortKeys(const vector<LogicalType> &types, const vector<OrderType> &order_types,
+	         const vector<OrderByNullType> &null_order_types);
+
+	//! The amount of bytes of a VARCHAR that are stored in the key
+	static constexpr idx_t STRING_PREFIX_LENGTH = 12;
+
+	//! Whether or not sort keys can be constructed for columns of the given types
+	static bool CanEncode(const vector<LogicalType> &types);
+
+	//! The amount of rows in the SortKeys
+	idx_t Count() {
+		return count;
+	}
+	//! Encode the keys of the first key columns of the chunk and append them
+	void Append(DataChunk &chunk);
+	//! Sort the rows using a radix sort on the keys, result[i] is set to the index of the i-th row in sorted order
+	void Sort(idx_t result[]);
+	//! Compares the rows at the given indices. Returns a negative number if left sorts before right, 0 if they are
+	//! equal and a positive number otherwise.
+	int Compare(idx_t left, idx_t right);
+
+private:
+	//! The physical types of the key columns
+	vector<PhysicalType> types;
+	vector<OrderType> order_types;
+	vector<OrderByNullType> null_order_types;
+	//! The byte offset of every column within a key
+	vector<idx_t> offsets;
+	//! The width of a single key in bytes
+	idx_t key_width;
+	//! The amount of rows
+	idx_t count;
+	//! The keys, stored consecutively
+	vector<data_t> keys;
+	//! For VARCHAR columns: the full strings of every row, used when the prefixes in the key are equal
+	vector<vector<string_t>> strings;
+	//! For VARCHAR columns: whether or not equal prefixes can belong to different strings
+	vector<bool> prefix_ties;
+
+	data_ptr_t GetKey(idx_t index) {
+		return keys.data() + index * key_width;
+	}
+	void EncodeColumn(idx_t col_idx, Vector &vector, idx_t chunk_count);
+	//! MSD radix sort on the bytes [offset, radix_end) of the keys. If compare_ties is set, rows that are equal on all
+	//! of these bytes are ordered using Compare.
+	void RadixSort(idx_t *indices, idx_t *temp, idx_t sort_count, idx_t offset, idx_t radix_end, bool compare_ties);
+};
+
+} // namespace duckdb
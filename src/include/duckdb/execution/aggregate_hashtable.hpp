@@ -99,6 +99,16 @@ public:
 	void Partition(vector<GroupedAggregateHashTable *> &partition_hts, hash_t mask, idx_t shift);
 
 	void Finalize();
+	bool IsFinalized() {
+		return is_finalized;
+	}
+
+	//! Unpin the payload blocks of a finalized HT, allowing the buffer manager to offload them to disk
+	void Unpin();
+	//! Pin the payload blocks of the HT again, this has to happen before the HT is combined, partitioned or scanned
+	void Pin();
+	//! The amount of memory used by the payload blocks and (if not finalized) the hashes of the HT
+	idx_t SizeInBytes();
 
 	//! The stringheap of the AggregateHashTable
 	StringHeap string_heap;
@@ -120,6 +130,8 @@ private:
 	//! The amount of entries stored in the HT currently
 	idx_t entries;
 	//! The data of the HT
+	vector<shared_ptr<BlockHandle>> payload_blocks;
+	//! The pins of the payload blocks, empty if the HT is unpinned
 	vector<unique_ptr<BufferHandle>> payload_hds;
 	vector<data_ptr_t> payload_hds_ptrs;
 
@@ -20,6 +20,7 @@ class ClientContext;
 class DataChunk;
 class PhysicalOperator;
 class PhysicalOperatorState;
+class PhysicalResultCollector;
 class ThreadContext;
 class Task;
 
@@ -36,7 +37,10 @@ public:
 	ClientContext &context;
 
 public:
-	void Initialize(PhysicalOperator *physical_plan);
+	//! Initialize the executor for the given plan, and execute all pipelines that the final pipeline depends on. If
+	//! collect_result is set the final pipeline may be executed in parallel as well, in which case the entire result
+	//! is materialized before FetchChunk is called.
+	void Initialize(PhysicalOperator *physical_plan, bool collect_result = false);
 	void BuildPipelines(PhysicalOperator *op, Pipeline *parent);
 
 	void Reset();
@@ -54,6 +58,8 @@ public:
 private:
 	PhysicalOperator *physical_plan;
 	unique_ptr<PhysicalOperatorState> physical_state;
+	//! The sink that collects the result of the plan, if the final pipeline is executed in parallel
+	unique_ptr<PhysicalResultCollector> result_collector;
 
 	mutex executor_lock;
 	//! The pipelines of the current query
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/parser/parsed_expression.hpp"
@@ -23,7 +24,17 @@
 #include "duckdb/execution/index/art/node48.hpp"
 #include "duckdb/execution/index/art/node256.hpp"
 
+#include <functional>
+
 namespace duckdb {
+class BlockHandle;
+class DatabaseInstance;
+class MetaBlockWriter;
+struct ARTConstructState;
+
+//! The amount of optimistic readers of an ART that can announce the epoch in which they started
+static constexpr idx_t ART_READER_SLOTS = 64;
+
 struct IteratorEntry {
 	IteratorEntry() {
 	}
@@ -47,6 +58,14 @@ struct Iterator {
 	void SetEntry(idx_t depth, IteratorEntry entry);
 };
 
+//! Nodes and arrays that writers removed from the tree together, with the epoch in which they were retired
+struct ARTRetiredBatch {
+	uint64_t epoch;
+	vector<unique_ptr<Node>> nodes;
+	vector<unique_ptr<uint8_t[]>> prefixes;
+	vector<unique_ptr<row_t[]>> row_ids;
+};
+
 struct ARTIndexScanState : public IndexScanState {
 	ARTIndexScanState() : checked(false), result_index(0) {
 	}
@@ -69,10 +88,19 @@ public:
 
 	//! Root of the tree
 	unique_ptr<Node> tree;
+	//! Version of the root of the tree, which optimistic readers validate in the same way as the version of a node
+	std::atomic<uint64_t> root_version;
 	//! True if machine is little endian
 	bool is_little_endian;
 	//! Whether or not the ART is an index built to enforce a UNIQUE constraint
 	bool is_unique;
+	//! The database the ART has been loaded from, or nullptr if the ART has not been loaded from storage
+	DatabaseInstance *db;
+	//! The blocks nodes have been loaded from
+	unordered_map<block_id_t, shared_ptr<BlockHandle>> loaded_blocks;
+	//! The blocks that store the nodes of the tree in storage, with the amount of bytes of the nodes stored in each
+	//! block. A block is freed once none of the nodes it stores are part of the tree anymore.
+	unordered_map<block_id_t, idx_t> block_usage;
 
 public:
 	//! Initialize a scan on the index with the given expression and column ids
@@ -97,28 +125,87 @@ public:
 	void Delete(IndexLock &lock, DataChunk &entries, Vector &row_identifiers) override;
 	//! Insert data into the index.
 	bool Insert(IndexLock &lock, DataChunk &data, Vector &row_ids) override;
-
+	//! Construct the ART from all entries of a table at once: the keys are sorted in parallel and the tree is built
+	//! bottom-up in parallel, with every node created at its final size
+	bool Construct(DatabaseInstance &db, IndexLock &lock, ChunkCollection &input) override;
+
+	//! Write the nodes of the ART that have changed since the last checkpoint to storage, returns the location of the
+	//! index. Unchanged subtrees keep their location in storage, and are not loaded.
+	IndexPointer Serialize(DatabaseInstance &db);
+	//! Load the root node of the ART from storage, the other nodes are loaded when they are first accessed
+	void Deserialize(DatabaseInstance &db, IndexPointer &pointer);
+	//! Free the blocks that store the nodes of the ART
+	void CommitDrop() override;
+
+	//! Search Equal, does not require the lock of the index
 	bool SearchEqual(ARTIndexScanState *state, idx_t max_count, vector<row_t> &result_ids);
-	//! Search Equal used for Joins that do not need to fetch data
+	//! Search Equal used for Joins that do not need to fetch data, does not require the lock of the index
 	void SearchEqualJoinNoFetch(Value &equal_value, idx_t &result_size);
 
+	//! Remove a node from the tree. The node is freed once no optimistic reader can be accessing it anymore.
+	void RetireNode(unique_ptr<Node> node);
+	//! Free the prefix of a node once no optimistic reader can be accessing it anymore
+	void RetirePrefix(unique_ptr<uint8_t[]> prefix);
+	//! Free the row ids of a leaf once no optimistic reader can be accessing them anymore
+	void RetireRowIds(unique_ptr<row_t[]> row_ids);
+	//! Account for a node that has been written to the given blocks
+	void AddNodeBlocks(BlockPointer pointer, idx_t size, const vector<block_id_t> &blocks);
+	//! The copy of the node in storage is no longer part of the tree: free the blocks that no longer store any node
+	void ReleaseNode(Node &node);
+	//! Whether or not less than a quarter of the block is used by the nodes of the tree. The nodes stored in such a
+	//! block are written again by a checkpoint, so the block can be freed.
+	bool IsSparseBlock(block_id_t block_id);
+	//! The amount of nodes and arrays that have been retired, but that have not been freed yet
+	idx_t RetiredCount();
+	//! Announce the epoch in which an optimistic reader starts, returns the slot of the reader
+	idx_t EnterReader();
+	//! Remove the optimistic reader in the given slot
+	void LeaveReader(idx_t slot);
+
 private:
 	DataChunk expression_result;
+	//! The epoch of the ART, incremented every time a batch of nodes is retired
+	std::atomic<uint64_t> current_epoch;
+	//! The epochs in which the optimistic readers that are traversing the tree started, 0 marks an unused slot
+	std::atomic<uint64_t> reader_epochs[ART_READER_SLOTS];
+	//! The amount of optimistic readers that did not find an unused slot, no batch is freed while these are active
+	std::atomic<idx_t> overflow_readers;
+	//! Nodes and arrays that writers removed from the tree since the last batch was retired
+	vector<unique_ptr<Node>> retired_nodes;
+	vector<unique_ptr<uint8_t[]>> retired_prefixes;
+	vector<unique_ptr<row_t[]>> retired_row_ids;
+	//! The retired batches that optimistic readers might still be accessing, in the order in which they were retired
+	vector<ARTRetiredBatch> retired_batches;
 
 private:
 	//! Insert a row id into a leaf node
 	bool InsertToLeaf(Leaf &leaf, row_t row_id);
-	//! Insert the leaf value into the tree
-	bool Insert(unique_ptr<Node> &node, unique_ptr<Key> key, unsigned depth, row_t row_id);
+	//! Insert the leaf value into the tree. The parent version is the version of the node holding "node", or the
+	//! version of the root.
+	bool Insert(unique_ptr<Node> &node, unique_ptr<Key> key, unsigned depth, row_t row_id,
+	            std::atomic<uint64_t> &parent_version);
+	//! Construct the subtree of the sorted entries [start, end) at the given depth. If "subtrees" is set, small
+	//! subtrees are not constructed but added to "subtrees" so they can be constructed in parallel.
+	void ConstructNode(ARTConstructState &state, idx_t start, idx_t end, idx_t depth, unique_ptr<Node> &node,
+	                   vector<std::function<void()>> *subtrees);
 
 	//! Erase element from leaf (if leaf has more than one value) or eliminate the leaf itself
-	void Erase(unique_ptr<Node> &node, Key &key, unsigned depth, row_t row_id);
+	void Erase(unique_ptr<Node> &node, Key &key, unsigned depth, row_t row_id, std::atomic<uint64_t> &parent_version);
+	//! Retire the nodes and arrays that have been removed from the tree as a batch, and free the batches that were
+	//! retired before all active optimistic readers started. Requires the lock of the index.
+	void FreeRetired();
 
 	//! Check if the key of the leaf is equal to the searched key
 	bool LeafMatches(Node *node, Key &key, unsigned depth);
 
-	//! Find the node with a matching key, optimistic version
+	//! Find the node with a matching key. Requires the lock of the index.
 	Node *Lookup(unique_ptr<Node> &node, Key &key, unsigned depth);
+	//! Find the row ids of the key without locking the index. Returns false if a writer concurrently modified one of
+	//! the nodes that were read, in which case the lookup has to be repeated, or if a node still has to be loaded from
+	//! storage (requires_load), in which case the lookup has to be performed under the lock.
+	bool OptimisticLookup(Key &key, vector<row_t> &result_ids, bool &requires_load);
+	//! Find the row ids of the key. The lookup is optimistic, unless it keeps conflicting with writers.
+	void LookupRowIds(Key &key, vector<row_t> &result_ids);
 
 	//! Find the first node that is bigger (or equal to) a specific key
 	bool Bound(unique_ptr<Node> &node, Key &key, Iterator &iterator, bool inclusive);
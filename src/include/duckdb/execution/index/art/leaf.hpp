@@ -15,6 +15,7 @@ namespace duckdb {
 class Leaf : public Node {
 public:
 	Leaf(ART &art, unique_ptr<Key> value, row_t row_id);
+	Leaf(ART &art, unique_ptr<Key> value, unique_ptr<row_t[]> row_ids, idx_t num_elements);
 
 	unique_ptr<Key> value;
 	idx_t capacity;
@@ -25,7 +26,7 @@ public:
 	}
 
 public:
-	void Insert(row_t row_id);
+	void Insert(ART &art, row_t row_id);
 	void Remove(row_t row_id);
 
 private:
@@ -10,15 +10,23 @@
 
 #include "duckdb/execution/index/art/art_key.hpp"
 #include "duckdb/common/common.hpp"
+#include "duckdb/storage/storage_info.hpp"
+
+#include <atomic>
 
 namespace duckdb {
-enum class NodeType : uint8_t { N4 = 0, N16 = 1, N48 = 2, N256 = 3, NLeaf = 4 };
+enum class NodeType : uint8_t { N4 = 0, N16 = 1, N48 = 2, N256 = 3, NLeaf = 4, NPersistent = 5 };
 
 class ART;
+class MetaBlockWriter;
 
 class Node {
 public:
 	static const uint8_t EMPTY_MARKER = 48;
+	//! Bit of the version that is set once the node has been removed from the tree
+	static constexpr uint64_t VERSION_OBSOLETE = 1;
+	//! Bit of the version that is set while a writer modifies the node
+	static constexpr uint64_t VERSION_LOCKED = 2;
 
 public:
 	Node(ART &art, NodeType type, size_t compressed_prefix_size);
@@ -33,6 +41,16 @@ public:
 	NodeType type;
 	//! compressed path (prefix)
 	unique_ptr<uint8_t[]> prefix;
+	//! version of the node, used by readers that traverse the tree without locking the index (optimistic lock
+	//! coupling). Writers set the lock bit while they modify the node, unlocking the node increments the version.
+	std::atomic<uint64_t> version;
+	//! The location of the node in storage, or INVALID_BLOCK if the node has not been written to storage
+	BlockPointer persistent_pointer;
+	//! The size of the node in storage
+	uint32_t persistent_size;
+	//! The version of the node when it was written to or read from storage: once the version changes, the node has
+	//! been modified and is written again by the next checkpoint
+	uint64_t persistent_version;
 
 public:
 	//! Get the position of a child corresponding exactly to the specific byte, returns INVALID_INDEX if not exists
@@ -52,8 +70,20 @@ public:
 		return INVALID_INDEX;
 	}
 	//! Get the child at the specified position in the node. pos should be between [0, count). Throws an assertion if
-	//! the element is not found.
-	virtual unique_ptr<Node> *GetChild(idx_t pos);
+	//! the element is not found. If the child has not been loaded from storage yet, it is loaded first.
+	virtual unique_ptr<Node> *GetChild(ART &art, idx_t pos);
+	//! Get the child at the specified position in the node without loading it from storage, or nullptr if there is no
+	//! child at the position. Used by optimistic readers, which must not modify the tree.
+	virtual Node *GetChildOptimistic(idx_t pos) {
+		return nullptr;
+	}
+
+	//! Write the node and its children to the writer, returns the location of the node. A node that has not been
+	//! modified since it was written to or read from storage, and whose children have not been written again, keeps
+	//! its location and is not loaded or written. Sets written to true if the node has been written.
+	BlockPointer Serialize(ART &art, MetaBlockWriter &writer, bool &written);
+	//! Read a node from storage. The children of the node are not read: they are loaded when they are first accessed.
+	static unique_ptr<Node> Deserialize(ART &art, BlockPointer pointer);
 
 	//! Compare the key with the prefix of the node, return the number matching bytes
 	static uint32_t PrefixMismatch(ART &art, Node *node, Key &key, uint64_t depth);
@@ -62,9 +92,32 @@ public:
 	//! Erase entry from node
 	static void Erase(ART &art, unique_ptr<Node> &node, idx_t pos);
 
+	//! Read the version of a node (or of the root of the ART) before reading from it. Returns false if a writer is
+	//! modifying the node or if the node has been removed from the tree, in which case the reader has to restart.
+	static bool ReadLock(const std::atomic<uint64_t> &version, uint64_t &result) {
+		result = version.load(std::memory_order_acquire);
+		return (result & (VERSION_LOCKED | VERSION_OBSOLETE)) == 0;
+	}
+	//! Returns true if the version did not change since it was read with ReadLock, i.e. everything read from the node
+	//! in the meantime is consistent
+	static bool ReadValidate(const std::atomic<uint64_t> &version, uint64_t expected) {
+		std::atomic_thread_fence(std::memory_order_acquire);
+		return version.load(std::memory_order_relaxed) == expected;
+	}
+	//! Lock a node (or the root of the ART) for writing. Writers are serialized by the lock of the index, so this never
+	//! has to wait for another writer.
+	static void WriteLock(std::atomic<uint64_t> &version) {
+		version.fetch_add(VERSION_LOCKED);
+	}
+	static void WriteUnlock(std::atomic<uint64_t> &version) {
+		version.fetch_add(VERSION_LOCKED);
+	}
+
 protected:
 	//! Copies the prefix from the source to the destination node
 	static void CopyPrefix(ART &art, Node *src, Node *dst);
+	//! Load the child from storage if it has not been loaded yet
+	static unique_ptr<Node> *LoadChild(ART &art, unique_ptr<Node> &child);
 };
 
 } // namespace duckdb
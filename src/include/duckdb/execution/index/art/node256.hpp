@@ -26,7 +26,8 @@ public:
 	//! Get the next position in the node, or INVALID_INDEX if there is no next position
 	idx_t GetNextPos(idx_t pos) override;
 	//! Get Node256 Child
-	unique_ptr<Node> *GetChild(idx_t pos) override;
+	unique_ptr<Node> *GetChild(ART &art, idx_t pos) override;
+	Node *GetChildOptimistic(idx_t pos) override;
 
 	idx_t GetMin() override;
 
@@ -0,0 +1,25 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/index/art/persistent_node.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/index/art/node.hpp"
+
+namespace duckdb {
+
+//! A PersistentNode is a placeholder for a node that has been written to storage but has not been loaded yet. It is
+//! replaced by the actual node the first time the parent accesses it.
+class PersistentNode : public Node {
+public:
+	PersistentNode(ART &art, BlockPointer pointer);
+
+	//! The location of the node in storage
+	BlockPointer pointer;
+};
+
+} // namespace duckdb
@@ -117,6 +117,8 @@ private:
 
 	idx_t AppendToBlock(HTDataBlock &block, BufferHandle &handle, vector<BlockAppendEntry> &append_entries,
 	                    idx_t remaining);
+	//! Allocate space for the given amount of entries in the blocks of the HT, the blocks are pinned in the handles
+	void AllocateEntries(idx_t entry_count, vector<unique_ptr<BufferHandle>> &handles, data_ptr_t key_locations[]);
 
 	void Hash(DataChunk &keys, const SelectionVector &sel, idx_t count, Vector &hashes);
 
@@ -129,7 +131,22 @@ public:
 	void Build(DataChunk &keys, DataChunk &input);
 	//! Finalize the build of the HT, constructing the actual hash table and making the HT ready for probing. Finalize
 	//! must be called before any call to Probe, and after Finalize is called Build should no longer be ever called.
+	//! If the HT does not fit in memory, Finalize instead splits it into radix partitions (see IsPartitioned()).
 	void Finalize();
+	//! Moves the entries of another HT with the same layout into this HT, used to combine thread-local builds
+	void Merge(JoinHashTable &other);
+
+	//! Finalize can also be executed by multiple threads: first InitializeHashMap allocates the hash map, after which
+	//! InsertBlocks is called for disjoint ranges of blocks. Once all blocks are inserted, finalized must be set.
+	//! Returns false if the HT was partitioned instead, in which case the HT is already finalized.
+	bool InitializeHashMap();
+	//! Insert the entries of the blocks [block_start, block_end) into the hash map. If parallel is set, the hash map
+	//! is updated with atomic operations, so that other threads can insert other blocks at the same time.
+	void InsertBlocks(idx_t block_start, idx_t block_end, bool parallel);
+	//! The amount of blocks holding the entries of the HT
+	idx_t BlockCount() {
+		return blocks.size();
+	}
 	//! Probe the HT with the given input chunk, resulting in the given result
 	unique_ptr<ScanStructure> Probe(DataChunk &keys);
 	//! Scan the HT to construct the final full outer join result after
@@ -139,10 +156,34 @@ public:
 		return count;
 	}
 
+	//! Whether or not the HT was split into partitions during Finalize because it did not fit in memory. A partitioned
+	//! HT cannot be probed directly, instead every partition is probed separately with the probe rows that belong to
+	//! it. Only partition 0 is kept in memory after Finalize, the other partitions are loaded with FinalizePartition.
+	bool IsPartitioned() {
+		return !partitions.empty();
+	}
+	//! The amount of partitions of a partitioned HT
+	idx_t PartitionCount() {
+		return partitions.size();
+	}
+	//! Computes the partition index of every row of the keys
+	void ComputePartitions(DataChunk &keys, idx_t partition_indices[]);
+	//! Returns the HT of the given partition
+	JoinHashTable &GetPartition(idx_t partition_idx) {
+		D_ASSERT(partition_idx < partitions.size() && partitions[partition_idx]);
+		return *partitions[partition_idx];
+	}
+	//! Loads the given partition into memory and constructs its hash table, so that it can be probed
+	void FinalizePartition(idx_t partition_idx);
+	//! Destroys the given partition after all its probe rows have been processed
+	void ReleasePartition(idx_t partition_idx);
+
 	//! The stringheap of the JoinHashTable
 	StringHeap string_heap;
 	//! BufferManager
 	BufferManager &buffer_manager;
+	//! The join conditions
+	vector<JoinCondition> &conditions;
 	//! The types of the keys used in equality comparison
 	vector<LogicalType> equality_types;
 	//! The types of the keys
@@ -196,8 +237,8 @@ private:
 	void ApplyBitmask(Vector &hashes, idx_t count);
 	void ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers);
 	//! Insert the given set of locations into the HT with the given set of
-	//! hashes. Caller should hold lock in parallel HT.
-	void InsertHashes(Vector &hashes, idx_t count, data_ptr_t key_locations[]);
+	//! hashes. If parallel is set, the chains are updated using compare-and-swap.
+	void InsertHashes(Vector &hashes, idx_t count, data_ptr_t key_locations[], bool parallel);
 
 	idx_t PrepareKeys(DataChunk &keys, unique_ptr<VectorData[]> &key_data, const SelectionVector *&current_sel,
 	                  SelectionVector &sel, bool build_side);
@@ -205,6 +246,13 @@ private:
 	                         data_ptr_t key_locations[]);
 	void SerializeVector(Vector &v, idx_t vcount, const SelectionVector &sel, idx_t count, data_ptr_t key_locations[]);
 
+	//! Whether or not the HT can be partitioned when it does not fit in memory
+	bool CanPartition();
+	//! Splits the entries of the HT into 2^radix_bits partitions based on the upper bits of their hashes
+	void Partition(idx_t radix_bits);
+	//! Copies the given entries (serialized by another HT with the same layout) into this HT
+	void AppendEntries(data_ptr_t entries[], idx_t entry_count);
+
 	//! The amount of entries stored in the HT currently
 	idx_t count;
 	//! The blocks holding the main data of the hash table
@@ -215,6 +263,12 @@ private:
 	unique_ptr<BufferHandle> hash_map;
 	//! Whether or not NULL values are considered equal in each of the comparisons
 	vector<bool> null_values_are_equal;
+	//! Whether or not this HT is a partition of another HT (partitions are never partitioned further)
+	bool is_partition;
+	//! The amount of hash bits used to determine the partition of an entry (only used if the HT is partitioned)
+	idx_t radix_bits;
+	//! The partitions of the HT (only used if the HT did not fit in memory)
+	vector<unique_ptr<JoinHashTable>> partitions;
 
 	//! Copying not allowed
 	JoinHashTable(const JoinHashTable &) = delete;
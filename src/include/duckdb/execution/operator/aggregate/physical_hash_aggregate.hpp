@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/execution/physical_sink.hpp"
+#include "duckdb/parallel/parallel_state.hpp"
 #include "duckdb/storage/data_table.hpp"
 
 namespace duckdb {
@@ -63,6 +64,12 @@ public:
 	void GetChunkInternal(ExecutionContext &context, DataChunk &chunk, PhysicalOperatorState *state) override;
 	unique_ptr<PhysicalOperatorState> GetOperatorState() override;
 
+	//! The maximum amount of threads that can scan the result of the aggregate, i.e. the amount of finalized HTs.
+	//! Every HT is scanned by a single thread. Can only be called after Finalize has completed.
+	idx_t MaxThreads();
+	//! Initialize the state of a parallel scan of the finalized HTs
+	unique_ptr<ParallelState> GetParallelState();
+
 	string ParamsToString() const override;
 
 private:
@@ -0,0 +1,40 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/helper/physical_result_collector.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_sink.hpp"
+
+namespace duckdb {
+
+//! PhysicalResultCollector materializes the result of a query plan, so that the final pipeline of the plan can be
+//! executed by multiple threads instead of being pulled by the client. The rows are returned in the order of the batch
+//! indices of the parallel scan that produced them, which preserves the order of the scan.
+class PhysicalResultCollector : public PhysicalSink {
+public:
+	explicit PhysicalResultCollector(PhysicalOperator *plan);
+
+	//! The root of the plan whose result is collected. The plan is not owned by the result collector.
+	PhysicalOperator *plan;
+
+public:
+	void Sink(ExecutionContext &context, GlobalOperatorState &state, LocalSinkState &lstate, DataChunk &input) override;
+	void Combine(ExecutionContext &context, GlobalOperatorState &gstate, LocalSinkState &lstate) override;
+	void Finalize(Pipeline &pipeline, ClientContext &context, unique_ptr<GlobalOperatorState> gstate) override;
+	unique_ptr<GlobalOperatorState> GetGlobalState(ClientContext &context) override;
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) override;
+
+	void GetChunkInternal(ExecutionContext &context, DataChunk &chunk, PhysicalOperatorState *state) override;
+	unique_ptr<PhysicalOperatorState> GetOperatorState() override;
+
+	//! Whether or not the final pipeline of the plan can be executed in parallel, i.e. the plan is a chain of
+	//! streaming operators and hash join probes on top of a table scan or aggregate that can be split up among threads
+	static bool CanCollectInParallel(ClientContext &context, PhysicalOperator *plan);
+};
+
+} // namespace duckdb
@@ -15,6 +15,7 @@
 #include "duckdb/planner/operator/logical_join.hpp"
 
 namespace duckdb {
+class PhysicalHashJoinState;
 
 //! PhysicalHashJoin represents a hash loop join between two tables
 class PhysicalHashJoin : public PhysicalComparisonJoin {
@@ -38,13 +39,21 @@ public:
 
 	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) override;
 	void Sink(ExecutionContext &context, GlobalOperatorState &state, LocalSinkState &lstate, DataChunk &input) override;
+	void Combine(ExecutionContext &context, GlobalOperatorState &gstate, LocalSinkState &lstate) override;
 	void Finalize(Pipeline &pipeline, ClientContext &context, unique_ptr<GlobalOperatorState> gstate) override;
 
 	void GetChunkInternal(ExecutionContext &context, DataChunk &chunk, PhysicalOperatorState *state) override;
 	unique_ptr<PhysicalOperatorState> GetOperatorState() override;
 
+	//! Whether or not the build side did not fit in memory and the HT was partitioned. The probe side of a partitioned
+	//! hash join is processed by a single thread, since the partitions are probed after the probe side is exhausted.
+	bool IsPartitioned();
+
 private:
 	void ProbeHashTable(ExecutionContext &context, DataChunk &chunk, PhysicalOperatorState *state_p);
+	//! Fetch the next chunk of probe rows of a partitioned HT into the child chunk and join keys, and return the
+	//! partition that they should be probed against. Returns nullptr if all probe rows have been processed.
+	JoinHashTable *FetchPartitionedChunk(ExecutionContext &context, PhysicalHashJoinState &state);
 };
 
 } // namespace duckdb
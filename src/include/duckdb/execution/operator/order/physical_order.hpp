@@ -13,9 +13,12 @@
 #include "duckdb/planner/bound_query_node.hpp"
 
 namespace duckdb {
+class OrderByGlobalOperatorState;
+class OrderByLocalState;
 
-//! Represents a physical ordering of the data. Note that this will not change
-//! the data but only add a selection vector.
+//! Represents a physical ordering of the data. Every thread sorts its input into runs that are stored in
+//! buffer-managed blocks (and can be offloaded to disk); the runs are then merged in parallel in the Finalize. If there
+//! are more runs than fit in memory at once, groups of runs are first merged into longer runs in several rounds.
 class PhysicalOrder : public PhysicalSink {
 public:
 	PhysicalOrder(vector<LogicalType> types, vector<BoundOrderByNode> orders)
@@ -26,13 +29,27 @@ public:
 
 public:
 	void Sink(ExecutionContext &context, GlobalOperatorState &state, LocalSinkState &lstate, DataChunk &input) override;
+	void Combine(ExecutionContext &context, GlobalOperatorState &state, LocalSinkState &lstate) override;
 	void Finalize(Pipeline &pipeline, ClientContext &context, unique_ptr<GlobalOperatorState> state) override;
 	unique_ptr<GlobalOperatorState> GetGlobalState(ClientContext &context) override;
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) override;
 
 	void GetChunkInternal(ExecutionContext &context, DataChunk &chunk, PhysicalOperatorState *state) override;
 	unique_ptr<PhysicalOperatorState> GetOperatorState() override;
 
 	string ParamsToString() const override;
+
+	//! Merge a single partition of the sorted runs, or a single group of runs if there are too many runs to merge at
+	//! once
+	void MergePartition(OrderByGlobalOperatorState &gstate, idx_t partition);
+	//! Start a round of merging the sorted runs. Returns true if tasks were scheduled on the pipeline, or false if the
+	//! runs were merged directly.
+	bool ScheduleMergeTasks(Pipeline &pipeline, ClientContext &context, OrderByGlobalOperatorState &gstate);
+
+private:
+	//! Sort the rows buffered in the local state into a run and add it to the global state
+	void SortLocalRun(OrderByGlobalOperatorState &gstate, OrderByLocalState &lstate);
+	void GetOrderTypes(vector<OrderType> &order_types, vector<OrderByNullType> &null_order_types);
 };
 
 } // namespace duckdb
@@ -20,6 +20,7 @@
 namespace duckdb {
 struct CopyInfo;
 struct StrpTimeFormat;
+class FileSystem;
 
 //! The shifts array allows for linear searching of multi-byte values. For each position, it determines the next
 //! position given that we encounter a byte with the given value.
@@ -92,6 +93,9 @@ struct BufferedCSVReaderOptions {
 	//! Whether or not a type format is specified
 	std::map<LogicalTypeId, bool> has_format = {{LogicalTypeId::DATE, false}, {LogicalTypeId::TIMESTAMP, false}};
 
+	//! Whether or not the file at the given path is read as a gzip compressed file
+	bool IsGzipCompressed(const string &path) const;
+
 	std::string toString() const {
 		return "DELIMITER='" + delimiter + (has_delimiter ? "'" : (auto_detect ? "' (auto detected)" : "' (default)")) +
 		       ", QUOTE='" + quote + (has_quote ? "'" : (auto_detect ? "' (auto detected)" : "' (default)")) +
@@ -113,6 +117,8 @@ static DataChunk DUMMY_CHUNK;
 class BufferedCSVReader {
 	//! Initial buffer read size; can be extended for long lines
 	static constexpr idx_t INITIAL_BUFFER_SIZE = 16384;
+	//! Buffer read size after the sniffing has finished; can be extended for long lines
+	static constexpr idx_t PARSING_BUFFER_SIZE = 262144;
 	//! Maximum CSV line size: specified because if we reach this amount, we likely have the wrong delimiters
 	static constexpr idx_t MAXIMUM_CSV_LINE_SIZE = 1048576;
 	ParserMode mode;
@@ -131,19 +137,38 @@ public:
 	                  const vector<LogicalType> &requested_types = vector<LogicalType>());
 	BufferedCSVReader(BufferedCSVReaderOptions options, const vector<LogicalType> &requested_types,
 	                  unique_ptr<std::istream> source);
+	//! Create a reader that only reads the rows that start within the byte range [range_start, range_end) of an
+	//! uncompressed file. Unless range_start is 0, reading starts after the first newline at or after range_start
+	//! that is not part of a quoted value, given whether or not range_start lies within a quoted value.
+	BufferedCSVReader(ClientContext &context, BufferedCSVReaderOptions options,
+	                  const vector<LogicalType> &requested_types, idx_t range_start, idx_t range_end,
+	                  bool range_start_in_quotes);
 
 	BufferedCSVReaderOptions options;
 	vector<LogicalType> sql_types;
 	vector<string> col_names;
 	unique_ptr<std::istream> source;
+	//! The file system the CSV file is read from (if it was opened by the reader)
+	FileSystem *file_system = nullptr;
 	bool plain_file_source = false;
 	bool gzip_compressed = false;
 	idx_t file_size = 0;
 
 	unique_ptr<char[]> buffer;
+	idx_t buffer_capacity = 0;
 	idx_t buffer_size;
 	idx_t position;
 	idx_t start = 0;
+	//! The offset of the start of the buffer in the file (only maintained when reading a byte range)
+	idx_t buffer_offset = 0;
+
+	//! The byte range of the file that is read (INVALID_INDEX if the entire file is read)
+	idx_t range_start = INVALID_INDEX;
+	idx_t range_end = INVALID_INDEX;
+	//! Whether or not the start of the byte range lies within a quoted value
+	bool range_start_in_quotes = false;
+	//! The offset of the first row that is read from the byte range
+	idx_t range_first_row = 0;
 
 	idx_t linenr = 0;
 	bool linenr_estimated = false;
@@ -157,7 +182,13 @@ public:
 	idx_t bytes_in_chunk = 0;
 	double bytes_per_line_avg = 0;
 
+	//! Buffers that are no longer read from, but whose contents are referenced by the values of the current chunk
 	vector<unique_ptr<char[]>> cached_buffers;
+	//! The capacity of the last buffer that was added to cached_buffers
+	idx_t cached_buffer_capacity = 0;
+	//! A buffer that is no longer referenced and can be reused by the next read
+	unique_ptr<char[]> spare_buffer;
+	idx_t spare_buffer_capacity = 0;
 
 	TextSearchShiftArray delimiter_search, escape_search, quote_search;
 
@@ -168,6 +199,10 @@ public:
 public:
 	//! Extract a single DataChunk from the CSV file and stores it in insert_chunk
 	void ParseCSV(DataChunk &insert_chunk);
+	//! Returns the offset in the file of the next row that will be read
+	idx_t GetCurrentOffset() {
+		return buffer_offset + position;
+	}
 
 private:
 	//! Initialize Parser
@@ -192,6 +227,12 @@ private:
 	void JumpToBeginning(idx_t skip_rows, bool skip_header);
 	//! Jumps back to the beginning of input stream and resets necessary internal states
 	bool JumpToNextSample();
+	//! Jumps to the start of the first row within the byte range that is read
+	void JumpToRangeStart();
+	//! Whether or not the current position is at the start of a row that lies beyond the byte range that is read
+	bool ReachedRangeEnd(idx_t column) {
+		return column == 0 && range_end != INVALID_INDEX && buffer_offset + position >= range_end;
+	}
 	//! Resets the buffer
 	void ResetBuffer();
 	//! Resets the steam
@@ -24,6 +24,10 @@ public:
 
 	CopyFunction function;
 	unique_ptr<FunctionData> bind_data;
+	//! The state of the copy function that is currently being executed, the thread-local states are initialized with
+	//! it before the threads start producing rows. The state is owned by the global sink state: the pointer is only
+	//! valid between GetGlobalState and Finalize, and is reset by Finalize.
+	GlobalFunctionData *global_function_data = nullptr;
 
 public:
 	void GetChunkInternal(ExecutionContext &context, DataChunk &chunk, PhysicalOperatorState *state) override;
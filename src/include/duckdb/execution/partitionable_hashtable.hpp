@@ -45,6 +45,8 @@ private:
 
 	bool is_partitioned;
 	RadixPartitionInfo &partition_info;
+	//! The amount of memory (in bytes) after which a radix partitioned HT is closed and offloaded to disk
+	idx_t partition_ht_memory_limit;
 	vector<SelectionVector> sel_vectors;
 	vector<idx_t> sel_vector_sizes;
 	DataChunk group_subset, payload_subset;
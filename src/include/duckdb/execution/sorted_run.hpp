@@ -0,0 +1,137 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/sorted_run.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/order_type.hpp"
+#include "duckdb/common/types/chunk_collection.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+//! A block of consecutive rows of a SortedRun
+struct SortedRunBlock {
+	//! The buffer-managed block holding the serialized rows (only used if the run can be spilled)
+	shared_ptr<BlockHandle> block;
+	//! The rows of the block (only used if the run cannot be spilled and is kept in memory)
+	unique_ptr<ChunkCollection> data;
+	//! The row index of the first row of this block within the run
+	idx_t start;
+	//! The amount of rows in this block
+	idx_t count;
+	//! The sort keys of the first row in the block, used to partition the run without loading the block (empty if the
+	//! run has no sort key columns)
+	DataChunk first_key;
+};
+
+//! A SortedRun is a sequence of rows in sorted order. Every row consists of the sort key columns followed by the
+//! payload columns. Runs are stored in blocks registered with the buffer manager, so that they can be offloaded to a
+//! temporary file when they do not fit in memory. A run without sort key columns is a spillable buffer of rows.
+class SortedRun {
+public:
+	SortedRun(BufferManager &buffer_manager, vector<LogicalType> types, idx_t key_count);
+
+	//! The types of the rows in the run (sort keys followed by payload)
+	vector<LogicalType> types;
+	//! The amount of sort key columns
+	idx_t key_count;
+	//! The total amount of rows in the run
+	idx_t count;
+	//! The blocks of the run
+	vector<unique_ptr<SortedRunBlock>> blocks;
+
+public:
+	//! Append rows to the end of the run, the rows must be sorted and come after any rows that are already in the run
+	void Append(DataChunk &chunk);
+	//! Flush any rows that are still buffered to a block. No more rows can be appended after this.
+	void Finalize();
+	//! Load the rows of the given block. Blocks that were spilled are deserialized into the scratch collection.
+	ChunkCollection &LoadBlock(idx_t block_idx, ChunkCollection &scratch);
+	//! Returns the index of the block that holds the given row
+	idx_t LocateBlock(idx_t row_idx);
+
+	//! Whether or not rows of the given types can be spilled to disk
+	static bool CanSpill(const vector<LogicalType> &types);
+
+private:
+	BufferManager &buffer_manager;
+	//! Whether or not the blocks of this run are written to buffer-managed (spillable) blocks
+	bool spillable;
+	//! The amount of rows after which the buffered rows are written to a block
+	idx_t rows_per_block;
+	//! Rows that have been appended but not yet written to a block
+	ChunkCollection buffer;
+
+	void FlushBlock();
+};
+
+//! The SortedRunScanner scans a range of rows of a SortedRun, loading one block at a time
+class SortedRunScanner {
+public:
+	SortedRunScanner(SortedRun &run, idx_t start, idx_t end);
+
+	//! Whether or not all rows in the range have been scanned
+	bool Done() {
+		return position >= end;
+	}
+	//! The chunk holding the current row
+	DataChunk &CurrentChunk() {
+		return current->GetChunk(chunk_idx);
+	}
+	//! The index of the current row within CurrentChunk()
+	idx_t CurrentIndex() {
+		return (position - block_start) % STANDARD_VECTOR_SIZE;
+	}
+	//! The amount of rows that can still be read from CurrentChunk() before moving to the next chunk
+	idx_t RemainingInChunk();
+	//! Whether or not advancing by the given amount of rows loads a new block, which invalidates CurrentChunk()
+	bool AdvanceLoadsBlock(idx_t amount);
+	//! Advance the scanner by the given amount of rows, the rows must all be part of the current chunk
+	void Advance(idx_t amount);
+	//! Scan up to STANDARD_VECTOR_SIZE rows into the result, skipping the first column_offset columns of the run
+	void Scan(DataChunk &result, idx_t column_offset);
+
+private:
+	SortedRun &run;
+	//! The current position and the end of the range
+	idx_t position;
+	idx_t end;
+	//! The currently loaded block
+	idx_t block_idx;
+	idx_t block_start;
+	//! Scratch space for blocks that have to be deserialized
+	ChunkCollection block_data;
+	//! The rows of the currently loaded block
+	ChunkCollection *current;
+	idx_t chunk_idx;
+
+	void LoadCurrentBlock();
+};
+
+//! Merges the sorted runs into a single sorted run using a k-way merge
+class SortedRunMerger {
+public:
+	SortedRunMerger(vector<unique_ptr<SortedRunScanner>> scanners, vector<OrderType> &order_types,
+	                vector<OrderByNullType> &null_order_types);
+
+	//! Merge all the rows of the scanners into the result run
+	void Merge(SortedRun &result);
+
+private:
+	vector<unique_ptr<SortedRunScanner>> scanners;
+	vector<OrderType> &order_types;
+	vector<OrderByNullType> &null_order_types;
+};
+
+//! Computes the boundaries of n_partitions consecutive key ranges over all of the runs, such that every partition can
+//! be merged independently. The result holds for every partition boundary the row index in every run.
+vector<vector<idx_t>> PartitionSortedRuns(vector<unique_ptr<SortedRun>> &runs, idx_t n_partitions,
+                                          vector<OrderType> &order_types, vector<OrderByNullType> &null_order_types);
+
+} // namespace duckdb
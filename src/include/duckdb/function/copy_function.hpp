@@ -18,6 +18,9 @@ class ExecutionContext;
 struct LocalFunctionData {
 	virtual ~LocalFunctionData() {
 	}
+
+	//! The batch index of the rows that are passed to copy_to_sink (0 if the child of the copy has no batch index)
+	idx_t batch_index = 0;
 };
 
 struct GlobalFunctionData {
@@ -27,13 +30,16 @@ struct GlobalFunctionData {
 
 typedef unique_ptr<FunctionData> (*copy_to_bind_t)(ClientContext &context, CopyInfo &info, vector<string> &names,
                                                    vector<LogicalType> &sql_types);
-typedef unique_ptr<LocalFunctionData> (*copy_to_initialize_local_t)(ClientContext &context, FunctionData &bind_data);
+typedef unique_ptr<LocalFunctionData> (*copy_to_initialize_local_t)(ClientContext &context, FunctionData &bind_data,
+                                                                    GlobalFunctionData &gstate);
 typedef unique_ptr<GlobalFunctionData> (*copy_to_initialize_global_t)(ClientContext &context, FunctionData &bind_data);
 typedef void (*copy_to_sink_t)(ClientContext &context, FunctionData &bind_data, GlobalFunctionData &gstate,
                                LocalFunctionData &lstate, DataChunk &input);
 typedef void (*copy_to_combine_t)(ClientContext &context, FunctionData &bind_data, GlobalFunctionData &gstate,
                                   LocalFunctionData &lstate);
 typedef void (*copy_to_finalize_t)(ClientContext &context, FunctionData &bind_data, GlobalFunctionData &gstate);
+//! Whether or not the rows are written in the order in which they are produced by the child of the copy
+typedef bool (*copy_to_preserves_order_t)(FunctionData &bind_data);
 
 typedef unique_ptr<FunctionData> (*copy_from_bind_t)(ClientContext &context, CopyInfo &info,
                                                      vector<string> &expected_names,
@@ -43,7 +49,8 @@ class CopyFunction : public Function {
 public:
 	explicit CopyFunction(string name)
 	    : Function(name), copy_to_bind(nullptr), copy_to_initialize_local(nullptr), copy_to_initialize_global(nullptr),
-	      copy_to_sink(nullptr), copy_to_combine(nullptr), copy_to_finalize(nullptr), copy_from_bind(nullptr) {
+	      copy_to_sink(nullptr), copy_to_combine(nullptr), copy_to_finalize(nullptr),
+	      copy_to_preserves_order(nullptr), parallel(false), copy_from_bind(nullptr) {
 	}
 
 	copy_to_bind_t copy_to_bind;
@@ -52,6 +59,11 @@ public:
 	copy_to_sink_t copy_to_sink;
 	copy_to_combine_t copy_to_combine;
 	copy_to_finalize_t copy_to_finalize;
+	//! Whether or not the output of a parallel copy depends on the order of the rows (nullptr: it does). If it does,
+	//! the copy is only executed in parallel if the order can be restored from the batch index of its child.
+	copy_to_preserves_order_t copy_to_preserves_order;
+	//! Whether or not copy_to_sink and copy_to_combine can be called by multiple threads in parallel
+	bool parallel;
 
 	copy_from_bind_t copy_from_bind;
 	TableFunction copy_from_function;
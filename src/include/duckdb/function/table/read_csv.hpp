@@ -41,9 +41,28 @@ struct WriteCSVData : public BaseCSVData {
 	bool is_simple;
 	//! The size of the CSV file (in bytes) that we buffer before we flush it to disk
 	idx_t flush_size = 4096 * 8;
+	//! Whether or not every thread writes its rows to a separate file in the directory given as file path, instead
+	//! of all threads writing to a single file in the order of the input
+	bool per_thread_output = false;
+};
+
+//! A byte range of a CSV file that is read by a single thread
+struct CSVFileRange {
+	CSVFileRange(idx_t file_index, idx_t start, idx_t end) : file_index(file_index), start(start), end(end) {
+	}
+
+	//! The index of the file in the list of files
+	idx_t file_index;
+	//! The byte range [start, end) of the file, end is INVALID_INDEX if the entire file is read (e.g. when it is
+	//! compressed)
+	idx_t start;
+	idx_t end;
 };
 
 struct ReadCSVData : public BaseCSVData {
+	//! The size of the byte ranges in which the files are split up when they are read in parallel
+	static constexpr idx_t PARALLEL_RANGE_SIZE = 8 * 1024 * 1024;
+
 	//! The expected SQL types to read
 	vector<LogicalType> sql_types;
 	//! Whether or not to include a file name column
@@ -51,6 +70,14 @@ struct ReadCSVData : public BaseCSVData {
 	//! The initial reader (if any): this is used when automatic detection is used during binding.
 	//! In this case, the CSV reader is already created and might as well be re-used.
 	unique_ptr<BufferedCSVReader> initial_reader;
+	//! Whether or not the files can be read in parallel
+	bool parallel = true;
+	//! The options with which the byte ranges are read: the dialect detected while binding (if any) is fixed
+	BufferedCSVReaderOptions range_options;
+
+	//! Split up the files into byte ranges that can be read in parallel, in the order of the files (empty if the files
+	//! can only be read sequentially). This only looks at the sizes of the files.
+	vector<CSVFileRange> GetRanges(ClientContext &context);
 };
 
 struct CSVCopyFunction {
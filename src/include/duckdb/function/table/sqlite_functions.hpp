@@ -40,4 +40,16 @@ struct PragmaDatabaseSize {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct PragmaBufferManagerStats {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
+struct PragmaWALStats {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
+struct PragmaColumnStatistics {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 } // namespace duckdb
@@ -53,6 +53,8 @@ typedef unique_ptr<FunctionOperatorData> (*table_function_init_parallel_t)(Clien
                                                                            TableFilterCollection *filters);
 typedef bool (*table_function_parallel_state_next_t)(ClientContext &context, const FunctionData *bind_data,
                                                      FunctionOperatorData *state, ParallelState *parallel_state);
+typedef idx_t (*table_function_get_batch_index_t)(ClientContext &context, const FunctionData *bind_data,
+                                                  FunctionOperatorData *operator_state, ParallelState *parallel_state);
 typedef void (*table_function_dependency_t)(unordered_set<CatalogEntry *> &dependencies, const FunctionData *bind_data);
 typedef unique_ptr<NodeStatistics> (*table_function_cardinality_t)(ClientContext &context,
                                                                    const FunctionData *bind_data);
@@ -77,7 +79,7 @@ public:
 	      statistics(statistics), cleanup(cleanup), dependency(dependency), cardinality(cardinality),
 	      pushdown_complex_filter(pushdown_complex_filter), to_string(to_string), max_threads(max_threads),
 	      init_parallel_state(init_parallel_state), parallel_init(parallel_init),
-	      parallel_state_next(parallel_state_next), projection_pushdown(projection_pushdown),
+	      parallel_state_next(parallel_state_next), get_batch_index(nullptr), projection_pushdown(projection_pushdown),
 	      filter_pushdown(filter_pushdown) {
 	}
 	TableFunction(vector<LogicalType> arguments, table_function_t function, table_function_bind_t bind = nullptr,
@@ -133,6 +135,9 @@ public:
 	table_function_init_parallel_t parallel_init;
 	//! (Optional) return the next chunk to process in the parallel scan, or return nullptr if there is none
 	table_function_parallel_state_next_t parallel_state_next;
+	//! (Optional) returns the index of the batch of the parallel scan that is currently being scanned. Batches are
+	//! handed out in increasing order of their index, so the indices can be used to restore the order of the scan.
+	table_function_get_batch_index_t get_batch_index;
 
 	//! Whether or not the table function supports projection pushdown. If not supported a projection will be added
 	//! that filters out unused columns.
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/enums/order_type.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/winapi.hpp"
@@ -32,6 +33,8 @@ public:
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	// Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
+	//! The time (in microseconds) a commit that syncs the WAL waits for other commits to join the sync (default: 0)
+	idx_t wal_commit_delay = 0;
 	//! Whether or not to use Direct IO, bypassing operating system buffers
 	bool use_direct_io = false;
 	//! The FileSystem to use, can be overwritten to allow for injecting custom file systems for testing purposes (e.g.
@@ -43,6 +46,8 @@ public:
 	bool use_temporary_directory = true;
 	//! Directory to store temporary structures that do not fit in memory
 	string temporary_directory;
+	//! The order in which the buffer manager evicts blocks when the memory limit is reached (default: LRU)
+	BufferEvictionPolicy eviction_policy = BufferEvictionPolicy::LRU;
 	//! The collation type of the database
 	string collation = string();
 	//! The order type used when none is specified (default: ASC)
@@ -0,0 +1,63 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/join_order/cardinality_estimator.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/planner/column_binding_map.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+class ClientContext;
+class Expression;
+class LogicalGet;
+class LogicalOperator;
+
+//! The CardinalityEstimator estimates the cardinality of the (filtered) relations of the join order optimizer and the
+//! selectivity of the join conditions between them, using the statistics of the base table columns
+class CardinalityEstimator {
+public:
+	//! The selectivity of predicates that cannot be estimated from the statistics
+	static constexpr double DEFAULT_SELECTIVITY = 0.2;
+	//! The selectivity of range predicates that cannot be estimated from the statistics
+	static constexpr double DEFAULT_RANGE_SELECTIVITY = 1.0 / 3.0;
+
+public:
+	explicit CardinalityEstimator(ClientContext &context);
+
+	//! Register a relation of the join order optimizer, so that the statistics of its columns can be used
+	void AddRelation(LogicalOperator *op);
+	//! Estimate the cardinality of a relation after the given filters on that relation have been applied
+	double EstimateCardinality(LogicalOperator *op, const vector<Expression *> &filters);
+	//! Estimate the selectivity of joining two sides with the given cardinalities on the given conditions.
+	//! left_sides[i] is true if the left child of conditions[i] refers to the left side of the join.
+	double EstimateJoinSelectivity(const vector<Expression *> &conditions, const vector<bool> &left_sides,
+	                               double left_cardinality, double right_cardinality);
+
+private:
+	ClientContext &context;
+	//! The base table scans of the relations by their table index
+	unordered_map<idx_t, LogicalGet *> gets;
+	//! The statistics of the base table columns that have been requested so far (nullptr if there are none), by table
+	//! index and column id
+	column_binding_map_t<unique_ptr<BaseStatistics>> column_statistics;
+
+private:
+	//! Returns the statistics of a column of a base table scan, or nullptr if there are none
+	BaseStatistics *GetStatistics(LogicalGet &get, column_t column_id);
+	//! Returns the statistics of a column, or nullptr if the expression is not a base table column with statistics
+	BaseStatistics *GetStatistics(Expression &expr);
+	//! Estimate the selectivity of a filter on a single relation
+	double EstimateFilterSelectivity(Expression &filter);
+	//! Estimate the selectivity of the filters that have been pushed into the scan of a single column
+	double EstimateTableFilterSelectivity(LogicalGet &get, column_t column_id, const vector<TableFilter *> &filters);
+};
+
+} // namespace duckdb
@@ -10,6 +10,7 @@
 
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/unordered_set.hpp"
+#include "duckdb/optimizer/join_order/cardinality_estimator.hpp"
 #include "duckdb/optimizer/join_order/query_graph.hpp"
 #include "duckdb/optimizer/join_order/join_relation.hpp"
 #include "duckdb/parser/expression_map.hpp"
@@ -26,24 +27,26 @@ public:
 	struct JoinNode {
 		JoinRelationSet *set;
 		NeighborInfo *info;
-		idx_t cardinality;
-		idx_t cost;
+		//! The estimated amount of tuples produced by this node
+		double cardinality;
+		//! The estimated cost of this node: the sum of the cardinalities of all intermediate results (C_out)
+		double cost;
 		JoinNode *left;
 		JoinNode *right;
 
 		//! Create a leaf node in the join tree
-		JoinNode(JoinRelationSet *set, idx_t cardinality)
+		JoinNode(JoinRelationSet *set, double cardinality)
 		    : set(set), info(nullptr), cardinality(cardinality), cost(cardinality), left(nullptr), right(nullptr) {
 		}
 		//! Create an intermediate node in the join tree
-		JoinNode(JoinRelationSet *set, NeighborInfo *info, JoinNode *left, JoinNode *right, idx_t cardinality,
-		         idx_t cost)
+		JoinNode(JoinRelationSet *set, NeighborInfo *info, JoinNode *left, JoinNode *right, double cardinality,
+		         double cost)
 		    : set(set), info(info), cardinality(cardinality), cost(cost), left(left), right(right) {
 		}
 	};
 
 public:
-	explicit JoinOrderOptimizer(ClientContext &context) : context(context) {
+	explicit JoinOrderOptimizer(ClientContext &context) : context(context), estimator(context) {
 	}
 
 	//! Perform join reordering inside a plan
@@ -51,6 +54,8 @@ public:
 
 private:
 	ClientContext &context;
+	//! The cardinality estimator used to compute the cost of the join plans
+	CardinalityEstimator estimator;
 	//! The total amount of join pairs that have been considered
 	idx_t pairs = 0;
 	//! Set of all relations considered in the join optimizer
@@ -78,6 +83,8 @@ private:
 	//! rewritten into joins. Returns true if there are joins in the tree that can be reordered, false otherwise.
 	bool ExtractJoinRelations(LogicalOperator &input_op, vector<LogicalOperator *> &filter_operators,
 	                          LogicalOperator *parent = nullptr);
+	//! Create a new JoinTree node by joining together two previous JoinTree nodes
+	unique_ptr<JoinNode> CreateJoinTree(JoinRelationSet *set, NeighborInfo *info, JoinNode *left, JoinNode *right);
 	//! Emit a pair as a potential join candidate. Returns the best plan found for the (left, right) connection (either
 	//! the newly created plan, or an existing plan)
 	JoinNode *EmitPair(JoinRelationSet *left, JoinRelationSet *right, NeighborInfo *info);
@@ -103,6 +103,8 @@ private:
 private:
 	void ScheduleSequentialTask();
 	bool ScheduleOperator(PhysicalOperator *op);
+	//! Launch max_threads tasks that scan the source operator of the pipeline in parallel using the given state
+	void LaunchScanTasks(PhysicalOperator *op, idx_t max_threads, unique_ptr<ParallelState> state);
 };
 
 } // namespace duckdb
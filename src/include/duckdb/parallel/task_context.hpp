@@ -18,11 +18,13 @@ class PhysicalOperator;
 //! TaskContext holds task specific information relating to the excution
 class TaskContext {
 public:
-	TaskContext() {
+	TaskContext() : batch_index(0) {
 	}
 
 	//! Per-operator task info
 	unordered_map<PhysicalOperator *, ParallelState *> task_info;
+	//! The batch index of the data that is currently being processed by the parallel scan of the task (if any)
+	idx_t batch_index;
 };
 
 } // namespace duckdb
@@ -0,0 +1,56 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/parallel/task_executor.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+
+namespace duckdb {
+
+//! The TaskExecutor runs a set of work items with the task scheduler and waits until all of them have finished. The
+//! thread that waits executes the pending work items itself, and only blocks once all of them have been picked up.
+class TaskExecutor {
+public:
+	explicit TaskExecutor(TaskScheduler &scheduler);
+	~TaskExecutor();
+
+	//! Schedule a work item to be executed by the task scheduler
+	void ScheduleTask(std::function<void()> work);
+	//! Execute the scheduled work items from this thread as well and wait until all of them have finished. If any of
+	//! the work items threw an exception, the first exception that was thrown is rethrown.
+	void WorkOnTasks();
+
+	//! Called by a task after its work item has finished (or failed with the given exception)
+	void FinishTask(std::exception_ptr error);
+	//! Whether or not any of the work items has thrown an exception
+	bool HasError();
+
+private:
+	//! Wait until all scheduled work items have finished
+	void WaitForTasks();
+
+	TaskScheduler &scheduler;
+	unique_ptr<ProducerToken> producer;
+
+	mutex executor_lock;
+	std::condition_variable finished_condition;
+	//! The amount of work items that have been scheduled
+	idx_t scheduled_tasks;
+	//! The amount of work items that have finished
+	idx_t finished_tasks;
+	//! The first exception thrown by a work item
+	std::exception_ptr error;
+};
+
+} // namespace duckdb
@@ -12,6 +12,7 @@
 #include "duckdb/planner/bound_constraint.hpp"
 #include "duckdb/planner/expression.hpp"
 #include "duckdb/planner/logical_operator.hpp"
+#include "duckdb/storage/storage_info.hpp"
 #include "duckdb/storage/table/persistent_table_data.hpp"
 
 namespace duckdb {
@@ -37,6 +38,8 @@ struct BoundCreateTableInfo {
 	unordered_set<CatalogEntry *> dependencies;
 	//! The existing table data on disk (if any)
 	unique_ptr<PersistentTableData> data;
+	//! The location of the indexes of the UNIQUE and PRIMARY KEY constraints on disk (if any)
+	vector<IndexPointer> indexes;
 	//! CREATE TABLE from QUERY
 	unique_ptr<LogicalOperator> query;
 
@@ -35,6 +35,10 @@ public:
 	//! assumed to be rewritten)
 	virtual void MarkBlockAsModified(block_id_t block_id) {
 	}
+	//! Returns whether or not the block has been marked as modified since the last checkpoint
+	virtual bool IsBlockModified(block_id_t block_id) {
+		return false;
+	}
 	//! Get the first meta block id
 	virtual block_id_t GetMetaBlock() = 0;
 	//! Read the content of the block from disk
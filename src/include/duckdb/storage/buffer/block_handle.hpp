@@ -22,6 +22,7 @@ enum class BlockState : uint8_t { BLOCK_UNLOADED = 0, BLOCK_LOADED = 1 };
 
 class BlockHandle {
 	friend struct BufferEvictionNode;
+	friend struct EvictionQueue;
 	friend class BufferHandle;
 	friend class BufferManager;
 
@@ -59,6 +60,10 @@ private:
 	bool can_destroy;
 	//! The memory usage of the block
 	idx_t memory_usage;
+	//! Whether or not the block is protected from early eviction (only used by the TWO_QUEUE eviction policy)
+	bool eviction_protected;
+	//! The amount of blocks that the buffer manager had loaded when this block was loaded
+	idx_t load_sequence;
 };
 
 } // namespace duckdb
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/storage/buffer/buffer_handle.hpp"
 #include "duckdb/storage/buffer/buffer_list.hpp"
 #include "duckdb/storage/buffer/managed_buffer.hpp"
@@ -22,6 +23,7 @@
 namespace duckdb {
 class DatabaseInstance;
 struct EvictionQueue;
+class TemporaryFileManager;
 
 //! The buffer manager is in charge of handling memory management for the database. It hands out memory buffers that can
 //! be used by the database internally.
@@ -65,6 +67,24 @@ public:
 		return maximum_memory;
 	}
 
+	//! Set the order in which unpinned blocks are evicted
+	void SetEvictionPolicy(BufferEvictionPolicy policy);
+	BufferEvictionPolicy GetEvictionPolicy() {
+		return eviction_policy;
+	}
+	//! The amount of times a persistent block was pinned while it was already in memory
+	idx_t GetPinHits() {
+		return pin_hits;
+	}
+	//! The amount of times a persistent block had to be read from disk when it was pinned
+	idx_t GetPinMisses() {
+		return pin_misses;
+	}
+	//! The amount of blocks that were evicted from memory
+	idx_t GetEvictedBlocks() {
+		return evicted_blocks;
+	}
+
 private:
 	//! Evict blocks until the currently used memory + extra_memory fit, returns false if this was not possible
 	//! (i.e. not enough blocks could be evicted)
@@ -72,7 +92,7 @@ private:
 
 	//! Write a temporary buffer to disk
 	void WriteTemporaryBuffer(ManagedBuffer &buffer);
-	//! Read a temporary buffer from disk
+	//! Read a temporary buffer from disk, the buffer is removed from disk afterwards
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(block_id_t id);
 	//! Get the path of the temporary buffer
 	string GetTemporaryPath(block_id_t id);
@@ -88,12 +108,20 @@ private:
 	std::atomic<idx_t> maximum_memory;
 	//! The directory name where temporary files are stored
 	string temp_directory;
+	//! Manages the temporary files that hold offloaded blocks of size BLOCK_ALLOC_SIZE
+	unique_ptr<TemporaryFileManager> temp_file_manager;
 	//! The lock for the set of blocks
 	std::mutex manager_lock;
 	//! A mapping of block id -> BlockPointer
 	unordered_map<block_id_t, weak_ptr<BlockHandle>> blocks;
 	//! Eviction queue
 	unique_ptr<EvictionQueue> queue;
+	//! The order in which unpinned blocks are evicted
+	std::atomic<BufferEvictionPolicy> eviction_policy;
+	//! Buffer pool statistics
+	std::atomic<idx_t> pin_hits;
+	std::atomic<idx_t> pin_misses;
+	std::atomic<idx_t> evicted_blocks;
 	//! The temporary id used for managed buffers
 	block_id_t temporary_id;
 };
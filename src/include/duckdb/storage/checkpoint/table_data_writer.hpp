@@ -16,6 +16,7 @@ class UncompressedSegment;
 class MorselInfo;
 class BaseStatistics;
 class SegmentStatistics;
+class CompressedBlockWriter;
 
 //! The table data writer is responsible for writing the data of a table to the block manager
 class TableDataWriter {
@@ -25,6 +26,13 @@ public:
 	TableDataWriter(DatabaseInstance &db, TableCatalogEntry &table, MetaBlockWriter &meta_writer);
 	~TableDataWriter();
 
+	//! Write the data of a single column of the table to disk. The columns of a table are independent, so different
+	//! columns can be checkpointed by different threads.
+	void CheckpointColumn(idx_t col_idx);
+	//! Write the nodes of the indexes of the table that have changed since the last checkpoint
+	void WriteIndexData();
+	//! Write the data pointers, the deletes and the index roots of the table to the meta writer, after all columns
+	//! have been checkpointed
 	void WriteTableData();
 
 	void CheckpointColumn(ColumnData &col_data, idx_t col_idx);
@@ -47,8 +55,12 @@ private:
 	vector<unique_ptr<UncompressedSegment>> segments;
 	vector<unique_ptr<SegmentStatistics>> stats;
 	vector<unique_ptr<BaseStatistics>> column_stats;
+	//! The writers that pack the compressed segments of every column into blocks
+	vector<unique_ptr<CompressedBlockWriter>> compressed_writers;
 
 	vector<vector<DataPointer>> data_pointers;
+	//! The location of the indexes written by WriteIndexData
+	vector<IndexPointer> index_pointers;
 };
 
 } // namespace duckdb
@@ -13,6 +13,7 @@
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/meta_block_writer.hpp"
 #include "duckdb/storage/data_pointer.hpp"
+#include "duckdb/common/unordered_map.hpp"
 
 namespace duckdb {
 class DatabaseInstance;
@@ -22,11 +23,13 @@ class SchemaCatalogEntry;
 class SequenceCatalogEntry;
 class TableCatalogEntry;
 class ViewCatalogEntry;
+class TableDataWriter;
 
 //! CheckpointManager is responsible for checkpointing the database
 class CheckpointManager {
 public:
 	explicit CheckpointManager(DatabaseInstance &db);
+	~CheckpointManager();
 
 	//! Checkpoint the current state of the WAL and flush it to the main storage. This should be called BEFORE any
 	//! connction is available because right now the checkpointing cannot be done online. (TODO)
@@ -42,6 +45,10 @@ public:
 	unique_ptr<MetaBlockWriter> tabledata_writer;
 
 private:
+	//! Write the column data of all tables in the given schemas to disk, using the task scheduler to write the columns
+	//! in parallel
+	void WriteTableData(vector<SchemaCatalogEntry *> &schemas);
+
 	void WriteSchema(SchemaCatalogEntry &schema);
 	void WriteTable(TableCatalogEntry &table);
 	void WriteView(ViewCatalogEntry &table);
@@ -53,6 +60,11 @@ private:
 	void ReadView(ClientContext &context, MetaBlockReader &reader);
 	void ReadSequence(ClientContext &context, MetaBlockReader &reader);
 	void ReadMacro(ClientContext &context, MetaBlockReader &reader);
+
+private:
+	//! The writers of the tables whose data has been written, their data pointers are written with the table meta data.
+	//! A writer only holds buffers while one of its columns is being written.
+	unordered_map<TableCatalogEntry *, unique_ptr<TableDataWriter>> table_writers;
 };
 
 } // namespace duckdb
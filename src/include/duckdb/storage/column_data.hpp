@@ -61,6 +61,8 @@ public:
 	void InitializeAppend(ColumnAppendState &state);
 	//! Append a vector of type [type] to the end of the column
 	void Append(ColumnAppendState &state, Vector &vector, idx_t count);
+	//! Finish an appending phase, merging the distinct values of the appended vectors into the column statistics
+	void FinalizeAppend(ColumnAppendState &state);
 	//! Revert a set of appends to the ColumnData
 	void RevertAppend(row_t start_row);
 
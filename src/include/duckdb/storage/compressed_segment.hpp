@@ -0,0 +1,71 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/compressed_segment.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/enums/compression_type.hpp"
+#include "duckdb/storage/numeric_segment.hpp"
+
+namespace duckdb {
+
+//! A CompressedSegment is a persistent numeric segment that is stored in a compressed format at an offset within a
+//! block. Compressed segments of the same column share blocks, and every vector is compressed separately so it can be
+//! decompressed on its own while scanning. Once the segment is updated it is decompressed into an in-memory block, from
+//! then on it behaves like a regular NumericSegment. Vectors in which every row holds the same value are scanned as
+//! constant vectors, and filters on RLE vectors are evaluated once for every run instead of once for every row.
+class CompressedSegment : public NumericSegment {
+public:
+	CompressedSegment(DatabaseInstance &db, PhysicalType type, idx_t row_start, block_id_t block_id, idx_t offset,
+	                  CompressionType compression);
+
+	//! The compression scheme of the segment
+	CompressionType compression;
+	//! The offset of the compressed data within the block
+	idx_t offset;
+
+public:
+	//! Fetch a single value and append it to the vector
+	void FetchRow(ColumnFetchState &state, Transaction &transaction, row_t row_id, Vector &result,
+	              idx_t result_idx) override;
+	//! Decompress the segment into an in-memory block
+	void ToTemporary() override;
+
+	//! Whether or not segments of the given type can be compressed
+	static bool SupportsCompression(PhysicalType type);
+	//! Choose the compression scheme for the segment based on its data. Returns UNCOMPRESSED if compression does not
+	//! reduce the size of the segment, otherwise compressed_size is set to the size of the compressed segment.
+	static CompressionType ChooseCompression(NumericSegment &segment, idx_t &compressed_size);
+	//! Write the segment to the target using the given compression scheme, the target must have room for the
+	//! compressed_size returned by ChooseCompression. Returns the amount of bytes written.
+	static idx_t Compress(NumericSegment &segment, CompressionType compression, data_ptr_t target);
+
+protected:
+	void Select(ColumnScanState &state, Vector &result, SelectionVector &sel, idx_t &approved_tuple_count,
+	            vector<TableFilter> &table_filter) override;
+	void FetchBaseData(ColumnScanState &state, idx_t vector_index, Vector &result) override;
+	void FilterFetchBaseData(ColumnScanState &state, Vector &result, SelectionVector &sel,
+	                         idx_t &approved_tuple_count) override;
+
+public:
+	typedef void (*decompress_function_t)(data_ptr_t segment_data, idx_t vector_index, idx_t count,
+	                                      data_ptr_t result_data, nullmask_t &result_nullmask);
+
+private:
+	decompress_function_t decompress_function;
+
+	//! Decompress a vector from the compressed data of the segment, which is stored in the given block
+	void DecompressVector(data_ptr_t block_data, idx_t vector_index, data_ptr_t result_data,
+	                      nullmask_t &result_nullmask);
+	//! If every row of the vector holds the same non-NULL value, write that value to result_data and return true
+	bool FetchConstant(data_ptr_t block_data, idx_t vector_index, data_ptr_t result_data);
+	//! Apply the filters to an RLE vector that has been decompressed into the result, evaluating them once per run
+	void SelectRuns(data_ptr_t block_data, idx_t vector_index, Vector &result, SelectionVector &sel,
+	                idx_t &approved_tuple_count, vector<TableFilter> &table_filter);
+};
+
+} // namespace duckdb
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/compression_type.hpp"
 #include "duckdb/storage/statistics/base_statistics.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
@@ -20,6 +21,8 @@ public:
 	uint64_t tuple_count;
 	block_id_t block_id;
 	uint32_t offset;
+	//! The compression scheme of the segment
+	CompressionType compression;
 	//! Type-specific statistics of the segment
 	unique_ptr<BaseStatistics> statistics;
 };
@@ -113,6 +113,8 @@ public:
 	void InitializeAppend(Transaction &transaction, TableAppendState &state, idx_t append_count);
 	//! Append a chunk to the table using the AppendState obtained from BeginAppend
 	void Append(Transaction &transaction, DataChunk &chunk, TableAppendState &state);
+	//! Finish appending to the table, must be called while the AppendState still holds the append lock
+	void FinalizeAppend(TableAppendState &state);
 	//! Commit the append
 	void CommitAppend(transaction_t commit_id, idx_t row_start, idx_t count);
 	//! Write a segment of the table to the WAL
@@ -140,8 +142,8 @@ public:
 
 	unique_ptr<BaseStatistics> GetStatistics(ClientContext &context, column_t column_id);
 
-	//! Checkpoint the table to the specified table data writer
-	void Checkpoint(TableDataWriter &writer);
+	//! Checkpoint a column of the table to the specified table data writer
+	void CheckpointColumn(TableDataWriter &writer, idx_t column_idx);
 	void CheckpointDeletes(TableDataWriter &writer);
 	void CommitDropTable();
 	void CommitDropColumn(idx_t index);
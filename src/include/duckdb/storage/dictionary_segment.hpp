@@ -0,0 +1,66 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/dictionary_segment.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/enums/compression_type.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/storage/string_segment.hpp"
+
+namespace duckdb {
+
+//! A DictionarySegment is a persistent string segment that stores every distinct string of the segment only once,
+//! together with a code for every row that refers to its string. Scans emit dictionary vectors that point into a
+//! dictionary vector that is shared by all scans of the segment, and filters are evaluated once for every entry of the
+//! dictionary. Once the segment is updated it is converted into the layout of a regular StringSegment.
+class DictionarySegment : public StringSegment {
+public:
+	DictionarySegment(DatabaseInstance &db, idx_t row_start, block_id_t block_id, idx_t offset);
+
+	//! The offset of the segment within the block
+	idx_t offset;
+
+	//! The maximum amount of distinct strings in a dictionary segment: the dictionary is stored in a single vector,
+	//! and the first entry is reserved for NULL
+	static constexpr idx_t MAXIMUM_DICTIONARY_SIZE = STANDARD_VECTOR_SIZE - 1;
+
+public:
+	//! Fetch a single value and append it to the vector
+	void FetchRow(ColumnFetchState &state, Transaction &transaction, row_t row_id, Vector &result,
+	              idx_t result_idx) override;
+	//! Convert the segment into an in-memory StringSegment
+	void ToTemporary() override;
+
+	//! Returns DICTIONARY if the string segment can be stored as a dictionary segment that is smaller than the segment
+	//! itself, in which case compressed_size is set to the size of the dictionary segment. Returns UNCOMPRESSED
+	//! otherwise.
+	static CompressionType ChooseCompression(StringSegment &segment, idx_t &compressed_size);
+	//! Write the string segment as a dictionary segment to the target, the target must have room for the
+	//! compressed_size returned by ChooseCompression. Returns the amount of bytes written.
+	static idx_t Compress(StringSegment &segment, data_ptr_t target);
+
+protected:
+	void Select(ColumnScanState &state, Vector &result, SelectionVector &sel, idx_t &approved_tuple_count,
+	            vector<TableFilter> &table_filter) override;
+	void FetchBaseData(ColumnScanState &state, idx_t vector_index, Vector &result) override;
+	void FilterFetchBaseData(ColumnScanState &state, Vector &result, SelectionVector &sel,
+	                         idx_t &approved_tuple_count) override;
+
+private:
+	//! Lock for building the dictionary vector
+	mutex dictionary_lock;
+	//! The dictionary vector, entry 0 is NULL and entry i holds the string with code i
+	unique_ptr<Vector> dictionary;
+
+	//! Returns the dictionary vector of the segment, building it if it has not been built yet
+	Vector &GetDictionary(data_ptr_t segment_data, const LogicalType &type);
+	//! Load the codes of the rows of the given vector into the selection vector
+	void FetchCodes(data_ptr_t segment_data, idx_t vector_index, SelectionVector &codes);
+};
+
+} // namespace duckdb
@@ -18,7 +18,9 @@
 
 namespace duckdb {
 
+class ChunkCollection;
 class ClientContext;
+class DatabaseInstance;
 class Transaction;
 
 struct IndexLock;
@@ -74,6 +76,14 @@ public:
 
 	//! Insert data into the index. Does not lock the index.
 	virtual bool Insert(IndexLock &lock, DataChunk &input, Vector &row_identifiers) = 0;
+	//! Construct the index from all entries of a table. The chunks of the input hold the results of the index
+	//! expressions followed by the row identifiers. By default the chunks are inserted one by one. Does not lock the
+	//! index.
+	virtual bool Construct(DatabaseInstance &db, IndexLock &lock, ChunkCollection &input);
+
+	//! Called when the table of the index is dropped, frees the storage used by the index
+	virtual void CommitDrop() {
+	}
 
 	//! Returns true if the index is affected by updates on the specified column ids, and false otherwise
 	bool IndexIsUpdated(vector<column_t> &column_ids);
@@ -12,6 +12,7 @@
 #include "duckdb/storage/block_manager.hpp"
 #include "duckdb/storage/block.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/unordered_set.hpp"
 #include "duckdb/common/set.hpp"
 #include "duckdb/common/vector.hpp"
@@ -36,6 +37,8 @@ public:
 	bool IsRootBlock(block_id_t root) override;
 	//! Register a new block to be used as a meta block
 	void MarkBlockAsModified(block_id_t block_id) override;
+	//! Returns whether or not the block has been marked as modified since the last checkpoint
+	bool IsBlockModified(block_id_t block_id) override;
 	//! Return the meta block id
 	block_id_t GetMetaBlock() override;
 	//! Read the content of the block from disk
@@ -69,6 +72,8 @@ private:
 	unique_ptr<FileHandle> handle;
 	//! The buffer used to read/write to the headers
 	FileBuffer header_buffer;
+	//! Lock for the free list and the modified blocks: blocks are allocated by multiple threads during a checkpoint
+	mutex block_lock;
 	//! The list of free blocks that can be written to currently
 	set<block_id_t> free_list;
 	//! The list of blocks that will be added to the free list
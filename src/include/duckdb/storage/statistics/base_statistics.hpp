@@ -17,6 +17,7 @@ namespace duckdb {
 class Serializer;
 class Deserializer;
 class Vector;
+class DistinctStatistics;
 
 class BaseStatistics {
 public:
@@ -27,6 +28,9 @@ public:
 	LogicalType type;
 	//! Whether or not the segment can contain NULL values
 	bool has_null;
+	//! The approximate count distinct sketch of the column (if any). Only the statistics of entire columns keep a
+	//! sketch, the statistics of individual segments do not.
+	unique_ptr<DistinctStatistics> distinct_stats;
 
 public:
 	static unique_ptr<BaseStatistics> CreateEmpty(LogicalType type);
@@ -39,6 +43,10 @@ public:
 	virtual void Verify(Vector &vector, idx_t count);
 
 	virtual string ToString();
+
+protected:
+	//! Copy the base statistics into the (freshly created) target statistics
+	void CopyBase(BaseStatistics &target);
 };
 
 } // namespace duckdb
@@ -0,0 +1,47 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/statistics/distinct_statistics.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types/hyperloglog.hpp"
+
+namespace duckdb {
+class Serializer;
+class Deserializer;
+class Vector;
+
+//! The DistinctStatistics keep a HyperLogLog sketch of the (hashed) values of a column, from which the approximate
+//! number of distinct values can be obtained
+class DistinctStatistics {
+public:
+	DistinctStatistics();
+	explicit DistinctStatistics(unique_ptr<HyperLogLog> log);
+
+	//! The HyperLogLog sketch
+	unique_ptr<HyperLogLog> log;
+
+public:
+	//! Add the non-NULL values of a vector to the sketch
+	void Update(Vector &vector, idx_t count);
+	//! Merge the values seen by another sketch into this one
+	void Merge(DistinctStatistics &other);
+	//! Returns the approximate number of distinct non-NULL values
+	idx_t GetCount();
+
+	unique_ptr<DistinctStatistics> Copy();
+	void Serialize(Serializer &serializer);
+	static unique_ptr<DistinctStatistics> Deserialize(Deserializer &source);
+
+private:
+	//! The sketch is updated by appends while the statistics are copied by queries that are being bound
+	mutex lock;
+};
+
+} // namespace duckdb
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/constants.hpp"
+#include "duckdb/common/unordered_map.hpp"
 
 namespace duckdb {
 class Serializer;
@@ -24,6 +25,20 @@ using block_id_t = int64_t;
 // maximum block id, 2^62
 #define MAXIMUM_BLOCK 4611686018427388000LL
 
+//! A location inside a block, used to refer to data that does not start at the beginning of a block
+struct BlockPointer {
+	block_id_t block_id;
+	uint32_t offset;
+};
+
+//! The location of an index that has been written to storage
+struct IndexPointer {
+	//! The location of the root node of the index
+	BlockPointer root;
+	//! The blocks that store the nodes of the index, with the amount of bytes of the nodes stored in each block
+	unordered_map<block_id_t, idx_t> blocks;
+};
+
 //! The MainHeader is the first header in the storage file. The MainHeader is typically written only once for a database
 //! file.
 struct MainHeader {
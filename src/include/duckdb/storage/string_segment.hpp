@@ -95,6 +95,12 @@ protected:
 	void FilterFetchBaseData(ColumnScanState &state, Vector &result, SelectionVector &sel,
 	                         idx_t &approved_tuple_count) override;
 
+	//! Expand the string segment, adding an additional maximum vector to the segment
+	void ExpandStringSegment(data_ptr_t baseptr);
+
+	void SetDictionaryOffset(BufferHandle &handle, idx_t offset);
+	idx_t GetDictionaryOffset(BufferHandle &handle);
+
 private:
 	void AppendData(BufferHandle &handle, SegmentStatistics &stats, data_ptr_t target, data_ptr_t end,
 	                idx_t target_offset, Vector &source, idx_t offset, idx_t count);
@@ -121,9 +127,6 @@ private:
 	void WriteStringMarker(data_ptr_t target, block_id_t block_id, int32_t offset);
 	void ReadStringMarker(data_ptr_t target, block_id_t &block_id, int32_t &offset);
 
-	//! Expand the string segment, adding an additional maximum vector to the segment
-	void ExpandStringSegment(data_ptr_t baseptr);
-
 	string_update_info_t CreateStringUpdate(SegmentStatistics &stats, Vector &update, row_t *ids, idx_t count,
 	                                        idx_t vector_offset);
 	string_update_info_t MergeStringUpdate(SegmentStatistics &stats, Vector &update, row_t *ids, idx_t count,
@@ -199,9 +202,6 @@ private:
 		approved_tuple_count = result_count;
 	}
 
-	void SetDictionaryOffset(BufferHandle &handle, idx_t offset);
-	idx_t GetDictionaryOffset(BufferHandle &handle);
-
 private:
 	//! The max string size that is allowed within a block. Strings bigger than this will be labeled as a BIG STRING and
 	//! offloaded to the overflow blocks.
@@ -11,6 +11,7 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/storage/storage_lock.hpp"
 #include "duckdb/storage/buffer/buffer_handle.hpp"
+#include "duckdb/storage/statistics/distinct_statistics.hpp"
 
 namespace duckdb {
 class TransientSegment;
@@ -20,6 +21,8 @@ struct ColumnAppendState {
 	TransientSegment *current;
 	//! The write lock that is held by the append
 	unique_ptr<StorageLockKey> lock;
+	//! The sketch of the values appended by this append, merged into the statistics of the column by FinalizeAppend
+	unique_ptr<DistinctStatistics> distinct_stats;
 };
 
 struct IndexLock {
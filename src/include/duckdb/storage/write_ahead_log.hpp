@@ -9,12 +9,16 @@
 #pragma once
 
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/enums/wal_type.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
 #include "duckdb/catalog/catalog_entry/sequence_catalog_entry.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <atomic>
+#include <condition_variable>
+
 namespace duckdb {
 
 struct AlterInfo;
@@ -83,7 +87,29 @@ public:
 	void Truncate(int64_t size);
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
+	//! Write a flush marker and make all entries written to the WAL so far durable
 	void Flush();
+	//! Write a flush marker and write all buffered entries to the WAL file, without syncing the file. Returns the
+	//! position in the WAL up to which the file has to be synced for the entries to be durable.
+	idx_t FlushBuffer();
+	//! Sync the WAL file up to at least the given position. Only one thread syncs the file at a time: commits that
+	//! arrive while a sync is in progress are made durable together by the next sync (group commit).
+	void SyncTo(idx_t position);
+	//! Make the entries of a commit that end at the given position durable (see SyncTo)
+	void SyncCommit(idx_t position);
+
+	//! Returns the amount of commits that have been made durable by syncing the WAL
+	idx_t GetCommitCount() {
+		return commit_count;
+	}
+	//! Returns the amount of times the WAL file has been synced
+	idx_t GetSyncCount() {
+		return sync_count;
+	}
+	//! Returns the amount of threads that are waiting for a sync of another thread to finish
+	idx_t GetSyncWaiters() {
+		return sync_waiters;
+	}
 
 	void WriteCheckpoint(block_id_t meta_block);
 
@@ -91,6 +117,26 @@ private:
 	DatabaseInstance &database;
 	unique_ptr<BufferedFileWriter> writer;
 	string wal_path;
+
+	//! Lock for the sync state of the WAL
+	mutex sync_lock;
+	//! Signals the commits that are waiting for a sync that the sync has finished
+	std::condition_variable sync_condition;
+	//! Whether or not a thread is currently syncing the WAL file
+	bool sync_in_progress;
+	//! The amount of threads waiting for the sync in progress to finish
+	std::atomic<idx_t> sync_waiters;
+	//! The position up to which entries have been written to the WAL file
+	std::atomic<idx_t> written_position;
+	//! The position up to which the WAL file has been synced
+	idx_t synced_position;
+	//! Whether or not syncing the WAL file has failed. The entries written before the failed sync might be lost, so no
+	//! later sync can make them (or the entries after them) durable.
+	bool sync_failed;
+	//! The amount of commits that have been made durable
+	std::atomic<idx_t> commit_count;
+	//! The amount of times the WAL file has been synced
+	std::atomic<idx_t> sync_count;
 };
 
 } // namespace duckdb
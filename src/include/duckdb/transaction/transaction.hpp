@@ -37,7 +37,7 @@ public:
 	            timestamp_t start_timestamp, idx_t catalog_version)
 	    : context(move(context)), start_time(start_time), transaction_id(transaction_id), commit_id(0),
 	      highest_active_query(0), active_query(MAXIMUM_QUERY_ID), start_timestamp(start_timestamp),
-	      catalog_version(catalog_version), storage(*this), is_invalidated(false) {
+	      catalog_version(catalog_version), storage(*this), is_invalidated(false), wal_position(0) {
 	}
 
 	weak_ptr<ClientContext> context;
@@ -62,6 +62,9 @@ public:
 	unordered_map<SequenceCatalogEntry *, SequenceValue> sequence_usage;
 	//! Whether or not the transaction has been invalidated
 	bool is_invalidated;
+	//! The position up to which the WAL has to be synced for the commit of the transaction to be durable, or 0 if the
+	//! commit did not write to the WAL
+	idx_t wal_position;
 
 public:
 	static Transaction &GetTransaction(ClientContext &context);
@@ -69,7 +72,8 @@ public:
 	void PushCatalogEntry(CatalogEntry *entry, data_ptr_t extra_data = nullptr, idx_t extra_data_size = 0);
 
 	//! Commit the current transaction with the given commit identifier. Returns an error message if the transaction
-	//! commit failed, or an empty string if the commit was sucessful
+	//! commit failed, or an empty string if the commit was sucessful. The changes are written to the WAL, but the WAL
+	//! is not synced: the commit is durable once the WAL has been synced up to wal_position.
 	string Commit(DatabaseInstance &db, transaction_t commit_id, bool checkpoint) noexcept;
 	//! Returns whether or not a commit of this transaction should trigger an automatic checkpoint
 	bool AutomaticCheckpoint(DatabaseInstance &db);
@@ -14,6 +14,7 @@
 #include "duckdb/common/vector.hpp"
 
 #include <atomic>
+#include <map>
 
 namespace duckdb {
 
@@ -61,7 +62,15 @@ private:
 	bool CanCheckpoint(Transaction *current = nullptr);
 	//! Remove the given transaction from the list of active transactions
 	void RemoveTransaction(Transaction *transaction) noexcept;
+	//! Clean up the committed transactions that are no longer visible to any transaction, and free the memory of the
+	//! transactions and catalog sets that are no longer used by any query
+	void GarbageCollect() noexcept;
 	void LockClients(vector<ClientLockWrapper> &client_locks, ClientContext &context);
+	//! Returns the start time of a transaction that sees all durable commits, but none of the unsynced ones
+	transaction_t GetDurableStartTime();
+	//! Called after the WAL has been synced up to the given position for a commit: the commits written before that
+	//! position become visible to new transactions
+	void FinishSync(idx_t wal_position);
 
 	//! The database instance
 	DatabaseInstance &db;
@@ -81,6 +90,9 @@ private:
 	vector<StoredCatalogSet> old_catalog_sets;
 	//! The lock used for transaction operations
 	mutex transaction_lock;
+	//! The commits whose changes have been written to the WAL, but not yet synced (commit id -> WAL position). New
+	//! transactions start before the lowest unsynced commit, so a commit only becomes visible once it is durable
+	std::map<transaction_t, idx_t> unsynced_commits;
 
 	bool thread_is_checkpointing;
 };
@@ -201,7 +201,8 @@ unique_ptr<QueryResult> ClientContext::ExecutePreparedStatement(ClientContextLoc
 	bool create_stream_result = statement.allow_stream_result && allow_stream_result;
 
 	// store the physical plan in the context for calls to Fetch()
-	executor.Initialize(statement.plan.get());
+	// a materialized result can be collected by multiple threads, a streaming result is pulled by the client
+	executor.Initialize(statement.plan.get(), !create_stream_result);
 
 	auto types = executor.GetTypes();
 
@@ -177,6 +177,7 @@ void DatabaseInstance::Configure(DBConfig &new_config) {
 	config.use_direct_io = new_config.use_direct_io;
 	config.maximum_memory = new_config.maximum_memory;
 	config.temporary_directory = new_config.temporary_directory;
+	config.eviction_policy = new_config.eviction_policy;
 	config.collation = new_config.collation;
 	config.default_order_type = new_config.default_order_type;
 	config.default_null_order = new_config.default_null_order;
@@ -220,7 +220,10 @@ void QueryProfiler::Flush(OperatorProfiler &profiler) {
 
 	for (auto &node : profiler.timings) {
 		auto entry = tree_map.find(node.first);
-		D_ASSERT(entry != tree_map.end());
+		if (entry == tree_map.end()) {
+			// operator that is not part of the plan itself (i.e. the result collector): not profiled
+			continue;
+		}
 
 		entry->second->info.time += node.second.time;
 		entry->second->info.elements += node.second.elements;
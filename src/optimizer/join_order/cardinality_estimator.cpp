@@ -0,0 +1,391 @@
+#include "duckdb/optimizer/join_order/cardinality_estimator.hpp"
+
+#include "duckdb/common/types/hugeint.hpp"
+#include "duckdb/common/unordered_set.hpp"
+#include "duckdb/planner/expression/list.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/storage/statistics/distinct_statistics.hpp"
+#include "duckdb/storage/statistics/numeric_statistics.hpp"
+#include "duckdb/storage/statistics/string_statistics.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace duckdb {
+
+constexpr double CardinalityEstimator::DEFAULT_SELECTIVITY;
+constexpr double CardinalityEstimator::DEFAULT_RANGE_SELECTIVITY;
+
+CardinalityEstimator::CardinalityEstimator(ClientContext &context) : context(context) {
+}
+
+//! Returns the base table scan of a relation (below any filters), or nullptr if the relation is not a base table
+static LogicalGet *GetBaseTableScan(LogicalOperator *op) {
+	while (op->type != LogicalOperatorType::LOGICAL_GET && op->type != LogicalOperatorType::LOGICAL_PROJECTION &&
+	       op->children.size() == 1) {
+		op = op->children[0].get();
+	}
+	return op->type == LogicalOperatorType::LOGICAL_GET ? (LogicalGet *)op : nullptr;
+}
+
+void CardinalityEstimator::AddRelation(LogicalOperator *op) {
+	auto get = GetBaseTableScan(op);
+	if (get) {
+		gets[get->table_index] = get;
+	}
+}
+
+BaseStatistics *CardinalityEstimator::GetStatistics(LogicalGet &get, column_t column_id) {
+	ColumnBinding key(get.table_index, column_id);
+	auto entry = column_statistics.find(key);
+	if (entry != column_statistics.end()) {
+		return entry->second.get();
+	}
+	unique_ptr<BaseStatistics> stats;
+	if (get.function.statistics && column_id != COLUMN_IDENTIFIER_ROW_ID) {
+		stats = get.function.statistics(context, get.bind_data.get(), column_id);
+	}
+	auto result = stats.get();
+	column_statistics[key] = move(stats);
+	return result;
+}
+
+BaseStatistics *CardinalityEstimator::GetStatistics(Expression &expr) {
+	if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+		return nullptr;
+	}
+	auto &colref = (BoundColumnRefExpression &)expr;
+	auto entry = gets.find(colref.binding.table_index);
+	if (entry == gets.end() || colref.binding.column_index >= entry->second->column_ids.size()) {
+		return nullptr;
+	}
+	auto &get = *entry->second;
+	return GetStatistics(get, get.column_ids[colref.binding.column_index]);
+}
+
+//! Returns the number of distinct values of a column, or 0 if it is not known
+static double GetDistinctCount(BaseStatistics *stats) {
+	if (!stats || !stats->distinct_stats) {
+		return 0;
+	}
+	return stats->distinct_stats->GetCount();
+}
+
+//! Returns false if the statistics guarantee that no value of the column satisfies the comparison with the constant
+static bool CheckZonemap(BaseStatistics &stats, ExpressionType comparison_type, const Value &constant) {
+	switch (comparison_type) {
+	case ExpressionType::COMPARE_EQUAL:
+	case ExpressionType::COMPARE_LESSTHAN:
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+	case ExpressionType::COMPARE_GREATERTHAN:
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		break;
+	default:
+		// the zonemaps can only be checked for equality and range comparisons
+		return true;
+	}
+	if (constant.type() != stats.type) {
+		return true;
+	}
+	switch (stats.type.InternalType()) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return ((NumericStatistics &)stats).CheckZonemap(comparison_type, constant);
+	case PhysicalType::VARCHAR:
+		return ((StringStatistics &)stats).CheckZonemap(comparison_type, constant.ToString());
+	default:
+		return true;
+	}
+}
+
+static bool GetNumericValue(Value value, double &result) {
+	if (value.is_null) {
+		return false;
+	}
+	switch (value.type().InternalType()) {
+	case PhysicalType::INT8:
+		result = value.GetValueUnsafe<int8_t>();
+		return true;
+	case PhysicalType::INT16:
+		result = value.GetValueUnsafe<int16_t>();
+		return true;
+	case PhysicalType::INT32:
+		result = value.GetValueUnsafe<int32_t>();
+		return true;
+	case PhysicalType::INT64:
+		result = value.GetValueUnsafe<int64_t>();
+		return true;
+	case PhysicalType::INT128:
+		return Hugeint::TryCast(value.GetValueUnsafe<hugeint_t>(), result);
+	case PhysicalType::FLOAT:
+		result = value.GetValueUnsafe<float>();
+		return true;
+	case PhysicalType::DOUBLE:
+		result = value.GetValueUnsafe<double>();
+		return true;
+	default:
+		return false;
+	}
+}
+
+//! Estimate the fraction of a numeric column that lies in [lower, upper] (a nullptr denotes an open bound), assuming
+//! that the values are distributed uniformly between the min and max of the column
+static double EstimateRangeSelectivity(BaseStatistics &stats, const Value *lower, const Value *upper) {
+	if (!TypeIsNumeric(stats.type.InternalType())) {
+		return CardinalityEstimator::DEFAULT_RANGE_SELECTIVITY;
+	}
+	auto &nstats = (NumericStatistics &)stats;
+	double min, max;
+	if (!GetNumericValue(nstats.min, min) || !GetNumericValue(nstats.max, max) || max < min) {
+		return CardinalityEstimator::DEFAULT_RANGE_SELECTIVITY;
+	}
+	double range_min = min, range_max = max;
+	if (lower && (lower->type() != stats.type || !GetNumericValue(*lower, range_min))) {
+		return CardinalityEstimator::DEFAULT_RANGE_SELECTIVITY;
+	}
+	if (upper && (upper->type() != stats.type || !GetNumericValue(*upper, range_max))) {
+		return CardinalityEstimator::DEFAULT_RANGE_SELECTIVITY;
+	}
+	range_min = MaxValue<double>(range_min, min);
+	range_max = MinValue<double>(range_max, max);
+	if (range_max < range_min) {
+		return 0;
+	}
+	if (max == min) {
+		return 1;
+	}
+	// a range that contains a value selects at least one of the distinct values
+	auto distinct_count = GetDistinctCount(&stats);
+	double minimum_selectivity = distinct_count > 0 ? 1 / distinct_count : 0;
+	return MinValue<double>(MaxValue<double>((range_max - range_min) / (max - min), minimum_selectivity), 1);
+}
+
+static double EstimateComparisonSelectivity(ExpressionType comparison_type, BaseStatistics *stats,
+                                            const Value &constant) {
+	if (constant.is_null) {
+		// comparisons with NULL are never true
+		return 0;
+	}
+	if (stats && !CheckZonemap(*stats, comparison_type, constant)) {
+		return 0;
+	}
+	auto distinct_count = GetDistinctCount(stats);
+	switch (comparison_type) {
+	case ExpressionType::COMPARE_EQUAL:
+		return distinct_count > 0 ? 1 / distinct_count : CardinalityEstimator::DEFAULT_SELECTIVITY;
+	case ExpressionType::COMPARE_NOTEQUAL:
+		return distinct_count > 0 ? 1 - 1 / distinct_count : 1 - CardinalityEstimator::DEFAULT_SELECTIVITY;
+	case ExpressionType::COMPARE_LESSTHAN:
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		return stats ? EstimateRangeSelectivity(*stats, nullptr, &constant)
+		             : CardinalityEstimator::DEFAULT_RANGE_SELECTIVITY;
+	case ExpressionType::COMPARE_GREATERTHAN:
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		return stats ? EstimateRangeSelectivity(*stats, &constant, nullptr)
+		             : CardinalityEstimator::DEFAULT_RANGE_SELECTIVITY;
+	default:
+		return CardinalityEstimator::DEFAULT_SELECTIVITY;
+	}
+}
+
+//! Extract the columns of the base table scan that are referenced by an expression
+static void ExtractFilteredColumns(Expression &expr, LogicalGet &get, unordered_set<column_t> &columns) {
+	if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
+		auto &colref = (BoundColumnRefExpression &)expr;
+		if (colref.binding.table_index == get.table_index && colref.binding.column_index < get.column_ids.size()) {
+			columns.insert(get.column_ids[colref.binding.column_index]);
+		}
+	}
+	ExpressionIterator::EnumerateChildren(
+	    expr, [&](Expression &child) { ExtractFilteredColumns(child, get, columns); });
+}
+
+double CardinalityEstimator::EstimateCardinality(LogicalOperator *op, const vector<Expression *> &filters) {
+	double cardinality = op->EstimateCardinality(context);
+	double selectivity = 1;
+	for (auto &filter : filters) {
+		selectivity *= EstimateFilterSelectivity(*filter);
+	}
+	auto get = GetBaseTableScan(op);
+	if (get && !get->table_filters.empty()) {
+		// the filters with constants are pushed into the scan by the filter pushdown; the scan can also hold zonemap
+		// checks derived from the remaining filters, we skip those because the filters themselves are estimated
+		unordered_set<column_t> filtered_columns;
+		for (auto &filter : filters) {
+			ExtractFilteredColumns(*filter, *get, filtered_columns);
+		}
+		unordered_map<column_t, vector<TableFilter *>> column_filters;
+		for (auto &table_filter : get->table_filters) {
+			if (filtered_columns.find(table_filter.column_index) == filtered_columns.end()) {
+				column_filters[table_filter.column_index].push_back(&table_filter);
+			}
+		}
+		for (auto &entry : column_filters) {
+			selectivity *= EstimateTableFilterSelectivity(*get, entry.first, entry.second);
+		}
+	}
+	// even if the statistics tell us that no tuple qualifies, we do not want to rely on that completely
+	return MaxValue<double>(cardinality * selectivity, MinValue<double>(cardinality, 1));
+}
+
+double CardinalityEstimator::EstimateTableFilterSelectivity(LogicalGet &get, column_t column_id,
+                                                            const vector<TableFilter *> &filters) {
+	auto stats = GetStatistics(get, column_id);
+	// the filters on a column are conjunctive: the range filters are combined into a single range
+	double selectivity = 1;
+	const Value *lower = nullptr, *upper = nullptr;
+	for (auto &filter : filters) {
+		auto filter_selectivity = EstimateComparisonSelectivity(filter->comparison_type, stats, filter->constant);
+		if (!stats || filter_selectivity == 0) {
+			selectivity = MinValue<double>(selectivity, filter_selectivity);
+			continue;
+		}
+		switch (filter->comparison_type) {
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			if (!upper || filter->constant < *upper) {
+				upper = &filter->constant;
+			}
+			break;
+		case ExpressionType::COMPARE_GREATERTHAN:
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			if (!lower || filter->constant > *lower) {
+				lower = &filter->constant;
+			}
+			break;
+		default:
+			selectivity = MinValue<double>(selectivity, filter_selectivity);
+			break;
+		}
+	}
+	if (lower || upper) {
+		selectivity = MinValue<double>(selectivity, EstimateRangeSelectivity(*stats, lower, upper));
+	}
+	return selectivity;
+}
+
+double CardinalityEstimator::EstimateFilterSelectivity(Expression &filter) {
+	switch (filter.GetExpressionClass()) {
+	case ExpressionClass::BOUND_COMPARISON: {
+		auto &comparison = (BoundComparisonExpression &)filter;
+		if (comparison.right->type == ExpressionType::VALUE_CONSTANT) {
+			return EstimateComparisonSelectivity(comparison.type, GetStatistics(*comparison.left),
+			                                     ((BoundConstantExpression &)*comparison.right).value);
+		}
+		if (comparison.left->type == ExpressionType::VALUE_CONSTANT) {
+			return EstimateComparisonSelectivity(FlipComparisionExpression(comparison.type),
+			                                     GetStatistics(*comparison.right),
+			                                     ((BoundConstantExpression &)*comparison.left).value);
+		}
+		return DEFAULT_SELECTIVITY;
+	}
+	case ExpressionClass::BOUND_BETWEEN: {
+		auto &between = (BoundBetweenExpression &)filter;
+		auto stats = GetStatistics(*between.input);
+		if (!stats || between.lower->type != ExpressionType::VALUE_CONSTANT ||
+		    between.upper->type != ExpressionType::VALUE_CONSTANT) {
+			return DEFAULT_SELECTIVITY;
+		}
+		return EstimateRangeSelectivity(*stats, &((BoundConstantExpression &)*between.lower).value,
+		                                &((BoundConstantExpression &)*between.upper).value);
+	}
+	case ExpressionClass::BOUND_CONJUNCTION: {
+		auto &conjunction = (BoundConjunctionExpression &)filter;
+		if (conjunction.type == ExpressionType::CONJUNCTION_AND) {
+			double selectivity = 1;
+			for (auto &child : conjunction.children) {
+				selectivity *= EstimateFilterSelectivity(*child);
+			}
+			return selectivity;
+		} else {
+			// assume the children of an OR are independent
+			double inverse_selectivity = 1;
+			for (auto &child : conjunction.children) {
+				inverse_selectivity *= 1 - EstimateFilterSelectivity(*child);
+			}
+			return 1 - inverse_selectivity;
+		}
+	}
+	case ExpressionClass::BOUND_OPERATOR: {
+		auto &op = (BoundOperatorExpression &)filter;
+		switch (op.type) {
+		case ExpressionType::OPERATOR_NOT:
+			return 1 - EstimateFilterSelectivity(*op.children[0]);
+		case ExpressionType::OPERATOR_IS_NULL: {
+			auto stats = GetStatistics(*op.children[0]);
+			return stats && !stats->has_null ? 0 : DEFAULT_SELECTIVITY;
+		}
+		case ExpressionType::OPERATOR_IS_NOT_NULL: {
+			auto stats = GetStatistics(*op.children[0]);
+			return stats && !stats->has_null ? 1 : 1 - DEFAULT_SELECTIVITY;
+		}
+		case ExpressionType::COMPARE_IN: {
+			auto distinct_count = GetDistinctCount(GetStatistics(*op.children[0]));
+			if (distinct_count <= 0) {
+				return DEFAULT_SELECTIVITY;
+			}
+			return MinValue<double>(double(op.children.size() - 1) / distinct_count, 1);
+		}
+		default:
+			return DEFAULT_SELECTIVITY;
+		}
+	}
+	default:
+		return DEFAULT_SELECTIVITY;
+	}
+}
+
+double CardinalityEstimator::EstimateJoinSelectivity(const vector<Expression *> &conditions,
+                                                     const vector<bool> &left_sides, double left_cardinality,
+                                                     double right_cardinality) {
+	D_ASSERT(conditions.size() == left_sides.size());
+	vector<double> selectivities;
+	for (idx_t i = 0; i < conditions.size(); i++) {
+		D_ASSERT(conditions[i]->GetExpressionClass() == ExpressionClass::BOUND_COMPARISON);
+		auto &comparison = (BoundComparisonExpression &)*conditions[i];
+		auto &left = left_sides[i] ? *comparison.left : *comparison.right;
+		auto &right = left_sides[i] ? *comparison.right : *comparison.left;
+		switch (comparison.type) {
+		case ExpressionType::COMPARE_EQUAL:
+		case ExpressionType::COMPARE_NOT_DISTINCT_FROM: {
+			// a side cannot have more distinct values than tuples
+			auto left_distinct = MinValue<double>(GetDistinctCount(GetStatistics(left)), left_cardinality);
+			auto right_distinct = MinValue<double>(GetDistinctCount(GetStatistics(right)), right_cardinality);
+			double distinct_count;
+			if (left_distinct <= 0 && right_distinct <= 0) {
+				// no statistics on either side: assume a foreign key join, i.e. the smaller side holds the keys
+				distinct_count = MinValue<double>(left_cardinality, right_cardinality);
+			} else {
+				// every tuple of the side with the fewest distinct values finds a partner on the other side
+				distinct_count = MaxValue<double>(left_distinct, right_distinct);
+			}
+			selectivities.push_back(1 / MaxValue<double>(distinct_count, 1));
+			break;
+		}
+		case ExpressionType::COMPARE_NOTEQUAL:
+		case ExpressionType::COMPARE_DISTINCT_FROM:
+			selectivities.push_back(1);
+			break;
+		default:
+			selectivities.push_back(DEFAULT_RANGE_SELECTIVITY);
+			break;
+		}
+	}
+	// the conditions of a join are often correlated (e.g. composite keys): instead of assuming independence, dampen
+	// the effect of every additional condition by starting from the most selective one (exponential backoff)
+	std::sort(selectivities.begin(), selectivities.end());
+	double selectivity = 1, exponent = 1;
+	for (auto &condition_selectivity : selectivities) {
+		selectivity *= std::pow(condition_selectivity, exponent);
+		exponent /= 2;
+	}
+	return selectivity;
+}
+
+} // namespace duckdb
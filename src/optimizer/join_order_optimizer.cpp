@@ -190,8 +190,8 @@ static void UpdateExclusionSet(JoinRelationSet *node, unordered_set<idx_t> &excl
 	}
 }
 
-//! Create a new JoinTree node by joining together two previous JoinTree nodes
-static unique_ptr<JoinNode> CreateJoinTree(JoinRelationSet *set, NeighborInfo *info, JoinNode *left, JoinNode *right) {
+unique_ptr<JoinNode> JoinOrderOptimizer::CreateJoinTree(JoinRelationSet *set, NeighborInfo *info, JoinNode *left,
+                                                        JoinNode *right) {
 	// for the hash join we want the right side (build side) to have the smallest cardinality
 	// also just a heuristic but for now...
 	// FIXME: we should probably actually benchmark that as well
@@ -199,19 +199,30 @@ static unique_ptr<JoinNode> CreateJoinTree(JoinRelationSet *set, NeighborInfo *i
 	if (left->cardinality < right->cardinality) {
 		return CreateJoinTree(set, info, right, left);
 	}
-	// the expected cardinality is the max of the child cardinalities
-	// FIXME: we should obviously use better cardinality estimation here
-	// but for now we just assume foreign key joins only
-	idx_t expected_cardinality;
-	if (info->filters.empty()) {
-		// cross product
-		expected_cardinality = left->cardinality * right->cardinality;
-	} else {
-		// normal join, expect foreign key join
-		expected_cardinality = MaxValue(left->cardinality, right->cardinality);
+	// gather all the conditions that connect the two sides: besides the edge that is used to join them, there can be
+	// several other (e.g. implied) conditions between the relations of both sides
+	vector<Expression *> conditions;
+	vector<bool> left_sides;
+	for (auto &filter_info : filter_infos) {
+		if (!filter_info->left_set || !filter_info->right_set) {
+			continue;
+		}
+		if (JoinRelationSet::IsSubset(left->set, filter_info->left_set) &&
+		    JoinRelationSet::IsSubset(right->set, filter_info->right_set)) {
+			conditions.push_back(filters[filter_info->filter_index].get());
+			left_sides.push_back(true);
+		} else if (JoinRelationSet::IsSubset(left->set, filter_info->right_set) &&
+		           JoinRelationSet::IsSubset(right->set, filter_info->left_set)) {
+			conditions.push_back(filters[filter_info->filter_index].get());
+			left_sides.push_back(false);
+		}
 	}
+	// without any conditions this is a cross product, which has a selectivity of 1
+	auto selectivity =
+	    estimator.EstimateJoinSelectivity(conditions, left_sides, left->cardinality, right->cardinality);
+	double expected_cardinality = left->cardinality * right->cardinality * selectivity;
 	// cost is expected_cardinality plus the cost of the previous plans
-	idx_t cost = expected_cardinality;
+	double cost = expected_cardinality + left->cost + right->cost;
 	return make_unique<JoinNode>(set, info, left, right, expected_cardinality, cost);
 }
 
@@ -666,7 +677,6 @@ unique_ptr<LogicalOperator> JoinOrderOptimizer::RewritePlan(unique_ptr<LogicalOp
 // the join ordering is pretty much a straight implementation of the paper "Dynamic Programming Strikes Back" by Guido
 // Moerkotte and Thomas Neumannn, see that paper for additional info/documentation bonus slides:
 // https://db.in.tum.de/teaching/ws1415/queryopt/chapter3.pdf?lang=de
-// FIXME: incorporate cardinality estimation into the plans, possibly by pushing samples?
 unique_ptr<LogicalOperator> JoinOrderOptimizer::Optimize(unique_ptr<LogicalOperator> plan) {
 	D_ASSERT(filters.empty() && relations.empty()); // assert that the JoinOrderOptimizer has not been used before
 	LogicalOperator *op = plan.get();
@@ -763,10 +773,18 @@ unique_ptr<LogicalOperator> JoinOrderOptimizer::Optimize(unique_ptr<LogicalOpera
 	// First we initialize each of the single-node plans with themselves and with their cardinalities these are the leaf
 	// nodes of the join tree NOTE: we can just use pointers to JoinRelationSet* here because the GetJoinRelation
 	// function ensures that a unique combination of relations will have a unique JoinRelationSet object.
+	// the estimated cardinality of the leaf nodes takes the filters on the single relations into account
+	vector<vector<Expression *>> relation_filters(relations.size());
+	for (auto &filter_info : filter_infos) {
+		if (filter_info->set->count == 1) {
+			relation_filters[filter_info->set->relations[0]].push_back(filters[filter_info->filter_index].get());
+		}
+	}
 	for (idx_t i = 0; i < relations.size(); i++) {
 		auto &rel = *relations[i];
+		estimator.AddRelation(rel.op);
 		auto node = set_manager.GetJoinRelation(i);
-		plans[node] = make_unique<JoinNode>(node, rel.op->EstimateCardinality(context));
+		plans[node] = make_unique<JoinNode>(node, estimator.EstimateCardinality(rel.op, relation_filters[i]));
 	}
 	// now we perform the actual dynamic programming to compute the final result
 	SolveJoinOrder();
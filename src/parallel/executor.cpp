@@ -1,6 +1,7 @@
 #include "duckdb/execution/executor.hpp"
 
 #include "duckdb/execution/operator/helper/physical_execute.hpp"
+#include "duckdb/execution/operator/helper/physical_result_collector.hpp"
 #include "duckdb/execution/operator/join/physical_delim_join.hpp"
 #include "duckdb/execution/operator/scan/physical_chunk_scan.hpp"
 #include "duckdb/execution/operator/set/physical_recursive_cte.hpp"
@@ -21,17 +22,31 @@ Executor::Executor(ClientContext &context) : context(context) {
 Executor::~Executor() {
 }
 
-void Executor::Initialize(PhysicalOperator *plan) {
+void Executor::Initialize(PhysicalOperator *plan, bool collect_result) {
 	Reset();
 
 	physical_plan = plan;
-	physical_state = physical_plan->GetOperatorState();
 
 	context.profiler.Initialize(physical_plan);
 	auto &scheduler = TaskScheduler::GetScheduler(context);
 	this->producer = scheduler.CreateProducer();
 
-	BuildPipelines(physical_plan, nullptr);
+	if (collect_result && PhysicalResultCollector::CanCollectInParallel(context, plan)) {
+		// the final pipeline of the plan can be executed in parallel: collect the result in a pipeline of its own
+		// instead of pulling it through the plan in FetchChunk
+		result_collector = make_unique<PhysicalResultCollector>(plan);
+		auto pipeline = make_unique<Pipeline>(*this, *producer);
+		pipeline->sink = result_collector.get();
+		pipeline->sink_state = result_collector->GetGlobalState(context);
+		pipeline->child = plan;
+		BuildPipelines(plan, pipeline.get());
+		pipelines.push_back(move(pipeline));
+		// the result is fetched from the result collector
+		physical_plan = result_collector.get();
+	} else {
+		BuildPipelines(physical_plan, nullptr);
+	}
+	physical_state = physical_plan->GetOperatorState();
 
 	this->total_pipelines = pipelines.size();
 
@@ -63,6 +78,7 @@ void Executor::Reset() {
 	recursive_cte = nullptr;
 	physical_plan = nullptr;
 	physical_state = nullptr;
+	result_collector = nullptr;
 	completed_pipelines = 0;
 	total_pipelines = 0;
 	exceptions.clear();
@@ -11,6 +11,9 @@
 #include "duckdb/execution/operator/aggregate/physical_simple_aggregate.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
+#include "duckdb/execution/operator/join/physical_hash_join.hpp"
+#include "duckdb/execution/operator/persistent/physical_copy_to_file.hpp"
+#include "duckdb/execution/operator/helper/physical_result_collector.hpp"
 
 namespace duckdb {
 
@@ -99,14 +102,27 @@ bool Pipeline::ScheduleOperator(PhysicalOperator *op) {
 	case PhysicalOperatorType::UNNEST:
 	case PhysicalOperatorType::FILTER:
 	case PhysicalOperatorType::PROJECTION:
-	case PhysicalOperatorType::HASH_JOIN:
 	case PhysicalOperatorType::CROSS_PRODUCT:
 	case PhysicalOperatorType::STREAMING_SAMPLE:
-		// filter, projection or hash probe: continue in children
+		// unnest, filter, projection, cross product or streaming sample: every chunk of the child is processed on its
+		// own, continue in children
 		return ScheduleOperator(op->children[0].get());
+	case PhysicalOperatorType::HASH_JOIN: {
+		auto &join = (PhysicalHashJoin &)*op;
+		if (join.IsPartitioned()) {
+			// the partitions of a partitioned hash join are probed after the probe side is exhausted
+			return false;
+		}
+		if (IsRightOuterJoin(join.join_type)) {
+			// the unmatched build rows of a FULL/RIGHT OUTER join can only be scanned after the entire probe side has
+			// been processed, which is not the case when a single thread runs out of probe rows
+			return false;
+		}
+		// hash probe: continue in children
+		return ScheduleOperator(op->children[0].get());
+	}
 	case PhysicalOperatorType::TABLE_SCAN: {
 		// we reached a scan: split it up into parts and schedule the parts
-		auto &scheduler = TaskScheduler::GetScheduler(executor.context);
 		auto &get = (PhysicalTableScan &)*op;
 		if (!get.function.max_threads) {
 			// table function cannot be parallelized
@@ -122,20 +138,23 @@ bool Pipeline::ScheduleOperator(PhysicalOperator *op) {
 			// table is too small to parallelize
 			return false;
 		}
-		this->parallel_state = get.function.init_parallel_state(executor.context, get.bind_data.get());
-		this->parallel_node = op;
-
-		// launch a task for every thread
-		this->total_tasks = max_threads;
-		for (idx_t i = 0; i < max_threads; i++) {
-			auto task = make_unique<PipelineTask>(this);
-			scheduler.ScheduleTask(*executor.producer, move(task));
-		}
+		LaunchScanTasks(op, max_threads, get.function.init_parallel_state(executor.context, get.bind_data.get()));
 		return true;
 	}
 	case PhysicalOperatorType::HASH_GROUP_BY: {
-		// FIXME: parallelize scan of GROUP_BY HT
-		return false;
+		// the finalized HTs of the aggregate are independent: they can be scanned by different threads
+		auto &hash_aggr = (PhysicalHashAggregate &)*op;
+		if (!hash_aggr.all_combinable || hash_aggr.any_distinct) {
+			// the sink finalizes DISTINCT or non-combinable aggregates into a single HT: scan it sequentially
+			return false;
+		}
+		idx_t max_threads = MinValue<idx_t>(hash_aggr.MaxThreads(), executor.context.db->NumberOfThreads());
+		if (max_threads <= 1) {
+			// only a single HT: scan it sequentially
+			return false;
+		}
+		LaunchScanTasks(op, max_threads, hash_aggr.GetParallelState());
+		return true;
 	}
 	default:
 		// unknown operator: skip parallel task scheduling
@@ -143,6 +162,19 @@ bool Pipeline::ScheduleOperator(PhysicalOperator *op) {
 	}
 }
 
+void Pipeline::LaunchScanTasks(PhysicalOperator *op, idx_t max_threads, unique_ptr<ParallelState> state) {
+	auto &scheduler = TaskScheduler::GetScheduler(executor.context);
+	this->parallel_state = move(state);
+	this->parallel_node = op;
+
+	// launch a task for every thread
+	this->total_tasks = max_threads;
+	for (idx_t i = 0; i < max_threads; i++) {
+		auto task = make_unique<PipelineTask>(this);
+		scheduler.ScheduleTask(*executor.producer, move(task));
+	}
+}
+
 void Pipeline::ClearParents() {
 	for (auto &parent : parents) {
 		parent->dependencies.erase(this);
@@ -212,6 +244,26 @@ void Pipeline::Schedule() {
 		}
 		break;
 	}
+	case PhysicalOperatorType::COPY_TO_FILE: {
+		auto &copy = (PhysicalCopyToFile &)*sink;
+		if (!copy.function.parallel) {
+			// the copy function does not support parallel writes: switch to sequential mode
+			break;
+		}
+		auto copy_child = sink->children[0].get();
+		bool preserves_order =
+		    !copy.function.copy_to_preserves_order || copy.function.copy_to_preserves_order(*copy.bind_data);
+		if (preserves_order && !PhysicalResultCollector::CanCollectInParallel(executor.context, copy_child)) {
+			// the rows are written in the order of the child, which can only be restored if the scan of the child
+			// provides a batch index
+			break;
+		}
+		if (ScheduleOperator(copy_child)) {
+			// all parallel tasks have been scheduled: return
+			return;
+		}
+		break;
+	}
 	case PhysicalOperatorType::WINDOW: {
 		// schedule child op
 		if (ScheduleOperator(sink->children[0].get())) {
@@ -220,6 +272,14 @@ void Pipeline::Schedule() {
 		}
 		break;
 	}
+	case PhysicalOperatorType::RESULT_COLLECTOR: {
+		// the result collector does not own the plan: schedule the child of the pipeline
+		if (ScheduleOperator(child)) {
+			// all parallel tasks have been scheduled: return
+			return;
+		}
+		break;
+	}
 	default:
 		break;
 	}
@@ -0,0 +1,86 @@
+#include "duckdb/parallel/task_executor.hpp"
+
+namespace duckdb {
+
+class ExecutorTask : public Task {
+public:
+	ExecutorTask(TaskExecutor &executor, std::function<void()> work) : executor(executor), work(move(work)) {
+	}
+
+	void Execute() override {
+		std::exception_ptr error;
+		if (!executor.HasError()) {
+			// skip the work item if another one has already failed
+			try {
+				work();
+			} catch (...) {
+				error = std::current_exception();
+			}
+		}
+		executor.FinishTask(move(error));
+	}
+
+private:
+	TaskExecutor &executor;
+	std::function<void()> work;
+};
+
+TaskExecutor::TaskExecutor(TaskScheduler &scheduler)
+    : scheduler(scheduler), producer(scheduler.CreateProducer()), scheduled_tasks(0), finished_tasks(0) {
+}
+
+TaskExecutor::~TaskExecutor() {
+	// the tasks refer to the executor: they have to be finished before it is destroyed
+	WaitForTasks();
+}
+
+void TaskExecutor::ScheduleTask(std::function<void()> work) {
+	{
+		lock_guard<mutex> guard(executor_lock);
+		scheduled_tasks++;
+	}
+	scheduler.ScheduleTask(*producer, make_unique<ExecutorTask>(*this, move(work)));
+}
+
+void TaskExecutor::FinishTask(std::exception_ptr task_error) {
+	lock_guard<mutex> guard(executor_lock);
+	if (task_error && !error) {
+		error = move(task_error);
+	}
+	finished_tasks++;
+	if (finished_tasks == scheduled_tasks) {
+		finished_condition.notify_all();
+	}
+}
+
+bool TaskExecutor::HasError() {
+	lock_guard<mutex> guard(executor_lock);
+	return bool(error);
+}
+
+void TaskExecutor::WaitForTasks() {
+	// execute the pending tasks from this thread
+	unique_ptr<Task> task;
+	while (scheduler.GetTaskFromProducer(*producer, task)) {
+		task->Execute();
+		task.reset();
+	}
+	// all tasks have been picked up: wait for the ones executed by other threads to finish
+	std::unique_lock<mutex> guard(executor_lock);
+	finished_condition.wait(guard, [&] { return finished_tasks == scheduled_tasks; });
+}
+
+void TaskExecutor::WorkOnTasks() {
+	WaitForTasks();
+	std::exception_ptr task_error;
+	{
+		lock_guard<mutex> guard(executor_lock);
+		task_error = move(error);
+		error = nullptr;
+	}
+	if (task_error) {
+		std::rethrow_exception(task_error);
+	}
+}
+
+} // namespace duckdb
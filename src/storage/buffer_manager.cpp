@@ -3,10 +3,135 @@
 #include "duckdb/storage/storage_manager.hpp"
 
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/set.hpp"
+#include "duckdb/common/unordered_set.hpp"
+#include "duckdb/main/config.hpp"
 #include "concurrentqueue.h"
 
+#include <deque>
+
 namespace duckdb {
 
+struct BufferEvictionNode {
+	BufferEvictionNode(weak_ptr<BlockHandle> handle_p, idx_t timestamp_p)
+	    : handle(move(handle_p)), timestamp(timestamp_p) {
+		D_ASSERT(!handle.expired());
+	}
+
+	weak_ptr<BlockHandle> handle;
+	idx_t timestamp;
+
+	bool CanUnload(BlockHandle &handle) {
+		if (timestamp != handle.eviction_timestamp) {
+			// handle was used in between
+			return false;
+		}
+		return handle.CanUnload();
+	}
+};
+
+typedef moodycamel::ConcurrentQueue<unique_ptr<BufferEvictionNode>> eviction_queue_t;
+
+//! The EvictionQueue holds the unpinned blocks that are candidates for eviction. With the LRU policy all blocks are
+//! placed in the probationary queue. With the TWO_QUEUE policy blocks that are loaded again shortly after being evicted
+//! from the probationary queue (i.e. their id is still in the ghost queue), or that are pinned again after the
+//! correlated reference period, are placed in the protected queue. The correlated reference period of a block lasts
+//! until a quarter of the memory limit worth of other blocks has been loaded: repeated pins within that period (e.g.
+//! the pins of the threads of a single scan) do not say anything about the block being used again later on.
+struct EvictionQueue {
+	//! The maximum fraction of the memory limit used by protected blocks before they are evicted first
+	constexpr static double PROTECTED_MEMORY_RATIO = 0.75;
+
+	//! The fraction of the memory limit that is loaded before the correlated reference period of a block ends
+	constexpr static double CORRELATED_REFERENCE_RATIO = 0.25;
+
+	EvictionQueue() : protected_memory(0), load_sequence(0) {
+	}
+
+	//! Blocks that have been loaded once
+	eviction_queue_t probation;
+	//! Blocks that have been loaded repeatedly
+	eviction_queue_t protected_queue;
+	//! The memory used by loaded protected blocks
+	std::atomic<idx_t> protected_memory;
+	//! The amount of blocks that have been loaded
+	std::atomic<idx_t> load_sequence;
+
+	//! The ids of the blocks that were recently evicted from the probationary queue
+	mutex ghost_lock;
+	std::deque<block_id_t> ghost_queue;
+	unordered_set<block_id_t> ghosts;
+
+	//! Called when a block is read into memory
+	void BlockLoaded(BlockHandle &handle, BufferEvictionPolicy policy) {
+		D_ASSERT(!handle.eviction_protected);
+		handle.load_sequence = ++load_sequence;
+		if (policy != BufferEvictionPolicy::TWO_QUEUE) {
+			return;
+		}
+		lock_guard<mutex> guard(ghost_lock);
+		if (ghosts.find(handle.block_id) == ghosts.end()) {
+			return;
+		}
+		// the block was evicted recently: protect it (its stale entry in the ghost queue is skipped later on)
+		ghosts.erase(handle.block_id);
+		handle.eviction_protected = true;
+		protected_memory += handle.memory_usage;
+	}
+	//! Called when a loaded block that is not pinned by anyone is pinned again
+	void BlockReferenced(BlockHandle &handle, BufferEvictionPolicy policy, idx_t memory_limit) {
+		if (policy != BufferEvictionPolicy::TWO_QUEUE || handle.eviction_protected) {
+			return;
+		}
+		idx_t correlated_period = memory_limit * CORRELATED_REFERENCE_RATIO / Storage::BLOCK_ALLOC_SIZE;
+		if (load_sequence - handle.load_sequence < MaxValue<idx_t>(correlated_period, 1)) {
+			// the block is still within its correlated reference period
+			return;
+		}
+		handle.eviction_protected = true;
+		protected_memory += handle.memory_usage;
+	}
+	//! Called when a block is removed from memory
+	void BlockUnloaded(BlockHandle &handle) {
+		if (handle.eviction_protected) {
+			protected_memory -= handle.memory_usage;
+			handle.eviction_protected = false;
+		}
+	}
+	//! Called when a block is evicted from the probationary queue
+	void AddGhost(block_id_t block_id, idx_t memory_limit) {
+		// remember as many blocks as fit in half of the memory
+		idx_t max_ghosts = memory_limit / Storage::BLOCK_ALLOC_SIZE / 2;
+		lock_guard<mutex> guard(ghost_lock);
+		if (!ghosts.insert(block_id).second) {
+			return;
+		}
+		ghost_queue.push_back(block_id);
+		while (ghost_queue.size() > max_ghosts) {
+			ghosts.erase(ghost_queue.front());
+			ghost_queue.pop_front();
+		}
+	}
+
+	void Enqueue(shared_ptr<BlockHandle> &handle, BufferEvictionPolicy policy) {
+		auto node = make_unique<BufferEvictionNode>(weak_ptr<BlockHandle>(handle), handle->eviction_timestamp);
+		if (policy == BufferEvictionPolicy::TWO_QUEUE && handle->eviction_protected) {
+			protected_queue.enqueue(move(node));
+		} else {
+			probation.enqueue(move(node));
+		}
+	}
+
+	//! Get the next candidate for eviction
+	bool TryDequeue(unique_ptr<BufferEvictionNode> &node, idx_t memory_limit) {
+		if (protected_memory > memory_limit * PROTECTED_MEMORY_RATIO) {
+			// the protected blocks take up too much memory
+			return protected_queue.try_dequeue(node) || probation.try_dequeue(node);
+		}
+		return probation.try_dequeue(node) || protected_queue.try_dequeue(node);
+	}
+};
+
 BlockHandle::BlockHandle(DatabaseInstance &db, block_id_t block_id_p) : db(db) {
 	block_id = block_id_p;
 	readers = 0;
@@ -15,6 +140,8 @@ BlockHandle::BlockHandle(DatabaseInstance &db, block_id_t block_id_p) : db(db) {
 	state = BlockState::BLOCK_UNLOADED;
 	can_destroy = false;
 	memory_usage = Storage::BLOCK_ALLOC_SIZE;
+	eviction_protected = false;
+	load_sequence = 0;
 }
 
 BlockHandle::BlockHandle(DatabaseInstance &db, block_id_t block_id_p, unique_ptr<FileBuffer> buffer_p,
@@ -28,6 +155,8 @@ BlockHandle::BlockHandle(DatabaseInstance &db, block_id_t block_id_p, unique_ptr
 	state = BlockState::BLOCK_LOADED;
 	can_destroy = can_destroy_p;
 	memory_usage = alloc_size;
+	eviction_protected = false;
+	load_sequence = 0;
 }
 
 BlockHandle::~BlockHandle() {
@@ -37,6 +166,7 @@ BlockHandle::~BlockHandle() {
 		// the block is still loaded in memory: erase it
 		buffer.reset();
 		buffer_manager.current_memory -= memory_usage;
+		buffer_manager.queue->BlockUnloaded(*this);
 	}
 	buffer_manager.UnregisterBlock(block_id, can_destroy);
 }
@@ -47,25 +177,24 @@ unique_ptr<BufferHandle> BlockHandle::Load(shared_ptr<BlockHandle> &handle) {
 		D_ASSERT(handle->buffer);
 		return make_unique<BufferHandle>(handle, handle->buffer.get());
 	}
-	handle->state = BlockState::BLOCK_LOADED;
-
 	auto &buffer_manager = BufferManager::GetBufferManager(handle->db);
 	auto &block_manager = BlockManager::GetBlockManager(handle->db);
 	if (handle->block_id < MAXIMUM_BLOCK) {
-		// FIXME: currently we still require a lock for reading blocks from disk
-		// this is mainly down to the block manager only having a single pointer into the file
-		// this is relatively easy to fix later on
-		lock_guard<mutex> buffer_lock(buffer_manager.manager_lock);
+		// blocks are read with positional reads, so different blocks can be loaded concurrently
+		// concurrent loads of the same block are prevented by the lock of the handle, which is held by the caller
 		auto block = make_unique<Block>(handle->block_id);
 		block_manager.Read(*block);
 		handle->buffer = move(block);
 	} else {
 		if (handle->can_destroy) {
+			handle->state = BlockState::BLOCK_LOADED;
 			return nullptr;
 		} else {
 			handle->buffer = buffer_manager.ReadTemporaryBuffer(handle->block_id);
 		}
 	}
+	// only mark the block as loaded once the read succeeded
+	handle->state = BlockState::BLOCK_LOADED;
 	return make_unique<BufferHandle>(handle, handle->buffer.get());
 }
 
@@ -85,6 +214,7 @@ void BlockHandle::Unload() {
 	}
 	buffer.reset();
 	buffer_manager.current_memory -= memory_usage;
+	buffer_manager.queue->BlockUnloaded(*this);
 }
 
 bool BlockHandle::CanUnload() {
@@ -106,41 +236,231 @@ bool BlockHandle::CanUnload() {
 	return true;
 }
 
-struct BufferEvictionNode {
-	BufferEvictionNode(weak_ptr<BlockHandle> handle_p, idx_t timestamp_p)
-	    : handle(move(handle_p)), timestamp(timestamp_p) {
-		D_ASSERT(!handle.expired());
+//===--------------------------------------------------------------------===//
+// Temporary File Management
+//===--------------------------------------------------------------------===//
+//! Hands out the indexes of the block slots in a temporary file, reusing the lowest free slot first so the file can be
+//! truncated when its last blocks are freed
+struct BlockIndexManager {
+	BlockIndexManager() : max_index(0) {
 	}
 
-	weak_ptr<BlockHandle> handle;
-	idx_t timestamp;
+	//! Obtain a new block index
+	idx_t GetNewBlockIndex() {
+		if (free_indexes.empty()) {
+			indexes_in_use.insert(max_index);
+			return max_index++;
+		}
+		auto entry = free_indexes.begin();
+		auto index = *entry;
+		free_indexes.erase(entry);
+		indexes_in_use.insert(index);
+		return index;
+	}
+	//! Free a block index, returns true if the highest index in use changed (i.e. the file can be truncated)
+	bool RemoveIndex(idx_t index) {
+		indexes_in_use.erase(index);
+		free_indexes.insert(index);
+		idx_t new_max_index = indexes_in_use.empty() ? 0 : *indexes_in_use.rbegin() + 1;
+		if (new_max_index == max_index) {
+			return false;
+		}
+		// drop the free indexes past the end of the file
+		free_indexes.erase(free_indexes.lower_bound(new_max_index), free_indexes.end());
+		max_index = new_max_index;
+		return true;
+	}
+	idx_t GetMaxIndex() {
+		return max_index;
+	}
+	bool HasFreeBlocks() {
+		return !free_indexes.empty();
+	}
 
-	bool CanUnload(BlockHandle &handle) {
-		if (timestamp != handle.eviction_timestamp) {
-			// handle was used in between
+private:
+	//! The amount of slots in the file (the highest index in use + 1)
+	idx_t max_index;
+	//! The free slots below max_index
+	set<idx_t> free_indexes;
+	//! The slots holding a block
+	set<idx_t> indexes_in_use;
+};
+
+//! A temporary file that stores offloaded blocks of size BLOCK_ALLOC_SIZE in fixed-size slots
+class TemporaryFileHandle {
+public:
+	//! The maximum amount of blocks in a single file (1GB with the default block size)
+	constexpr static idx_t MAX_ALLOWED_INDEX = 4000;
+
+	TemporaryFileHandle(DatabaseInstance &db, const string &temp_directory, idx_t file_index)
+	    : db(db), path(FileSystem::GetFileSystem(db).JoinPath(
+	                  temp_directory, "duckdb_temp_storage-" + to_string(file_index) + ".tmp")) {
+		// the file is opened for writing, which also allows reading the blocks back
+		auto &fs = FileSystem::GetFileSystem(db);
+		handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE);
+	}
+	~TemporaryFileHandle() {
+		handle.reset();
+		auto &fs = FileSystem::GetFileSystem(db);
+		if (fs.FileExists(path)) {
+			fs.RemoveFile(path);
+		}
+	}
+
+	//! Reserve a slot for a block, returns false if the file is full
+	bool TryGetBlockIndex(idx_t &block_index) {
+		if (index_manager.GetMaxIndex() >= MAX_ALLOWED_INDEX && !index_manager.HasFreeBlocks()) {
 			return false;
 		}
-		return handle.CanUnload();
+		block_index = index_manager.GetNewBlockIndex();
+		return true;
+	}
+	//! Free the slot of a block, truncating the file if it was at the end
+	void RemoveBlockIndex(idx_t block_index) {
+		if (index_manager.RemoveIndex(block_index)) {
+			handle->Truncate(GetPosition(index_manager.GetMaxIndex()));
+		}
+	}
+	bool IsEmpty() {
+		return index_manager.GetMaxIndex() == 0;
 	}
+
+	void WriteTemporaryBuffer(ManagedBuffer &buffer, idx_t block_index) {
+		D_ASSERT(buffer.size + Storage::BLOCK_HEADER_SIZE == Storage::BLOCK_ALLOC_SIZE);
+		// positional writes and reads do not need to be serialized
+		buffer.Write(*handle, GetPosition(block_index));
+	}
+	unique_ptr<FileBuffer> ReadTemporaryBuffer(block_id_t id, idx_t block_index) {
+		auto buffer = make_unique<ManagedBuffer>(db, Storage::BLOCK_ALLOC_SIZE, false, id);
+		buffer->Read(*handle, GetPosition(block_index));
+		return move(buffer);
+	}
+
+private:
+	static idx_t GetPosition(idx_t block_index) {
+		return block_index * Storage::BLOCK_ALLOC_SIZE;
+	}
+
+	DatabaseInstance &db;
+	string path;
+	unique_ptr<FileHandle> handle;
+	BlockIndexManager index_manager;
 };
 
-typedef moodycamel::ConcurrentQueue<unique_ptr<BufferEvictionNode>> eviction_queue_t;
+//! The location of an offloaded block
+struct TemporaryFileIndex {
+	idx_t file_index;
+	idx_t block_index;
+};
 
-struct EvictionQueue {
-	eviction_queue_t q;
+//! The TemporaryFileManager keeps track of the temporary files and the blocks stored in them
+class TemporaryFileManager {
+public:
+	TemporaryFileManager(DatabaseInstance &db, const string &temp_directory) : db(db), temp_directory(temp_directory) {
+	}
+
+	void WriteTemporaryBuffer(ManagedBuffer &buffer) {
+		TemporaryFileHandle *file;
+		TemporaryFileIndex index;
+		{
+			lock_guard<mutex> guard(manager_lock);
+			// find a file with a free slot, or create a new file
+			file = nullptr;
+			for (auto &entry : files) {
+				if (entry.second->TryGetBlockIndex(index.block_index)) {
+					index.file_index = entry.first;
+					file = entry.second.get();
+					break;
+				}
+			}
+			if (!file) {
+				index.file_index = GetNewFileIndex();
+				auto new_file = make_unique<TemporaryFileHandle>(db, temp_directory, index.file_index);
+				new_file->TryGetBlockIndex(index.block_index);
+				file = new_file.get();
+				files[index.file_index] = move(new_file);
+			}
+			used_blocks[buffer.id] = index;
+		}
+		// the file stays alive: the slot cannot be freed before the block has been written and read again
+		file->WriteTemporaryBuffer(buffer, index.block_index);
+	}
+
+	bool HasTemporaryBuffer(block_id_t id) {
+		lock_guard<mutex> guard(manager_lock);
+		return used_blocks.find(id) != used_blocks.end();
+	}
+
+	unique_ptr<FileBuffer> ReadTemporaryBuffer(block_id_t id) {
+		TemporaryFileHandle *file;
+		TemporaryFileIndex index;
+		{
+			lock_guard<mutex> guard(manager_lock);
+			index = GetTemporaryFileIndex(id);
+			file = files[index.file_index].get();
+		}
+		auto buffer = file->ReadTemporaryBuffer(id, index.block_index);
+		// the block is in memory again: free up its slot
+		DeleteTemporaryBuffer(id);
+		return buffer;
+	}
+
+	void DeleteTemporaryBuffer(block_id_t id) {
+		lock_guard<mutex> guard(manager_lock);
+		auto entry = used_blocks.find(id);
+		if (entry == used_blocks.end()) {
+			return;
+		}
+		auto index = entry->second;
+		used_blocks.erase(entry);
+		auto &file = files[index.file_index];
+		file->RemoveBlockIndex(index.block_index);
+		if (file->IsEmpty()) {
+			// the file holds no more blocks: remove it
+			files.erase(index.file_index);
+		}
+	}
+
+private:
+	TemporaryFileIndex GetTemporaryFileIndex(block_id_t id) {
+		auto entry = used_blocks.find(id);
+		if (entry == used_blocks.end()) {
+			throw InternalException("Temporary buffer %lld was not written to a temporary file", id);
+		}
+		return entry->second;
+	}
+	idx_t GetNewFileIndex() {
+		idx_t file_index = 0;
+		while (files.find(file_index) != files.end()) {
+			file_index++;
+		}
+		return file_index;
+	}
+
+	DatabaseInstance &db;
+	string temp_directory;
+	mutex manager_lock;
+	//! The temporary files, by file index
+	unordered_map<idx_t, unique_ptr<TemporaryFileHandle>> files;
+	//! The location of every block that is stored in a temporary file
+	unordered_map<block_id_t, TemporaryFileIndex> used_blocks;
 };
 
 BufferManager::BufferManager(DatabaseInstance &db, string tmp, idx_t maximum_memory)
     : db(db), current_memory(0), maximum_memory(maximum_memory), temp_directory(move(tmp)),
-      queue(make_unique<EvictionQueue>()), temporary_id(MAXIMUM_BLOCK) {
+      queue(make_unique<EvictionQueue>()), eviction_policy(DBConfig::GetConfig(db).eviction_policy), pin_hits(0),
+      pin_misses(0), evicted_blocks(0), temporary_id(MAXIMUM_BLOCK) {
 	auto &fs = FileSystem::GetFileSystem(db);
 	if (!temp_directory.empty()) {
 		fs.CreateDirectory(temp_directory);
+		temp_file_manager = make_unique<TemporaryFileManager>(db, temp_directory);
 	}
 }
 
 BufferManager::~BufferManager() {
 	auto &fs = FileSystem::GetFileSystem(db);
+	// close and remove the temporary files before removing the directory
+	temp_file_manager.reset();
 	if (!temp_directory.empty()) {
 		fs.RemoveDirectory(temp_directory);
 	}
@@ -189,11 +509,22 @@ unique_ptr<BufferHandle> BufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 	// lock the block
 	lock_guard<mutex> lock(handle->lock);
 	// check if the block is already loaded
+	bool is_persistent = handle->block_id < MAXIMUM_BLOCK;
 	if (handle->state == BlockState::BLOCK_LOADED) {
 		// the block is loaded, increment the reader count and return a pointer to the handle
+		if (is_persistent) {
+			pin_hits++;
+			if (handle->readers == 0) {
+				// the block was released before: it might be used repeatedly
+				queue->BlockReferenced(*handle, eviction_policy, maximum_memory);
+			}
+		}
 		handle->readers++;
 		return handle->Load(handle);
 	}
+	if (is_persistent) {
+		pin_misses++;
+	}
 	// evict blocks until we have space for the current block
 	if (!EvictBlocks(handle->memory_usage, maximum_memory)) {
 		throw OutOfRangeException("Not enough memory to complete operation: failed to pin block");
@@ -201,7 +532,19 @@ unique_ptr<BufferHandle> BufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 	// now we can actually load the current block
 	D_ASSERT(handle->readers == 0);
 	handle->readers = 1;
-	return handle->Load(handle);
+	unique_ptr<BufferHandle> result;
+	try {
+		result = handle->Load(handle);
+	} catch (...) {
+		// the block could not be read: release the memory that was reserved for it
+		handle->readers = 0;
+		current_memory -= handle->memory_usage;
+		throw;
+	}
+	if (result) {
+		queue->BlockLoaded(*handle, eviction_policy);
+	}
+	return result;
 }
 
 void BufferManager::Unpin(shared_ptr<BlockHandle> &handle) {
@@ -210,7 +553,7 @@ void BufferManager::Unpin(shared_ptr<BlockHandle> &handle) {
 	handle->readers--;
 	if (handle->readers == 0) {
 		handle->eviction_timestamp++;
-		queue->q.enqueue(make_unique<BufferEvictionNode>(weak_ptr<BlockHandle>(handle), handle->eviction_timestamp));
+		queue->Enqueue(handle, eviction_policy);
 		// FIXME: do some house-keeping to prevent the queue from being flooded with many old blocks
 	}
 }
@@ -220,7 +563,7 @@ bool BufferManager::EvictBlocks(idx_t extra_memory, idx_t memory_limit) {
 	current_memory += extra_memory;
 	while (current_memory > memory_limit) {
 		// get a block to unpin from the queue
-		if (!queue->q.try_dequeue(node)) {
+		if (!queue->TryDequeue(node, memory_limit)) {
 			current_memory -= extra_memory;
 			return false;
 		}
@@ -240,8 +583,14 @@ bool BufferManager::EvictBlocks(idx_t extra_memory, idx_t memory_limit) {
 			continue;
 		}
 		// hooray, we can unload the block
+		if (eviction_policy == BufferEvictionPolicy::TWO_QUEUE && !handle->eviction_protected &&
+		    !(handle->block_id >= MAXIMUM_BLOCK && handle->can_destroy)) {
+			// remember blocks evicted from the probationary queue, so they are protected if they are loaded again
+			queue->AddGhost(handle->block_id, memory_limit);
+		}
 		// release the memory and mark the block as unloaded
 		handle->Unload();
+		evicted_blocks++;
 	}
 	return true;
 }
@@ -280,6 +629,11 @@ void BufferManager::SetLimit(idx_t limit) {
 	}
 }
 
+void BufferManager::SetEvictionPolicy(BufferEvictionPolicy policy) {
+	// blocks that are already in one of the queues stay there, new candidates are queued according to the new policy
+	eviction_policy = policy;
+}
+
 string BufferManager::GetTemporaryPath(block_id_t id) {
 	auto &fs = FileSystem::GetFileSystem(db);
 	return fs.JoinPath(temp_directory, to_string(id) + ".block");
@@ -288,6 +642,12 @@ string BufferManager::GetTemporaryPath(block_id_t id) {
 void BufferManager::WriteTemporaryBuffer(ManagedBuffer &buffer) {
 	D_ASSERT(!temp_directory.empty());
 	D_ASSERT(buffer.size + Storage::BLOCK_HEADER_SIZE >= Storage::BLOCK_ALLOC_SIZE);
+	if (buffer.size + Storage::BLOCK_HEADER_SIZE == Storage::BLOCK_ALLOC_SIZE) {
+		// blocks of the default size are stored in the shared temporary files
+		temp_file_manager->WriteTemporaryBuffer(buffer);
+		return;
+	}
+	// larger buffers are written to a file of their own
 	// get the path to write to
 	auto path = GetTemporaryPath(buffer.id);
 	// create the file and write the size followed by the buffer contents
@@ -302,6 +662,9 @@ unique_ptr<FileBuffer> BufferManager::ReadTemporaryBuffer(block_id_t id) {
 		throw Exception("Out-of-memory: cannot read buffer because no temporary directory is specified!\nTo enable "
 		                "temporary buffer eviction set a temporary directory in the configuration");
 	}
+	if (temp_file_manager->HasTemporaryBuffer(id)) {
+		return temp_file_manager->ReadTemporaryBuffer(id);
+	}
 	idx_t alloc_size;
 	// open the temporary file and read the size
 	auto path = GetTemporaryPath(id);
@@ -312,10 +675,22 @@ unique_ptr<FileBuffer> BufferManager::ReadTemporaryBuffer(block_id_t id) {
 	// now allocate a buffer of this size and read the data into that buffer
 	auto buffer = make_unique<ManagedBuffer>(db, alloc_size + Storage::BLOCK_HEADER_SIZE, false, id);
 	buffer->Read(*handle, sizeof(idx_t));
+
+	// the buffer is in memory again: remove the file
+	handle.reset();
+	fs.RemoveFile(path);
 	return move(buffer);
 }
 
 void BufferManager::DeleteTemporaryFile(block_id_t id) {
+	if (temp_directory.empty()) {
+		// no temporary directory: the buffer was never offloaded
+		return;
+	}
+	if (temp_file_manager->HasTemporaryBuffer(id)) {
+		temp_file_manager->DeleteTemporaryBuffer(id);
+		return;
+	}
 	auto &fs = FileSystem::GetFileSystem(db);
 	auto path = GetTemporaryPath(id);
 	if (fs.FileExists(path)) {
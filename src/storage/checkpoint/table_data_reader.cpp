@@ -43,13 +43,14 @@ void TableDataReader::ReadTableData() {
 			data_pointer.tuple_count = reader.Read<idx_t>();
 			data_pointer.block_id = reader.Read<block_id_t>();
 			data_pointer.offset = reader.Read<uint32_t>();
+			data_pointer.compression = (CompressionType)reader.Read<uint8_t>();
 			data_pointer.statistics = BaseStatistics::Deserialize(reader, column.type);
 
 			column_count += data_pointer.tuple_count;
 			// create a persistent segment
 			auto segment = make_unique<PersistentSegment>(db, data_pointer.block_id, data_pointer.offset, column.type,
 			                                              data_pointer.row_start, data_pointer.tuple_count,
-			                                              move(data_pointer.statistics));
+			                                              move(data_pointer.statistics), data_pointer.compression);
 			info.data->table_data[col].push_back(move(segment));
 		}
 		if (col == 0) {
@@ -77,6 +78,20 @@ void TableDataReader::ReadTableData() {
 		}
 		info.data->versions->AppendSegment(move(segment));
 	}
+
+	// read the location of the roots of the indexes, and the blocks that store their nodes
+	auto index_count = reader.Read<idx_t>();
+	for (idx_t i = 0; i < index_count; i++) {
+		IndexPointer pointer;
+		pointer.root.block_id = reader.Read<block_id_t>();
+		pointer.root.offset = reader.Read<uint32_t>();
+		auto block_count = reader.Read<idx_t>();
+		for (idx_t block_idx = 0; block_idx < block_count; block_idx++) {
+			auto block_id = reader.Read<block_id_t>();
+			pointer.blocks[block_id] = reader.Read<idx_t>();
+		}
+		info.indexes.push_back(move(pointer));
+	}
 }
 
 } // namespace duckdb
@@ -4,8 +4,11 @@
 #include "duckdb/common/types/null_value.hpp"
 
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/common/serializer/buffered_serializer.hpp"
 
+#include "duckdb/storage/compressed_segment.hpp"
+#include "duckdb/storage/dictionary_segment.hpp"
 #include "duckdb/storage/numeric_segment.hpp"
 #include "duckdb/storage/string_segment.hpp"
 #include "duckdb/storage/table/column_segment.hpp"
@@ -13,6 +16,7 @@
 #include "duckdb/storage/table/transient_segment.hpp"
 #include "duckdb/storage/column_data.hpp"
 #include "duckdb/storage/table/morsel_info.hpp"
+#include "duckdb/storage/statistics/distinct_statistics.hpp"
 
 namespace duckdb {
 
@@ -40,16 +44,34 @@ private:
 	void AllocateNewBlock(block_id_t new_block_id);
 };
 
-TableDataWriter::TableDataWriter(DatabaseInstance &db, TableCatalogEntry &table, MetaBlockWriter &meta_writer)
-    : db(db), table(table), meta_writer(meta_writer) {
-}
+//! Packs the compressed segments of a column together into blocks
+class CompressedBlockWriter {
+public:
+	explicit CompressedBlockWriter(DatabaseInstance &db);
 
-TableDataWriter::~TableDataWriter() {
-}
+	//! The database instance
+	DatabaseInstance &db;
 
-void TableDataWriter::WriteTableData() {
-	// allocate the initial segments
+	//! Temporary buffer
+	unique_ptr<BufferHandle> handle;
+	//! The block on-disk to which we are writing
+	block_id_t block_id;
+	//! The offset within the current block
+	idx_t offset;
+
+public:
+	//! Reserve space for a compressed segment of the given size, returns a pointer to the location the segment should
+	//! be written to
+	data_ptr_t Reserve(idx_t size, block_id_t &result_block, uint32_t &result_offset);
+	//! Write the current block to disk
+	void Flush();
+};
+
+TableDataWriter::TableDataWriter(DatabaseInstance &db, TableCatalogEntry &table, MetaBlockWriter &meta_writer)
+    : db(db), table(table), meta_writer(meta_writer) {
+	// the segments and compressed block writers of a column are only allocated while the column is checkpointed
 	segments.resize(table.columns.size());
+	compressed_writers.resize(table.columns.size());
 	data_pointers.resize(table.columns.size());
 	stats.reserve(table.columns.size());
 	column_stats.reserve(table.columns.size());
@@ -57,17 +79,53 @@ void TableDataWriter::WriteTableData() {
 		auto type_id = table.columns[i].type.InternalType();
 		stats.push_back(make_unique<SegmentStatistics>(table.columns[i].type, GetTypeIdSize(type_id)));
 		column_stats.push_back(BaseStatistics::CreateEmpty(table.columns[i].type));
-		CreateSegment(i);
 	}
+}
+
+TableDataWriter::~TableDataWriter() {
+}
+
+void TableDataWriter::CheckpointColumn(idx_t col_idx) {
+	// scan the column and append the data to the uncompressed segments
+	table.storage->CheckpointColumn(*this, col_idx);
+}
 
-	// now start scanning the table and append the data to the uncompressed segments
-	table.storage->Checkpoint(*this);
+void TableDataWriter::WriteIndexData() {
+	// only the indexes of the UNIQUE and PRIMARY KEY constraints are persisted: they are created together with the
+	// table, before any index created with CREATE INDEX
+	idx_t constraint_index_count = 0;
+	for (auto &constraint : table.bound_constraints) {
+		if (constraint->type == ConstraintType::UNIQUE) {
+			constraint_index_count++;
+		}
+	}
+	auto &indexes = table.storage->info->indexes;
+	D_ASSERT(constraint_index_count <= indexes.size());
+	for (idx_t i = 0; i < constraint_index_count && i < indexes.size(); i++) {
+		D_ASSERT(indexes[i]->type == IndexType::ART);
+		auto &art = (ART &)*indexes[i];
+		index_pointers.push_back(art.Serialize(db));
+	}
+}
 
+void TableDataWriter::WriteTableData() {
 	VerifyDataPointers();
 	WriteDataPointers();
 
 	// then we checkpoint the deleted tuples
 	table.storage->CheckpointDeletes(*this);
+
+	// finally we write the location of the roots of the indexes, and the blocks that store their nodes
+	meta_writer.Write<idx_t>(index_pointers.size());
+	for (auto &pointer : index_pointers) {
+		meta_writer.Write<block_id_t>(pointer.root.block_id);
+		meta_writer.Write<uint32_t>(pointer.root.offset);
+		meta_writer.Write<idx_t>(pointer.blocks.size());
+		for (auto &entry : pointer.blocks) {
+			meta_writer.Write<block_id_t>(entry.first);
+			meta_writer.Write<idx_t>(entry.second);
+		}
+	}
 }
 
 void TableDataWriter::CreateSegment(idx_t col_idx) {
@@ -86,18 +144,23 @@ void TableDataWriter::CheckpointColumn(ColumnData &col_data, idx_t col_idx) {
 		return;
 	}
 	Vector intermediate(col_data.type);
+	CreateSegment(col_idx);
+	compressed_writers[col_idx] = make_unique<CompressedBlockWriter>(db);
 
 	// scan the segments of the column data
 	// we create a new segment tree with all the new segments
 	SegmentTree new_tree;
 
+	auto &block_manager = BlockManager::GetBlockManager(db);
 	auto owned_segment = move(col_data.data.root_node);
 	auto segment = (ColumnSegment *)owned_segment.get();
 	while (segment) {
 		if (segment->segment_type == ColumnSegmentType::PERSISTENT) {
 			auto &persistent = (PersistentSegment &)*segment;
 			// persistent segment; check if there were changes made to the segment
-			if (!persistent.HasChanges()) {
+			// compressed segments share blocks: once any segment in a block is changed the block is freed after the
+			// checkpoint, so the unchanged segments that are stored in the same block have to be written again as well
+			if (!persistent.HasChanges() && !block_manager.IsBlockModified(persistent.block_id)) {
 				// unchanged persistent segment: no need to write the data
 
 				// flush any segments preceding this persistent segment
@@ -109,7 +172,8 @@ void TableDataWriter::CheckpointColumn(ColumnData &col_data, idx_t col_idx) {
 				// set up the data pointer directly using the data from the persistent segment
 				DataPointer pointer;
 				pointer.block_id = persistent.block_id;
-				pointer.offset = 0;
+				pointer.offset = persistent.offset;
+				pointer.compression = persistent.compression;
 				pointer.row_start = segment->start;
 				pointer.tuple_count = persistent.count;
 				pointer.statistics = persistent.stats.statistics->Copy();
@@ -133,6 +197,11 @@ void TableDataWriter::CheckpointColumn(ColumnData &col_data, idx_t col_idx) {
 		segment->InitializeScan(state);
 		for (idx_t vector_index = 0; vector_index * STANDARD_VECTOR_SIZE < segment->count; vector_index++) {
 			idx_t count = MinValue<idx_t>(segment->count - vector_index * STANDARD_VECTOR_SIZE, STANDARD_VECTOR_SIZE);
+			if (intermediate.vector_type != VectorType::FLAT_VECTOR) {
+				// dictionary segments scan into a dictionary vector that refers to their shared dictionary: make sure
+				// we do not scan into the buffer of the dictionary
+				intermediate.Initialize();
+			}
 			segment->ScanCommitted(state, vector_index, intermediate);
 			AppendData(new_tree, col_idx, intermediate, count);
 		}
@@ -142,6 +211,16 @@ void TableDataWriter::CheckpointColumn(ColumnData &col_data, idx_t col_idx) {
 	}
 	// flush the final segment
 	FlushSegment(new_tree, col_idx);
+	// the distinct count sketch is kept for the column as a whole rather than per segment: carry it over into the
+	// column statistics that are written together with the data pointers
+	if (col_data.statistics && col_data.statistics->distinct_stats) {
+		column_stats[col_idx]->distinct_stats = col_data.statistics->distinct_stats->Copy();
+	}
+	// write the last block of compressed segments before the segments can be read
+	compressed_writers[col_idx]->Flush();
+	// release the buffers of the column: only the data pointers and statistics are kept until they are written
+	segments[col_idx].reset();
+	compressed_writers[col_idx].reset();
 	// replace the old tree with the new one
 	col_data.data.Replace(new_tree);
 }
@@ -205,15 +284,45 @@ void TableDataWriter::FlushSegment(SegmentTree &new_tree, idx_t col_idx) {
 
 	auto handle = buffer_manager.Pin(segments[col_idx]->block);
 
-	// get a free block id to write to
-	auto block_id = block_manager.GetFreeBlockId();
+	// check if the segment can be compressed
+	auto compression = CompressionType::UNCOMPRESSED;
+	idx_t compressed_size = 0;
+	auto type_id = table.columns[col_idx].type.InternalType();
+	if (CompressedSegment::SupportsCompression(type_id)) {
+		compression = CompressedSegment::ChooseCompression((NumericSegment &)*segments[col_idx], compressed_size);
+	} else if (type_id == PhysicalType::VARCHAR) {
+		auto &string_segment = (StringSegment &)*segments[col_idx];
+		auto &overflow_writer = (WriteOverflowStringsToDisk &)*string_segment.overflow_writer;
+		// segments with strings in overflow blocks are not dictionary compressed
+		if (overflow_writer.block_id == INVALID_BLOCK) {
+			compression = DictionarySegment::ChooseCompression(string_segment, compressed_size);
+		}
+	}
 
-	// construct the data pointer
-	uint32_t offset_in_block = 0;
+	block_id_t block_id;
+	uint32_t offset_in_block;
+	if (compression == CompressionType::UNCOMPRESSED) {
+		// get a free block id to write to
+		block_id = block_manager.GetFreeBlockId();
+		offset_in_block = 0;
+	} else {
+		// compress the segment into the block that is shared with the other compressed segments of this column
+		auto target = compressed_writers[col_idx]->Reserve(compressed_size, block_id, offset_in_block);
+		idx_t written;
+		if (compression == CompressionType::DICTIONARY) {
+			written = DictionarySegment::Compress((StringSegment &)*segments[col_idx], target);
+		} else {
+			written = CompressedSegment::Compress((NumericSegment &)*segments[col_idx], compression, target);
+		}
+		D_ASSERT(written == compressed_size);
+		(void)written;
+	}
 
+	// construct the data pointer
 	DataPointer data_pointer;
 	data_pointer.block_id = block_id;
 	data_pointer.offset = offset_in_block;
+	data_pointer.compression = compression;
 	data_pointer.row_start = 0;
 	if (!data_pointers[col_idx].empty()) {
 		auto &last_pointer = data_pointers[col_idx].back();
@@ -225,12 +334,14 @@ void TableDataWriter::FlushSegment(SegmentTree &new_tree, idx_t col_idx) {
 	// construct a persistent segment that points to this block, and append it to the new segment tree
 	auto persistent_segment = make_unique<PersistentSegment>(db, block_id, offset_in_block, table.columns[col_idx].type,
 	                                                         data_pointer.row_start, data_pointer.tuple_count,
-	                                                         stats[col_idx]->statistics->Copy());
+	                                                         stats[col_idx]->statistics->Copy(), compression);
 	new_tree.AppendSegment(move(persistent_segment));
 
 	data_pointers[col_idx].push_back(move(data_pointer));
-	// write the block to disk
-	block_manager.Write(*handle->node, block_id);
+	if (compression == CompressionType::UNCOMPRESSED) {
+		// write the block to disk
+		block_manager.Write(*handle->node, block_id);
+	}
 
 	column_stats[col_idx]->Merge(*stats[col_idx]->statistics);
 	stats[col_idx] = make_unique<SegmentStatistics>(table.columns[col_idx].type,
@@ -279,6 +390,7 @@ void TableDataWriter::WriteDataPointers() {
 			meta_writer.Write<idx_t>(data_pointer.tuple_count);
 			meta_writer.Write<block_id_t>(data_pointer.block_id);
 			meta_writer.Write<uint32_t>(data_pointer.offset);
+			meta_writer.Write<uint8_t>((uint8_t)data_pointer.compression);
 			data_pointer.statistics->Serialize(meta_writer);
 		}
 	}
@@ -345,4 +457,38 @@ void WriteOverflowStringsToDisk::AllocateNewBlock(block_id_t new_block_id) {
 	block_id = new_block_id;
 }
 
+CompressedBlockWriter::CompressedBlockWriter(DatabaseInstance &db) : db(db), block_id(INVALID_BLOCK), offset(0) {
+}
+
+data_ptr_t CompressedBlockWriter::Reserve(idx_t size, block_id_t &result_block, uint32_t &result_offset) {
+	D_ASSERT(size <= Storage::BLOCK_SIZE);
+	// keep the segments 8-byte aligned
+	offset = (offset + 7) / 8 * 8;
+	if (block_id == INVALID_BLOCK || offset + size > Storage::BLOCK_SIZE) {
+		// the segment does not fit in the current block: write it and start a new one
+		Flush();
+		if (!handle) {
+			auto &buffer_manager = BufferManager::GetBufferManager(db);
+			handle = buffer_manager.Allocate(Storage::BLOCK_ALLOC_SIZE);
+		}
+		memset(handle->node->buffer, 0, Storage::BLOCK_SIZE);
+		block_id = BlockManager::GetBlockManager(db).GetFreeBlockId();
+		offset = 0;
+	}
+	result_block = block_id;
+	result_offset = offset;
+	offset += size;
+	return handle->node->buffer + result_offset;
+}
+
+void CompressedBlockWriter::Flush() {
+	if (block_id == INVALID_BLOCK) {
+		return;
+	}
+	auto &block_manager = BlockManager::GetBlockManager(db);
+	block_manager.Write(*handle->node, block_id);
+	block_id = INVALID_BLOCK;
+	offset = 0;
+}
+
 } // namespace duckdb
@@ -24,6 +24,8 @@
 #include "duckdb/main/connection.hpp"
 #include "duckdb/main/database.hpp"
 
+#include "duckdb/parallel/task_executor.hpp"
+
 #include "duckdb/transaction/transaction_manager.hpp"
 
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
@@ -35,6 +37,9 @@ namespace duckdb {
 CheckpointManager::CheckpointManager(DatabaseInstance &db) : db(db) {
 }
 
+CheckpointManager::~CheckpointManager() {
+}
+
 void CheckpointManager::CreateCheckpoint() {
 	auto &config = DBConfig::GetConfig(db);
 	auto &storage_manager = StorageManager::GetStorageManager(db);
@@ -58,7 +63,9 @@ void CheckpointManager::CreateCheckpoint() {
 	// we scan the set of committed schemas
 	auto &catalog = Catalog::GetCatalog(db);
 	catalog.schemas->Scan([&](CatalogEntry *entry) { schemas.push_back((SchemaCatalogEntry *)entry); });
-	// write the actual data into the database
+	// first write the data of all tables to disk
+	WriteTableData(schemas);
+	// now write the meta data into the database
 	// write the amount of schemas
 	metadata_writer->Write<uint32_t>(schemas.size());
 	for (auto &schema : schemas) {
@@ -121,6 +128,30 @@ void CheckpointManager::LoadFromStorage() {
 	con.Commit();
 }
 
+//===--------------------------------------------------------------------===//
+// Table Data
+//===--------------------------------------------------------------------===//
+void CheckpointManager::WriteTableData(vector<SchemaCatalogEntry *> &schemas) {
+	// the columns of all tables are written in parallel: only the meta data is written sequentially afterwards
+	TaskExecutor executor(db.GetScheduler());
+	for (auto &schema : schemas) {
+		schema->Scan(CatalogType::TABLE_ENTRY, [&](CatalogEntry *entry) {
+			if (entry->type != CatalogType::TABLE_ENTRY) {
+				return;
+			}
+			auto table = (TableCatalogEntry *)entry;
+			auto writer = make_unique<TableDataWriter>(db, *table, *tabledata_writer);
+			auto &table_writer = *writer;
+			table_writers[table] = move(writer);
+			for (idx_t col_idx = 0; col_idx < table->columns.size(); col_idx++) {
+				executor.ScheduleTask([&table_writer, col_idx]() { table_writer.CheckpointColumn(col_idx); });
+			}
+		});
+	}
+	// execute the tasks from this thread as well and wait for the tasks picked up by other threads to finish
+	executor.WorkOnTasks();
+}
+
 //===--------------------------------------------------------------------===//
 // Schema
 //===--------------------------------------------------------------------===//
@@ -249,14 +280,18 @@ void CheckpointManager::ReadMacro(ClientContext &context, MetaBlockReader &reade
 // Table Metadata
 //===--------------------------------------------------------------------===//
 void CheckpointManager::WriteTable(TableCatalogEntry &table) {
+	auto entry = table_writers.find(&table);
+	D_ASSERT(entry != table_writers.end());
+	auto &writer = *entry->second;
+	// write the changed nodes of the indexes first, the table info refers to the location of their roots
+	writer.WriteIndexData();
 	// write the table meta data
 	table.Serialize(*metadata_writer);
 	//! write the blockId for the table info
 	metadata_writer->Write<block_id_t>(tabledata_writer->block->id);
 	//! and the offset to where the info starts
 	metadata_writer->Write<uint64_t>(tabledata_writer->offset);
-	// now we need to write the table data
-	TableDataWriter writer(db, table, *tabledata_writer);
+	// now we need to write the data pointers of the table, the data itself has already been written
 	writer.WriteTableData();
 }
 
@@ -5,12 +5,16 @@
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
+#include "duckdb/storage/statistics/distinct_statistics.hpp"
 
 namespace duckdb {
 
 ColumnData::ColumnData(DatabaseInstance &db, DataTableInfo &table_info, LogicalType type, idx_t column_idx)
     : table_info(table_info), type(move(type)), db(db), column_idx(column_idx), persistent_rows(0) {
 	statistics = BaseStatistics::CreateEmpty(type);
+	if (statistics) {
+		statistics->distinct_stats = make_unique<DistinctStatistics>();
+	}
 }
 
 void ColumnData::Initialize(vector<unique_ptr<PersistentSegment>> &segments) {
@@ -126,6 +130,13 @@ void ColumnData::InitializeAppend(ColumnAppendState &state) {
 }
 
 void ColumnData::Append(ColumnAppendState &state, Vector &vector, idx_t count) {
+	if (statistics && statistics->distinct_stats) {
+		// the values are added to a sketch of the append, so the sketch of the column is only locked once per append
+		if (!state.distinct_stats) {
+			state.distinct_stats = make_unique<DistinctStatistics>();
+		}
+		state.distinct_stats->Update(vector, count);
+	}
 	idx_t offset = 0;
 	while (true) {
 		// append the data from the vector
@@ -148,6 +159,13 @@ void ColumnData::Append(ColumnAppendState &state, Vector &vector, idx_t count) {
 	}
 }
 
+void ColumnData::FinalizeAppend(ColumnAppendState &state) {
+	if (state.distinct_stats) {
+		statistics->distinct_stats->Merge(*state.distinct_stats);
+		state.distinct_stats.reset();
+	}
+}
+
 void ColumnData::RevertAppend(row_t start_row) {
 	lock_guard<mutex> tree_lock(data.node_lock);
 	// check if this row is in the segment tree at all
@@ -177,6 +195,10 @@ void ColumnData::Update(Transaction &transaction, Vector &updates, Vector &row_i
 	// now perform the update within the segment
 	segment->Update(*this, transaction, updates, FlatVector::GetData<row_t>(row_ids), count);
 	statistics->Merge(*segment->stats.statistics);
+	if (statistics->distinct_stats) {
+		// the sketch cannot forget the old values: the distinct count can only overestimate after updates
+		statistics->distinct_stats->Update(updates, count);
+	}
 }
 
 void ColumnData::Fetch(ColumnScanState &state, row_t row_id, Vector &result) {
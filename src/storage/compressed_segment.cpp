@@ -0,0 +1,657 @@
+#include "duckdb/storage/compressed_segment.hpp"
+#include "duckdb/storage/block_manager.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/planner/table_filter.hpp"
+
+#include <algorithm>
+#include <type_traits>
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Layout
+//===--------------------------------------------------------------------===//
+// A compressed segment starts with a header that holds the compression scheme, the bit width and the reference value
+// (BITPACKING and FOR only), followed by the offsets of the vectors relative to the start of the segment.
+// Every vector starts with a flags byte, followed by the nullmask of the vector if it has any NULL values.
+// - RLE vectors then store the amount of runs followed by a (value, uint16_t length) pair for every run
+// - BITPACKING and FOR vectors store (value - reference) for every row using bit_width bits, packed in 64-bit words
+// The values of NULL rows are undefined, they are stored as whatever compresses best.
+static constexpr idx_t COMPRESSED_HEADER_SIZE = 16;
+static constexpr uint8_t COMPRESSED_VECTOR_HAS_NULLS = 1;
+
+template <class T>
+static inline uint64_t CompressedToUnsigned(T value) {
+	return std::is_signed<T>::value ? uint64_t(int64_t(value)) : uint64_t(value);
+}
+
+template <class T>
+static inline T CompressedFromUnsigned(uint64_t value) {
+	return T(value);
+}
+
+static uint8_t CompressedBitWidth(uint64_t value) {
+	uint8_t width = 0;
+	while (value > 0) {
+		width++;
+		value >>= 1;
+	}
+	return width;
+}
+
+static idx_t CompressedVectorHeaderSize(nullmask_t &nullmask) {
+	return sizeof(uint8_t) + (nullmask.any() ? sizeof(nullmask_t) : 0);
+}
+
+static idx_t BitPackedSize(idx_t count, uint8_t width) {
+	return (count * width + 63) / 64 * sizeof(uint64_t);
+}
+
+//! Returns the amount of vectors of the segment
+static idx_t CompressedVectorCount(UncompressedSegment &segment) {
+	return (segment.tuple_count + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
+}
+
+//===--------------------------------------------------------------------===//
+// RLE
+//===--------------------------------------------------------------------===//
+//! Compute the runs of a vector and (if WRITE is set) write them to the target. Returns the amount of runs.
+template <class T, bool WRITE>
+static idx_t RLECompressVector(T *values, nullmask_t &nullmask, idx_t count, data_ptr_t target) {
+	auto entry = target + sizeof(uint16_t);
+	idx_t run_count = 0;
+	T run_value = T();
+	uint16_t run_length = 0;
+	for (idx_t i = 0; i < count; i++) {
+		// NULL values continue the current run
+		auto value = nullmask[i] ? run_value : values[i];
+		if (run_length == 0) {
+			run_value = value;
+			run_length = 1;
+		} else if (value == run_value) {
+			run_length++;
+		} else {
+			if (WRITE) {
+				Store<T>(run_value, entry);
+				Store<uint16_t>(run_length, entry + sizeof(T));
+				entry += sizeof(T) + sizeof(uint16_t);
+			}
+			run_count++;
+			run_value = value;
+			run_length = 1;
+		}
+	}
+	if (run_length > 0) {
+		if (WRITE) {
+			Store<T>(run_value, entry);
+			Store<uint16_t>(run_length, entry + sizeof(T));
+		}
+		run_count++;
+	}
+	if (WRITE) {
+		Store<uint16_t>(run_count, target);
+	}
+	return run_count;
+}
+
+static idx_t RLESize(idx_t run_count, idx_t type_size) {
+	return sizeof(uint16_t) + run_count * (type_size + sizeof(uint16_t));
+}
+
+template <class T>
+static void RLEDecompressVector(data_ptr_t source, idx_t count, T *result) {
+	auto run_count = Load<uint16_t>(source);
+	auto entry = source + sizeof(uint16_t);
+	idx_t result_idx = 0;
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		auto value = Load<T>(entry);
+		auto run_length = Load<uint16_t>(entry + sizeof(T));
+		for (idx_t i = 0; i < run_length; i++) {
+			result[result_idx++] = value;
+		}
+		entry += sizeof(T) + sizeof(uint16_t);
+	}
+	D_ASSERT(result_idx == count);
+}
+
+//===--------------------------------------------------------------------===//
+// Bit-packing and frame-of-reference
+//===--------------------------------------------------------------------===//
+template <class T>
+static void BitPackVector(T *values, nullmask_t &nullmask, idx_t count, uint64_t reference, uint8_t width,
+                          data_ptr_t target) {
+	if (width == 0) {
+		// all values are equal to the reference: nothing to store
+		return;
+	}
+	uint64_t word = 0;
+	idx_t bit_offset = 0;
+	for (idx_t i = 0; i < count; i++) {
+		uint64_t delta = nullmask[i] ? 0 : CompressedToUnsigned<T>(values[i]) - reference;
+		D_ASSERT(width == 64 || delta < (uint64_t(1) << width));
+		word |= delta << bit_offset;
+		bit_offset += width;
+		if (bit_offset >= 64) {
+			// the word is full: write it and keep the remaining bits of the delta
+			Store<uint64_t>(word, target);
+			target += sizeof(uint64_t);
+			bit_offset -= 64;
+			word = bit_offset > 0 ? delta >> (width - bit_offset) : 0;
+		}
+	}
+	if (bit_offset > 0) {
+		Store<uint64_t>(word, target);
+	}
+}
+
+template <class T>
+static void BitUnpackVector(data_ptr_t source, idx_t count, uint64_t reference, uint8_t width, T *result) {
+	if (width == 0) {
+		for (idx_t i = 0; i < count; i++) {
+			result[i] = CompressedFromUnsigned<T>(reference);
+		}
+		return;
+	}
+	uint64_t mask = width == 64 ? ~uint64_t(0) : (uint64_t(1) << width) - 1;
+	idx_t bit_offset = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto word_ptr = source + (bit_offset / 64) * sizeof(uint64_t);
+		auto shift = bit_offset % 64;
+		uint64_t delta = Load<uint64_t>(word_ptr) >> shift;
+		if (shift + width > 64) {
+			// the value spans two words
+			delta |= Load<uint64_t>(word_ptr + sizeof(uint64_t)) << (64 - shift);
+		}
+		result[i] = CompressedFromUnsigned<T>(reference + (delta & mask));
+		bit_offset += width;
+	}
+}
+
+//! Derive the parameters of bit-packing from the minimum and maximum of the segment: values are stored as the
+//! difference with the reference using the given bit width. If the minimum is not negative and subtracting it does
+//! not reduce the bit width, the values are packed as-is (BITPACKING), otherwise the minimum is used as the reference
+//! (FOR).
+template <class T>
+static CompressionType GetBitPackingParameters(NumericSegment &segment, data_ptr_t segment_data, uint64_t &reference,
+                                               uint8_t &width) {
+	// compute the minimum and maximum of the non-NULL values
+	bool has_values = false;
+	T min = T(), max = T();
+	auto vector_count = CompressedVectorCount(segment);
+	for (idx_t vector_idx = 0; vector_idx < vector_count; vector_idx++) {
+		auto vector_ptr = segment_data + vector_idx * segment.vector_size;
+		auto &nullmask = *((nullmask_t *)vector_ptr);
+		auto values = (T *)(vector_ptr + sizeof(nullmask_t));
+		auto count = segment.GetVectorCount(vector_idx);
+		for (idx_t i = 0; i < count; i++) {
+			if (nullmask[i]) {
+				continue;
+			}
+			if (!has_values) {
+				min = max = values[i];
+				has_values = true;
+			} else if (values[i] < min) {
+				min = values[i];
+			} else if (values[i] > max) {
+				max = values[i];
+			}
+		}
+	}
+	if (!has_values) {
+		// the segment only holds NULL values
+		reference = 0;
+		width = 0;
+		return CompressionType::BITPACKING;
+	}
+	auto range_width = CompressedBitWidth(CompressedToUnsigned<T>(max) - CompressedToUnsigned<T>(min));
+	bool min_is_negative = std::is_signed<T>::value && int64_t(min) < 0;
+	if (!min_is_negative && CompressedBitWidth(CompressedToUnsigned<T>(max)) == range_width) {
+		reference = 0;
+		width = range_width;
+		return CompressionType::BITPACKING;
+	}
+	reference = CompressedToUnsigned<T>(min);
+	width = range_width;
+	return CompressionType::FOR;
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+template <class T>
+static CompressionType ChooseCompressionTemplated(NumericSegment &segment, idx_t &compressed_size) {
+	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+	auto handle = buffer_manager.Pin(segment.block);
+
+	uint64_t reference;
+	uint8_t width;
+	auto bitpacking_type = GetBitPackingParameters<T>(segment, handle->node->buffer, reference, width);
+
+	auto vector_count = CompressedVectorCount(segment);
+	idx_t header_size = COMPRESSED_HEADER_SIZE + vector_count * sizeof(uint32_t);
+	idx_t rle_size = header_size;
+	idx_t bitpacked_size = header_size;
+	for (idx_t vector_idx = 0; vector_idx < vector_count; vector_idx++) {
+		auto vector_ptr = handle->node->buffer + vector_idx * segment.vector_size;
+		auto &nullmask = *((nullmask_t *)vector_ptr);
+		auto values = (T *)(vector_ptr + sizeof(nullmask_t));
+		auto count = segment.GetVectorCount(vector_idx);
+
+		auto vector_header_size = CompressedVectorHeaderSize(nullmask);
+		auto run_count = RLECompressVector<T, false>(values, nullmask, count, nullptr);
+		rle_size += vector_header_size + RLESize(run_count, sizeof(T));
+		bitpacked_size += vector_header_size + BitPackedSize(count, width);
+	}
+	auto compression = rle_size <= bitpacked_size ? CompressionType::RLE : bitpacking_type;
+	compressed_size = MinValue<idx_t>(rle_size, bitpacked_size);
+	if (compressed_size >= vector_count * segment.vector_size) {
+		// compression does not reduce the size of the segment
+		return CompressionType::UNCOMPRESSED;
+	}
+	return compression;
+}
+
+template <class T>
+static idx_t CompressTemplated(NumericSegment &segment, CompressionType compression, data_ptr_t target) {
+	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+	auto handle = buffer_manager.Pin(segment.block);
+
+	uint64_t reference = 0;
+	uint8_t width = 0;
+	if (compression != CompressionType::RLE) {
+		auto bitpacking_type = GetBitPackingParameters<T>(segment, handle->node->buffer, reference, width);
+		D_ASSERT(bitpacking_type == compression);
+		(void)bitpacking_type;
+	}
+	// write the header
+	memset(target, 0, COMPRESSED_HEADER_SIZE);
+	target[0] = (uint8_t)compression;
+	target[1] = width;
+	Store<uint64_t>(reference, target + 8);
+
+	auto vector_count = CompressedVectorCount(segment);
+	idx_t offset = COMPRESSED_HEADER_SIZE + vector_count * sizeof(uint32_t);
+	for (idx_t vector_idx = 0; vector_idx < vector_count; vector_idx++) {
+		auto vector_ptr = handle->node->buffer + vector_idx * segment.vector_size;
+		auto &nullmask = *((nullmask_t *)vector_ptr);
+		auto values = (T *)(vector_ptr + sizeof(nullmask_t));
+		auto count = segment.GetVectorCount(vector_idx);
+
+		Store<uint32_t>(offset, target + COMPRESSED_HEADER_SIZE + vector_idx * sizeof(uint32_t));
+		// write the flags and the nullmask
+		if (nullmask.any()) {
+			target[offset] = COMPRESSED_VECTOR_HAS_NULLS;
+			memcpy(target + offset + sizeof(uint8_t), &nullmask, sizeof(nullmask_t));
+		} else {
+			target[offset] = 0;
+		}
+		offset += CompressedVectorHeaderSize(nullmask);
+		// write the values
+		if (compression == CompressionType::RLE) {
+			auto run_count = RLECompressVector<T, true>(values, nullmask, count, target + offset);
+			offset += RLESize(run_count, sizeof(T));
+		} else {
+			BitPackVector<T>(values, nullmask, count, reference, width, target + offset);
+			offset += BitPackedSize(count, width);
+		}
+	}
+	return offset;
+}
+
+bool CompressedSegment::SupportsCompression(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+		return true;
+	default:
+		return false;
+	}
+}
+
+CompressionType CompressedSegment::ChooseCompression(NumericSegment &segment, idx_t &compressed_size) {
+	switch (segment.type) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+		return ChooseCompressionTemplated<int8_t>(segment, compressed_size);
+	case PhysicalType::INT16:
+		return ChooseCompressionTemplated<int16_t>(segment, compressed_size);
+	case PhysicalType::INT32:
+		return ChooseCompressionTemplated<int32_t>(segment, compressed_size);
+	case PhysicalType::INT64:
+		return ChooseCompressionTemplated<int64_t>(segment, compressed_size);
+	case PhysicalType::UINT8:
+		return ChooseCompressionTemplated<uint8_t>(segment, compressed_size);
+	case PhysicalType::UINT16:
+		return ChooseCompressionTemplated<uint16_t>(segment, compressed_size);
+	case PhysicalType::UINT32:
+		return ChooseCompressionTemplated<uint32_t>(segment, compressed_size);
+	case PhysicalType::UINT64:
+		return ChooseCompressionTemplated<uint64_t>(segment, compressed_size);
+	default:
+		return CompressionType::UNCOMPRESSED;
+	}
+}
+
+idx_t CompressedSegment::Compress(NumericSegment &segment, CompressionType compression, data_ptr_t target) {
+	switch (segment.type) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+		return CompressTemplated<int8_t>(segment, compression, target);
+	case PhysicalType::INT16:
+		return CompressTemplated<int16_t>(segment, compression, target);
+	case PhysicalType::INT32:
+		return CompressTemplated<int32_t>(segment, compression, target);
+	case PhysicalType::INT64:
+		return CompressTemplated<int64_t>(segment, compression, target);
+	case PhysicalType::UINT8:
+		return CompressTemplated<uint8_t>(segment, compression, target);
+	case PhysicalType::UINT16:
+		return CompressTemplated<uint16_t>(segment, compression, target);
+	case PhysicalType::UINT32:
+		return CompressTemplated<uint32_t>(segment, compression, target);
+	case PhysicalType::UINT64:
+		return CompressTemplated<uint64_t>(segment, compression, target);
+	default:
+		throw InternalException("Unsupported type for compressed segment");
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Decompress
+//===--------------------------------------------------------------------===//
+//! Read the flags and the nullmask of a vector, returns a pointer to the compressed values of the vector
+static data_ptr_t CompressedVectorData(data_ptr_t segment_data, idx_t vector_index, nullmask_t &result_nullmask) {
+	auto vector_offset = Load<uint32_t>(segment_data + COMPRESSED_HEADER_SIZE + vector_index * sizeof(uint32_t));
+	auto vector_data = segment_data + vector_offset;
+	if (vector_data[0] & COMPRESSED_VECTOR_HAS_NULLS) {
+		memcpy(&result_nullmask, vector_data + sizeof(uint8_t), sizeof(nullmask_t));
+		return vector_data + sizeof(uint8_t) + sizeof(nullmask_t);
+	}
+	result_nullmask.reset();
+	return vector_data + sizeof(uint8_t);
+}
+
+template <class T>
+static void RLEDecompress(data_ptr_t segment_data, idx_t vector_index, idx_t count, data_ptr_t result_data,
+                          nullmask_t &result_nullmask) {
+	auto source = CompressedVectorData(segment_data, vector_index, result_nullmask);
+	RLEDecompressVector<T>(source, count, (T *)result_data);
+}
+
+template <class T>
+static void BitPackingDecompress(data_ptr_t segment_data, idx_t vector_index, idx_t count, data_ptr_t result_data,
+                                 nullmask_t &result_nullmask) {
+	auto width = segment_data[1];
+	auto reference = Load<uint64_t>(segment_data + 8);
+	auto source = CompressedVectorData(segment_data, vector_index, result_nullmask);
+	BitUnpackVector<T>(source, count, reference, width, (T *)result_data);
+}
+
+template <class T>
+static CompressedSegment::decompress_function_t GetDecompressFunctionTemplated(CompressionType compression) {
+	switch (compression) {
+	case CompressionType::RLE:
+		return RLEDecompress<T>;
+	case CompressionType::BITPACKING:
+	case CompressionType::FOR:
+		return BitPackingDecompress<T>;
+	default:
+		throw InternalException("Unsupported compression type for compressed segment");
+	}
+}
+
+static CompressedSegment::decompress_function_t GetDecompressFunction(PhysicalType type,
+                                                                      CompressionType compression) {
+	switch (type) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+		return GetDecompressFunctionTemplated<int8_t>(compression);
+	case PhysicalType::INT16:
+		return GetDecompressFunctionTemplated<int16_t>(compression);
+	case PhysicalType::INT32:
+		return GetDecompressFunctionTemplated<int32_t>(compression);
+	case PhysicalType::INT64:
+		return GetDecompressFunctionTemplated<int64_t>(compression);
+	case PhysicalType::UINT8:
+		return GetDecompressFunctionTemplated<uint8_t>(compression);
+	case PhysicalType::UINT16:
+		return GetDecompressFunctionTemplated<uint16_t>(compression);
+	case PhysicalType::UINT32:
+		return GetDecompressFunctionTemplated<uint32_t>(compression);
+	case PhysicalType::UINT64:
+		return GetDecompressFunctionTemplated<uint64_t>(compression);
+	default:
+		throw InternalException("Unsupported type for compressed segment");
+	}
+}
+
+CompressedSegment::CompressedSegment(DatabaseInstance &db, PhysicalType type, idx_t row_start, block_id_t block_id,
+                                     idx_t offset, CompressionType compression)
+    : NumericSegment(db, type, row_start, block_id), compression(compression), offset(offset) {
+	D_ASSERT(block_id != INVALID_BLOCK);
+	this->decompress_function = GetDecompressFunction(type, compression);
+}
+
+void CompressedSegment::DecompressVector(data_ptr_t block_data, idx_t vector_index, data_ptr_t result_data,
+                                         nullmask_t &result_nullmask) {
+	decompress_function(block_data + offset, vector_index, GetVectorCount(vector_index), result_data,
+	                    result_nullmask);
+}
+
+bool CompressedSegment::FetchConstant(data_ptr_t block_data, idx_t vector_index, data_ptr_t result_data) {
+	auto segment_data = block_data + offset;
+	auto vector_offset = Load<uint32_t>(segment_data + COMPRESSED_HEADER_SIZE + vector_index * sizeof(uint32_t));
+	auto vector_data = segment_data + vector_offset;
+	if (vector_data[0] & COMPRESSED_VECTOR_HAS_NULLS) {
+		return false;
+	}
+	auto source = vector_data + sizeof(uint8_t);
+	if (compression == CompressionType::RLE) {
+		// a single run: the value is stored as-is in the first entry
+		if (Load<uint16_t>(source) != 1) {
+			return false;
+		}
+		memcpy(result_data, source + sizeof(uint16_t), type_size);
+		return true;
+	}
+	// a bit width of zero means every value is equal to the reference
+	if (segment_data[1] != 0) {
+		return false;
+	}
+	nullmask_t nullmask;
+	decompress_function(segment_data, vector_index, 1, result_data, nullmask);
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+// once the segment has been converted to a temporary block it is no longer compressed: the block that was pinned
+// determines the format of the data
+void CompressedSegment::FetchBaseData(ColumnScanState &state, idx_t vector_index, Vector &result) {
+	if (state.primary_handle->handle->BlockId() >= MAXIMUM_BLOCK) {
+		NumericSegment::FetchBaseData(state, vector_index, result);
+		return;
+	}
+	D_ASSERT(vector_index < max_vector_count);
+	D_ASSERT(vector_index * STANDARD_VECTOR_SIZE <= tuple_count);
+
+	// updates are merged into the result as a flat vector, so only emit a constant vector if there are none
+	bool has_updates = versions && versions[vector_index];
+	if (!has_updates && FetchConstant(state.primary_handle->node->buffer, vector_index, FlatVector::GetData(result))) {
+		result.vector_type = VectorType::CONSTANT_VECTOR;
+		ConstantVector::SetNull(result, false);
+		return;
+	}
+	// vectors with several runs are decompressed: no vector type can hold runs, so the operators on top of the scan
+	// (including the simple aggregate) process their values one row at a time
+	result.vector_type = VectorType::FLAT_VECTOR;
+	DecompressVector(state.primary_handle->node->buffer, vector_index, FlatVector::GetData(result),
+	                 FlatVector::Nullmask(result));
+}
+
+void CompressedSegment::FilterFetchBaseData(ColumnScanState &state, Vector &result, SelectionVector &sel,
+                                            idx_t &approved_tuple_count) {
+	if (state.primary_handle->handle->BlockId() >= MAXIMUM_BLOCK) {
+		NumericSegment::FilterFetchBaseData(state, result, sel, approved_tuple_count);
+		return;
+	}
+	FetchBaseData(state, state.vector_index, result);
+	result.Slice(sel, approved_tuple_count);
+}
+
+void CompressedSegment::Select(ColumnScanState &state, Vector &result, SelectionVector &sel,
+                               idx_t &approved_tuple_count, vector<TableFilter> &table_filter) {
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	auto handle = buffer_manager.Pin(block);
+	if (handle->handle->BlockId() >= MAXIMUM_BLOCK) {
+		NumericSegment::Select(state, result, sel, approved_tuple_count, table_filter);
+		return;
+	}
+	if (FetchConstant(handle->node->buffer, state.vector_index, FlatVector::GetData(result))) {
+		// evaluate the filters once for the constant value: either all or none of the rows pass
+		result.vector_type = VectorType::CONSTANT_VECTOR;
+		ConstantVector::SetNull(result, false);
+		SelectionVector constant_sel(1);
+		constant_sel.set_index(0, 0);
+		idx_t constant_count = 1;
+		nullmask_t constant_nullmask;
+		for (auto &filter : table_filter) {
+			FilterSelection(constant_sel, result, filter, constant_count, constant_nullmask);
+		}
+		if (constant_count == 0) {
+			approved_tuple_count = 0;
+		}
+		return;
+	}
+	if (compression == CompressionType::RLE) {
+		SelectRuns(handle->node->buffer, state.vector_index, result, sel, approved_tuple_count, table_filter);
+		return;
+	}
+	// decompress the vector and apply the filters to it
+	result.vector_type = VectorType::FLAT_VECTOR;
+	auto &nullmask = FlatVector::Nullmask(result);
+	DecompressVector(handle->node->buffer, state.vector_index, FlatVector::GetData(result), nullmask);
+	for (auto &filter : table_filter) {
+		FilterSelection(sel, result, filter, approved_tuple_count, nullmask);
+	}
+}
+
+void CompressedSegment::SelectRuns(data_ptr_t block_data, idx_t vector_index, Vector &result, SelectionVector &sel,
+                                   idx_t &approved_tuple_count, vector<TableFilter> &table_filter) {
+	D_ASSERT(compression == CompressionType::RLE);
+	// the result holds the decompressed vector, so the first row of every run holds the value of the run
+	result.vector_type = VectorType::FLAT_VECTOR;
+	auto &nullmask = FlatVector::Nullmask(result);
+	DecompressVector(block_data, vector_index, FlatVector::GetData(result), nullmask);
+
+	nullmask_t vector_nullmask;
+	auto source = CompressedVectorData(block_data + offset, vector_index, vector_nullmask);
+	auto run_count = Load<uint16_t>(source);
+	auto entry = source + sizeof(uint16_t);
+	uint16_t run_ends[STANDARD_VECTOR_SIZE];
+	SelectionVector run_sel(run_count);
+	idx_t run_start = 0;
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		run_sel.set_index(run_idx, run_start);
+		run_start += Load<uint16_t>(entry + type_size);
+		run_ends[run_idx] = run_start;
+		entry += type_size + sizeof(uint16_t);
+	}
+
+	// evaluate the filters once for every run: NULL rows are part of a run, they are removed afterwards
+	idx_t approved_run_count = run_count;
+	nullmask_t run_nullmask;
+	for (auto &filter : table_filter) {
+		FilterSelection(run_sel, result, filter, approved_run_count, run_nullmask);
+	}
+	bool run_start_matches[STANDARD_VECTOR_SIZE];
+	memset(run_start_matches, 0, sizeof(run_start_matches));
+	for (idx_t i = 0; i < approved_run_count; i++) {
+		run_start_matches[run_sel.get_index(i)] = true;
+	}
+
+	// now select the rows that belong to a matching run
+	SelectionVector new_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		auto run_idx = std::upper_bound(run_ends, run_ends + run_count, idx) - run_ends;
+		D_ASSERT(idx_t(run_idx) < run_count);
+		auto start = run_idx == 0 ? 0 : run_ends[run_idx - 1];
+		if (run_start_matches[start] && !nullmask[idx]) {
+			new_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(new_sel);
+	approved_tuple_count = result_count;
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+void CompressedSegment::FetchRow(ColumnFetchState &state, Transaction &transaction, row_t row_id, Vector &result,
+                                 idx_t result_idx) {
+	auto read_lock = lock.GetSharedLock();
+	if (block->BlockId() >= MAXIMUM_BLOCK) {
+		read_lock.reset();
+		NumericSegment::FetchRow(state, transaction, row_id, result, result_idx);
+		return;
+	}
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	auto handle = buffer_manager.Pin(block);
+
+	idx_t vector_index = row_id / STANDARD_VECTOR_SIZE;
+	idx_t id_in_vector = row_id - vector_index * STANDARD_VECTOR_SIZE;
+	D_ASSERT(vector_index < max_vector_count);
+
+	// decompress the vector that holds the row
+	auto vector_data = unique_ptr<data_t[]>(new data_t[STANDARD_VECTOR_SIZE * type_size]);
+	nullmask_t nullmask;
+	DecompressVector(handle->node->buffer, vector_index, vector_data.get(), nullmask);
+
+	FlatVector::SetNull(result, result_idx, nullmask[id_in_vector]);
+	memcpy(FlatVector::GetData(result) + result_idx * type_size, vector_data.get() + id_in_vector * type_size,
+	       type_size);
+}
+
+//===--------------------------------------------------------------------===//
+// ToTemporary
+//===--------------------------------------------------------------------===//
+void CompressedSegment::ToTemporary() {
+	auto write_lock = lock.GetExclusiveLock();
+	if (block->BlockId() >= MAXIMUM_BLOCK) {
+		// conversion has already been performed by a different thread
+		return;
+	}
+	auto &block_manager = BlockManager::GetBlockManager(db);
+	block_manager.MarkBlockAsModified(block->BlockId());
+
+	// pin the current block
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	auto current = buffer_manager.Pin(block);
+
+	// now allocate a new block and decompress the vectors into the layout of an uncompressed numeric segment
+	auto new_block = buffer_manager.RegisterMemory(Storage::BLOCK_ALLOC_SIZE, false);
+	auto handle = buffer_manager.Pin(new_block);
+	for (idx_t vector_idx = 0; vector_idx < max_vector_count; vector_idx++) {
+		auto vector_ptr = handle->node->buffer + vector_idx * vector_size;
+		auto &nullmask = *((nullmask_t *)vector_ptr);
+		if (vector_idx * STANDARD_VECTOR_SIZE < tuple_count) {
+			DecompressVector(current->node->buffer, vector_idx, vector_ptr + sizeof(nullmask_t), nullmask);
+		} else {
+			nullmask.reset();
+		}
+	}
+	this->block = move(new_block);
+}
+
+} // namespace duckdb
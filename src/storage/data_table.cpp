@@ -3,6 +3,7 @@
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/types/chunk_collection.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/main/client_context.hpp"
@@ -85,6 +86,7 @@ DataTable::DataTable(ClientContext &context, DataTable &parent, ColumnDefinition
 			}
 			columns[new_column_idx]->Append(state, result, rows_in_this_vector);
 		}
+		columns[new_column_idx]->FinalizeAppend(state);
 	}
 	// also add this column to client local storage
 	Transaction::GetTransaction(context).storage.AddColumn(&parent, this, new_column, default_value);
@@ -173,6 +175,7 @@ DataTable::DataTable(ClientContext &context, DataTable &parent, idx_t changed_id
 		executor.ExecuteExpression(scan_chunk, append_vector);
 		column_data->Append(append_state, append_vector, scan_chunk.size());
 	}
+	column_data->FinalizeAppend(append_state);
 	// also add this column to client local storage
 	transaction.storage.ChangeType(&parent, this, changed_idx, target_type, bound_columns, cast_expr);
 
@@ -620,6 +623,12 @@ void DataTable::Append(Transaction &transaction, DataChunk &chunk, TableAppendSt
 	state.current_row += chunk.size();
 }
 
+void DataTable::FinalizeAppend(TableAppendState &state) {
+	for (idx_t i = 0; i < types.size(); i++) {
+		columns[i]->FinalizeAppend(state.states[i]);
+	}
+}
+
 void DataTable::ScanTableSegment(idx_t row_start, idx_t count, const std::function<void(DataChunk &chunk)> &function) {
 	idx_t end = row_start + count;
 
@@ -1019,9 +1028,12 @@ void DataTable::AddIndex(unique_ptr<Index> index, vector<unique_ptr<Expression>>
 		throw TransactionException("Transaction conflict: cannot add an index to a table that has been altered!");
 	}
 
-	// now start incrementally building the index
-	IndexLock lock;
-	index->InitializeLock(lock);
+	// collect the entries of the index: the results of the expressions followed by the row identifiers
+	ChunkCollection entries;
+	DataChunk entry_chunk;
+	auto entry_types = index->logical_types;
+	entry_types.push_back(LOGICAL_ROW_TYPE);
+	entry_chunk.InitializeEmpty(entry_types);
 	ExpressionExecutor executor(expressions);
 	while (true) {
 		intermediate.Reset();
@@ -1035,10 +1047,19 @@ void DataTable::AddIndex(unique_ptr<Index> index, vector<unique_ptr<Expression>>
 		// resolve the expressions for this chunk
 		executor.Execute(intermediate, result);
 
-		// insert into the index
-		if (!index->Insert(lock, result, intermediate.data[intermediate.ColumnCount() - 1])) {
-			throw ConstraintException("Cant create unique index, table contains duplicate data on indexed column(s)");
+		for (idx_t i = 0; i < result.ColumnCount(); i++) {
+			entry_chunk.data[i].Reference(result.data[i]);
 		}
+		entry_chunk.data[result.ColumnCount()].Reference(intermediate.data[intermediate.ColumnCount() - 1]);
+		entry_chunk.SetCardinality(result);
+		entries.Append(entry_chunk);
+	}
+
+	// now build the index from all the entries at once
+	IndexLock lock;
+	index->InitializeLock(lock);
+	if (!index->Construct(db, lock, entries)) {
+		throw ConstraintException("Cant create unique index, table contains duplicate data on indexed column(s)");
 	}
 	info->indexes.push_back(move(index));
 }
@@ -1047,6 +1068,9 @@ unique_ptr<BaseStatistics> DataTable::GetStatistics(ClientContext &context, colu
 	if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
 		return nullptr;
 	}
+	if (!columns[column_id]->statistics) {
+		return nullptr;
+	}
 	// FIXME: potentially merge with transaction local shtuff
 	return columns[column_id]->statistics->Copy();
 }
@@ -1054,11 +1078,9 @@ unique_ptr<BaseStatistics> DataTable::GetStatistics(ClientContext &context, colu
 //===--------------------------------------------------------------------===//
 // Checkpoint
 //===--------------------------------------------------------------------===//
-void DataTable::Checkpoint(TableDataWriter &writer) {
-	// checkpoint each individual column
-	for (size_t i = 0; i < columns.size(); i++) {
-		writer.CheckpointColumn(*columns[i], i);
-	}
+void DataTable::CheckpointColumn(TableDataWriter &writer, idx_t column_idx) {
+	D_ASSERT(column_idx < columns.size());
+	writer.CheckpointColumn(*columns[column_idx], column_idx);
 }
 
 void DataTable::CheckpointDeletes(TableDataWriter &writer) {
@@ -1086,6 +1108,9 @@ void DataTable::CommitDropTable() {
 	for (size_t i = 0; i < columns.size(); i++) {
 		CommitDropColumn(i);
 	}
+	for (auto &index : info->indexes) {
+		index->CommitDrop();
+	}
 }
 
 } // namespace duckdb
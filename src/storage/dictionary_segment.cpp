@@ -0,0 +1,362 @@
+#include "duckdb/storage/dictionary_segment.hpp"
+#include "duckdb/storage/block_manager.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/statistics/segment_statistics.hpp"
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Layout
+//===--------------------------------------------------------------------===//
+// A dictionary segment starts with a header that holds the compression scheme, the width of the codes (1 or 2 bytes),
+// the amount of strings in the dictionary, the offset of the codes and the amount of rows of the segment. The header
+// is followed by the offsets of the strings (relative to the start of the segment), the string data and finally the
+// codes of the rows. The string with index i has code i + 1, code 0 is used for NULL values.
+static constexpr idx_t DICTIONARY_HEADER_SIZE = 16;
+
+struct DictionarySegmentHeader {
+	uint8_t code_width;
+	uint32_t entry_count;
+	uint32_t codes_offset;
+	uint32_t tuple_count;
+
+	static DictionarySegmentHeader Read(data_ptr_t segment_data) {
+		DictionarySegmentHeader header;
+		header.code_width = segment_data[1];
+		header.entry_count = Load<uint32_t>(segment_data + 4);
+		header.codes_offset = Load<uint32_t>(segment_data + 8);
+		header.tuple_count = Load<uint32_t>(segment_data + 12);
+		return header;
+	}
+};
+
+static inline string_t DictionaryEntry(data_ptr_t segment_data, idx_t code) {
+	D_ASSERT(code > 0);
+	auto offsets = segment_data + DICTIONARY_HEADER_SIZE;
+	auto start = Load<uint32_t>(offsets + (code - 1) * sizeof(uint32_t));
+	auto end = Load<uint32_t>(offsets + code * sizeof(uint32_t));
+	return string_t((const char *)segment_data + start, end - start);
+}
+
+static inline idx_t DictionaryCode(data_ptr_t codes, uint8_t code_width, idx_t row) {
+	return code_width == 1 ? codes[row] : Load<uint16_t>(codes + row * sizeof(uint16_t));
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+//! The dictionary of a string segment that is being compressed
+struct StringDictionary {
+	//! The distinct strings of the segment, in order of appearance
+	vector<string_t> entries;
+	//! The total size of the distinct strings
+	idx_t string_size = 0;
+	//! The codes of every row of the segment
+	vector<uint16_t> codes;
+	//! The size of the segment in the regular string segment layout (excluding the unused space)
+	idx_t uncompressed_size = 0;
+
+	uint8_t CodeWidth() {
+		return entries.size() <= NumericLimits<uint8_t>::Maximum() ? sizeof(uint8_t) : sizeof(uint16_t);
+	}
+	idx_t CodesOffset() {
+		// the codes are aligned to two bytes
+		idx_t offset = DICTIONARY_HEADER_SIZE + (entries.size() + 1) * sizeof(uint32_t) + string_size;
+		return (offset + 1) / 2 * 2;
+	}
+	idx_t CompressedSize() {
+		return CodesOffset() + codes.size() * CodeWidth();
+	}
+};
+
+//! Build the dictionary of the string segment, returns false if the segment has too many distinct strings. The strings
+//! in the dictionary point into the block of the segment, which is pinned by the scan state.
+static bool BuildStringDictionary(StringSegment &segment, ColumnScanState &state, StringDictionary &result) {
+	unordered_map<string, uint16_t> code_map;
+	result.codes.reserve(segment.tuple_count);
+
+	Vector strings(LogicalType::VARCHAR);
+	segment.InitializeScan(state);
+	for (idx_t vector_idx = 0; vector_idx * STANDARD_VECTOR_SIZE < segment.tuple_count; vector_idx++) {
+		auto count = segment.GetVectorCount(vector_idx);
+		segment.ScanCommitted(state, vector_idx, strings);
+		D_ASSERT(strings.vector_type == VectorType::FLAT_VECTOR);
+		auto string_data = FlatVector::GetData<string_t>(strings);
+		auto &nullmask = FlatVector::Nullmask(strings);
+		result.uncompressed_size += segment.vector_size;
+		for (idx_t i = 0; i < count; i++) {
+			if (nullmask[i]) {
+				result.codes.push_back(0);
+				continue;
+			}
+			auto &str = string_data[i];
+			result.uncompressed_size += sizeof(uint16_t) + str.GetSize();
+			auto entry = code_map.find(str.GetString());
+			if (entry != code_map.end()) {
+				result.codes.push_back(entry->second);
+				continue;
+			}
+			if (result.entries.size() == DictionarySegment::MAXIMUM_DICTIONARY_SIZE) {
+				// too many distinct strings
+				return false;
+			}
+			result.entries.push_back(str);
+			result.string_size += str.GetSize();
+			auto code = (uint16_t)result.entries.size();
+			code_map[str.GetString()] = code;
+			result.codes.push_back(code);
+		}
+	}
+	return true;
+}
+
+CompressionType DictionarySegment::ChooseCompression(StringSegment &segment, idx_t &compressed_size) {
+	ColumnScanState state;
+	StringDictionary dictionary;
+	if (!BuildStringDictionary(segment, state, dictionary)) {
+		return CompressionType::UNCOMPRESSED;
+	}
+	compressed_size = dictionary.CompressedSize();
+	if (compressed_size >= dictionary.uncompressed_size) {
+		// the dictionary does not reduce the size of the segment
+		return CompressionType::UNCOMPRESSED;
+	}
+	return CompressionType::DICTIONARY;
+}
+
+idx_t DictionarySegment::Compress(StringSegment &segment, data_ptr_t target) {
+	ColumnScanState state;
+	StringDictionary dictionary;
+	auto success = BuildStringDictionary(segment, state, dictionary);
+	D_ASSERT(success);
+	(void)success;
+
+	auto code_width = dictionary.CodeWidth();
+	auto codes_offset = dictionary.CodesOffset();
+	// write the header
+	memset(target, 0, DICTIONARY_HEADER_SIZE);
+	target[0] = (uint8_t)CompressionType::DICTIONARY;
+	target[1] = code_width;
+	Store<uint32_t>(dictionary.entries.size(), target + 4);
+	Store<uint32_t>(codes_offset, target + 8);
+	Store<uint32_t>(dictionary.codes.size(), target + 12);
+	// write the string offsets and the string data
+	auto offsets = target + DICTIONARY_HEADER_SIZE;
+	uint32_t string_offset = DICTIONARY_HEADER_SIZE + (dictionary.entries.size() + 1) * sizeof(uint32_t);
+	for (idx_t i = 0; i < dictionary.entries.size(); i++) {
+		auto &str = dictionary.entries[i];
+		Store<uint32_t>(string_offset, offsets + i * sizeof(uint32_t));
+		memcpy(target + string_offset, str.GetDataUnsafe(), str.GetSize());
+		string_offset += str.GetSize();
+	}
+	Store<uint32_t>(string_offset, offsets + dictionary.entries.size() * sizeof(uint32_t));
+	// write the codes
+	auto codes = target + codes_offset;
+	for (idx_t i = 0; i < dictionary.codes.size(); i++) {
+		if (code_width == sizeof(uint8_t)) {
+			codes[i] = (uint8_t)dictionary.codes[i];
+		} else {
+			Store<uint16_t>(dictionary.codes[i], codes + i * sizeof(uint16_t));
+		}
+	}
+	return dictionary.CompressedSize();
+}
+
+//===--------------------------------------------------------------------===//
+// Dictionary
+//===--------------------------------------------------------------------===//
+DictionarySegment::DictionarySegment(DatabaseInstance &db, idx_t row_start, block_id_t block_id, idx_t offset)
+    : StringSegment(db, row_start, block_id), offset(offset) {
+	D_ASSERT(block_id != INVALID_BLOCK);
+}
+
+Vector &DictionarySegment::GetDictionary(data_ptr_t segment_data, const LogicalType &type) {
+	lock_guard<mutex> guard(dictionary_lock);
+	if (!dictionary) {
+		auto header = DictionarySegmentHeader::Read(segment_data);
+		D_ASSERT(header.entry_count <= MAXIMUM_DICTIONARY_SIZE);
+		dictionary = make_unique<Vector>(type);
+		auto dictionary_data = FlatVector::GetData<string_t>(*dictionary);
+		FlatVector::SetNull(*dictionary, 0, true);
+		for (idx_t code = 1; code <= header.entry_count; code++) {
+			dictionary_data[code] = StringVector::AddStringOrBlob(*dictionary, DictionaryEntry(segment_data, code));
+		}
+	}
+	return *dictionary;
+}
+
+void DictionarySegment::FetchCodes(data_ptr_t segment_data, idx_t vector_index, SelectionVector &codes) {
+	auto header = DictionarySegmentHeader::Read(segment_data);
+	auto count = GetVectorCount(vector_index);
+	D_ASSERT(vector_index * STANDARD_VECTOR_SIZE + count <= header.tuple_count);
+	auto code_data = segment_data + header.codes_offset;
+	auto base_row = vector_index * STANDARD_VECTOR_SIZE;
+	if (header.code_width == sizeof(uint8_t)) {
+		for (idx_t i = 0; i < count; i++) {
+			codes.set_index(i, code_data[base_row + i]);
+		}
+	} else {
+		auto code_ptr = code_data + base_row * sizeof(uint16_t);
+		for (idx_t i = 0; i < count; i++) {
+			codes.set_index(i, Load<uint16_t>(code_ptr + i * sizeof(uint16_t)));
+		}
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+// once the segment has been converted to a temporary block it is a regular string segment: the block that was pinned
+// determines the format of the data
+void DictionarySegment::FetchBaseData(ColumnScanState &state, idx_t vector_index, Vector &result) {
+	if (state.primary_handle->handle->BlockId() >= MAXIMUM_BLOCK) {
+		StringSegment::FetchBaseData(state, vector_index, result);
+		return;
+	}
+	D_ASSERT(vector_index * STANDARD_VECTOR_SIZE <= tuple_count);
+	auto segment_data = state.primary_handle->node->buffer + offset;
+
+	// emit a dictionary vector over the shared dictionary of the segment
+	SelectionVector codes(STANDARD_VECTOR_SIZE);
+	FetchCodes(segment_data, vector_index, codes);
+	result.Reference(GetDictionary(segment_data, result.type));
+	result.Slice(codes, GetVectorCount(vector_index));
+}
+
+void DictionarySegment::FilterFetchBaseData(ColumnScanState &state, Vector &result, SelectionVector &sel,
+                                            idx_t &approved_tuple_count) {
+	if (state.primary_handle->handle->BlockId() >= MAXIMUM_BLOCK) {
+		StringSegment::FilterFetchBaseData(state, result, sel, approved_tuple_count);
+		return;
+	}
+	FetchBaseData(state, state.vector_index, result);
+	result.Slice(sel, approved_tuple_count);
+}
+
+void DictionarySegment::Select(ColumnScanState &state, Vector &result, SelectionVector &sel,
+                               idx_t &approved_tuple_count, vector<TableFilter> &table_filter) {
+	if (state.primary_handle->handle->BlockId() >= MAXIMUM_BLOCK) {
+		StringSegment::Select(state, result, sel, approved_tuple_count, table_filter);
+		return;
+	}
+	auto segment_data = state.primary_handle->node->buffer + offset;
+	auto header = DictionarySegmentHeader::Read(segment_data);
+	auto &dictionary_vector = GetDictionary(segment_data, result.type);
+
+	// evaluate the filters once for every string in the dictionary, skipping the NULL entry
+	SelectionVector entry_sel(STANDARD_VECTOR_SIZE);
+	for (idx_t i = 0; i < header.entry_count; i++) {
+		entry_sel.set_index(i, i + 1);
+	}
+	idx_t approved_entry_count = header.entry_count;
+	for (auto &filter : table_filter) {
+		FilterSelection(entry_sel, dictionary_vector, filter, approved_entry_count,
+		                FlatVector::Nullmask(dictionary_vector));
+	}
+	bool entry_matches[STANDARD_VECTOR_SIZE];
+	memset(entry_matches, 0, sizeof(entry_matches));
+	for (idx_t i = 0; i < approved_entry_count; i++) {
+		entry_matches[entry_sel.get_index(i)] = true;
+	}
+
+	// now select the rows whose code refers to a matching string
+	SelectionVector codes(STANDARD_VECTOR_SIZE);
+	FetchCodes(segment_data, state.vector_index, codes);
+	SelectionVector new_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		if (entry_matches[codes.get_index(idx)]) {
+			new_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(new_sel);
+	approved_tuple_count = result_count;
+
+	result.Reference(dictionary_vector);
+	result.Slice(codes, GetVectorCount(state.vector_index));
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+void DictionarySegment::FetchRow(ColumnFetchState &state, Transaction &transaction, row_t row_id, Vector &result,
+                                 idx_t result_idx) {
+	auto read_lock = lock.GetSharedLock();
+	if (block->BlockId() >= MAXIMUM_BLOCK) {
+		read_lock.reset();
+		StringSegment::FetchRow(state, transaction, row_id, result, result_idx);
+		return;
+	}
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	auto handle = buffer_manager.Pin(block);
+	auto segment_data = handle->node->buffer + offset;
+	auto header = DictionarySegmentHeader::Read(segment_data);
+	D_ASSERT((idx_t)row_id < header.tuple_count);
+
+	auto code = DictionaryCode(segment_data + header.codes_offset, header.code_width, row_id);
+	if (code == 0) {
+		FlatVector::SetNull(result, result_idx, true);
+		return;
+	}
+	FlatVector::SetNull(result, result_idx, false);
+	auto result_data = FlatVector::GetData<string_t>(result);
+	result_data[result_idx] = StringVector::AddStringOrBlob(result, DictionaryEntry(segment_data, code));
+}
+
+//===--------------------------------------------------------------------===//
+// ToTemporary
+//===--------------------------------------------------------------------===//
+void DictionarySegment::ToTemporary() {
+	auto write_lock = lock.GetExclusiveLock();
+	if (block->BlockId() >= MAXIMUM_BLOCK) {
+		// conversion has already been performed by a different thread
+		return;
+	}
+	auto &block_manager = BlockManager::GetBlockManager(db);
+	block_manager.MarkBlockAsModified(block->BlockId());
+
+	// pin the current block
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	auto current = buffer_manager.Pin(block);
+	auto segment_data = current->node->buffer + offset;
+	auto header = DictionarySegmentHeader::Read(segment_data);
+	D_ASSERT(header.tuple_count == tuple_count);
+	auto code_data = segment_data + header.codes_offset;
+
+	// now allocate a new block and append the strings to it in the layout of a regular string segment
+	block = buffer_manager.RegisterMemory(Storage::BLOCK_ALLOC_SIZE, false);
+	tuple_count = 0;
+	max_vector_count = 0;
+	{
+		auto handle = buffer_manager.Pin(block);
+		SetDictionaryOffset(*handle, sizeof(idx_t));
+		ExpandStringSegment(handle->node->buffer);
+	}
+
+	SegmentStatistics stats(LogicalType::VARCHAR, GetTypeIdSize(PhysicalType::VARCHAR));
+	Vector strings(LogicalType::VARCHAR);
+	auto string_data = FlatVector::GetData<string_t>(strings);
+	for (idx_t row_idx = 0; row_idx < header.tuple_count; row_idx += STANDARD_VECTOR_SIZE) {
+		auto count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, header.tuple_count - row_idx);
+		for (idx_t i = 0; i < count; i++) {
+			auto code = DictionaryCode(code_data, header.code_width, row_idx + i);
+			if (code == 0) {
+				FlatVector::SetNull(strings, i, true);
+			} else {
+				FlatVector::SetNull(strings, i, false);
+				string_data[i] = DictionaryEntry(segment_data, code);
+			}
+		}
+		auto appended = Append(stats, strings, 0, count);
+		D_ASSERT(appended == count);
+		(void)appended;
+	}
+	dictionary.reset();
+}
+
+} // namespace duckdb
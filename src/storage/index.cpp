@@ -1,4 +1,5 @@
 #include "duckdb/storage/index.hpp"
+#include "duckdb/common/types/chunk_collection.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/planner/expression/bound_columnref_expression.hpp"
@@ -38,6 +39,21 @@ void Index::Delete(DataChunk &entries, Vector &row_identifiers) {
 	Delete(state, entries, row_identifiers);
 }
 
+bool Index::Construct(DatabaseInstance &db, IndexLock &lock, ChunkCollection &input) {
+	DataChunk result;
+	result.InitializeEmpty(logical_types);
+	for (auto &chunk : input.Chunks()) {
+		for (idx_t i = 0; i < logical_types.size(); i++) {
+			result.data[i].Reference(chunk->data[i]);
+		}
+		result.SetCardinality(*chunk);
+		if (!Insert(lock, result, chunk->data[logical_types.size()])) {
+			return false;
+		}
+	}
+	return true;
+}
+
 void Index::ExecuteExpressions(DataChunk &input, DataChunk &result) {
 	executor.Execute(input, result);
 }
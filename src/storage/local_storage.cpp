@@ -373,6 +373,7 @@ void LocalStorage::Flush(DataTable &table, LocalTableStorage &storage) {
 		storage.Clear();
 		throw ConstraintException("PRIMARY KEY or UNIQUE constraint violated: duplicated key");
 	}
+	table.FinalizeAppend(append_state);
 	storage.Clear();
 	transaction.PushAppend(&table, append_state.row_start, append_count);
 }
@@ -5,8 +5,8 @@
 
 namespace duckdb {
 
-MetaBlockReader::MetaBlockReader(DatabaseInstance &db, block_id_t block_id)
-    : db(db), handle(nullptr), offset(0), next_block(-1) {
+MetaBlockReader::MetaBlockReader(DatabaseInstance &db, block_id_t block_id, bool free_blocks_on_read)
+    : db(db), handle(nullptr), offset(0), next_block(-1), free_blocks_on_read(free_blocks_on_read) {
 	ReadNewBlock(block_id);
 }
 
@@ -35,7 +35,9 @@ void MetaBlockReader::ReadNewBlock(block_id_t id) {
 	auto &block_manager = BlockManager::GetBlockManager(db);
 	auto &buffer_manager = BufferManager::GetBufferManager(db);
 
-	block_manager.MarkBlockAsModified(id);
+	if (free_blocks_on_read) {
+		block_manager.MarkBlockAsModified(id);
+	}
 	block = buffer_manager.RegisterBlock(id);
 	handle = buffer_manager.Pin(block);
 
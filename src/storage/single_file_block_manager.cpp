@@ -195,6 +195,7 @@ bool SingleFileBlockManager::IsRootBlock(block_id_t root) {
 }
 
 block_id_t SingleFileBlockManager::GetFreeBlockId() {
+	lock_guard<mutex> lock(block_lock);
 	block_id_t block;
 	if (!free_list.empty()) {
 		// free list is non empty
@@ -209,9 +210,15 @@ block_id_t SingleFileBlockManager::GetFreeBlockId() {
 }
 
 void SingleFileBlockManager::MarkBlockAsModified(block_id_t block_id) {
+	lock_guard<mutex> lock(block_lock);
 	modified_blocks.insert(block_id);
 }
 
+bool SingleFileBlockManager::IsBlockModified(block_id_t block_id) {
+	lock_guard<mutex> lock(block_lock);
+	return modified_blocks.find(block_id) != modified_blocks.end();
+}
+
 block_id_t SingleFileBlockManager::GetMetaBlock() {
 	return meta_block;
 }
@@ -222,7 +229,12 @@ unique_ptr<Block> SingleFileBlockManager::CreateBlock() {
 
 void SingleFileBlockManager::Read(Block &block) {
 	D_ASSERT(block.id >= 0);
-	D_ASSERT(std::find(free_list.begin(), free_list.end(), block.id) == free_list.end());
+#ifdef DEBUG
+	{
+		lock_guard<mutex> lock(block_lock);
+		D_ASSERT(free_list.find(block.id) == free_list.end());
+	}
+#endif
 	block.Read(*handle, BLOCK_START + block.id * Storage::BLOCK_ALLOC_SIZE);
 }
 
@@ -1,3 +1,4 @@
+#include "duckdb/storage/statistics/distinct_statistics.hpp"
 #include "duckdb/storage/statistics/numeric_statistics.hpp"
 #include "duckdb/storage/statistics/string_statistics.hpp"
 #include "duckdb/common/serializer.hpp"
@@ -15,12 +16,26 @@ BaseStatistics::~BaseStatistics() {
 
 unique_ptr<BaseStatistics> BaseStatistics::Copy() {
 	auto statistics = make_unique<BaseStatistics>(type);
-	statistics->has_null = has_null;
+	CopyBase(*statistics);
 	return statistics;
 }
 
+void BaseStatistics::CopyBase(BaseStatistics &target) {
+	target.has_null = has_null;
+	if (distinct_stats) {
+		target.distinct_stats = distinct_stats->Copy();
+	}
+}
+
 void BaseStatistics::Merge(const BaseStatistics &other) {
 	has_null = has_null || other.has_null;
+	if (other.distinct_stats) {
+		if (distinct_stats) {
+			distinct_stats->Merge(*other.distinct_stats);
+		} else {
+			distinct_stats = other.distinct_stats->Copy();
+		}
+	}
 }
 
 unique_ptr<BaseStatistics> BaseStatistics::CreateEmpty(LogicalType type) {
@@ -49,10 +64,12 @@ unique_ptr<BaseStatistics> BaseStatistics::CreateEmpty(LogicalType type) {
 
 void BaseStatistics::Serialize(Serializer &serializer) {
 	serializer.Write<bool>(has_null);
+	serializer.WriteOptional(distinct_stats);
 }
 
 unique_ptr<BaseStatistics> BaseStatistics::Deserialize(Deserializer &source, LogicalType type) {
 	auto has_null = source.Read<bool>();
+	auto distinct_stats = source.ReadOptional<DistinctStatistics>();
 	unique_ptr<BaseStatistics> result;
 	switch (type.InternalType()) {
 	case PhysicalType::BOOL:
@@ -79,6 +96,7 @@ unique_ptr<BaseStatistics> BaseStatistics::Deserialize(Deserializer &source, Log
 		throw InternalException("Unimplemented type for statistics deserialization");
 	}
 	result->has_null = has_null;
+	result->distinct_stats = move(distinct_stats);
 	return result;
 }
 
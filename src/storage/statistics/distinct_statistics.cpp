@@ -0,0 +1,71 @@
+#include "duckdb/storage/statistics/distinct_statistics.hpp"
+
+#include "duckdb/common/serializer.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+
+namespace duckdb {
+
+DistinctStatistics::DistinctStatistics() : log(make_unique<HyperLogLog>()) {
+}
+
+DistinctStatistics::DistinctStatistics(unique_ptr<HyperLogLog> log) : log(move(log)) {
+}
+
+void DistinctStatistics::Update(Vector &vector, idx_t count) {
+	D_ASSERT(count <= STANDARD_VECTOR_SIZE);
+	if (count == 0) {
+		return;
+	}
+	// hash the values first: the sketch then only has to deal with fixed-size elements
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(vector, hashes, count);
+
+	VectorData vdata, hdata;
+	vector.Orrify(count, vdata);
+	hashes.Orrify(count, hdata);
+	auto hash_data = (hash_t *)hdata.data;
+	if (vector.vector_type == VectorType::CONSTANT_VECTOR) {
+		// a constant vector only contributes a single value
+		count = 1;
+	}
+	// gather the hashes of the non-NULL values
+	hash_t non_null_hashes[STANDARD_VECTOR_SIZE];
+	idx_t non_null_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if ((*vdata.nullmask)[vdata.sel->get_index(i)]) {
+			continue;
+		}
+		non_null_hashes[non_null_count++] = hash_data[hdata.sel->get_index(i)];
+	}
+
+	lock_guard<mutex> guard(lock);
+	log->AddHashes(non_null_hashes, non_null_count);
+}
+
+void DistinctStatistics::Merge(DistinctStatistics &other) {
+	lock_guard<mutex> guard(lock);
+	lock_guard<mutex> other_guard(other.lock);
+	log = log->Merge(*other.log);
+}
+
+idx_t DistinctStatistics::GetCount() {
+	lock_guard<mutex> guard(lock);
+	return log->Count();
+}
+
+unique_ptr<DistinctStatistics> DistinctStatistics::Copy() {
+	lock_guard<mutex> guard(lock);
+	return make_unique<DistinctStatistics>(log->Copy());
+}
+
+void DistinctStatistics::Serialize(Serializer &serializer) {
+	lock_guard<mutex> guard(lock);
+	log->Serialize(serializer);
+}
+
+unique_ptr<DistinctStatistics> DistinctStatistics::Deserialize(Deserializer &source) {
+	return make_unique<DistinctStatistics>(HyperLogLog::Deserialize(source));
+}
+
+} // namespace duckdb
@@ -23,7 +23,7 @@ unique_ptr<BaseStatistics> StringStatistics::Copy() {
 	stats->has_unicode = has_unicode;
 	stats->max_string_length = max_string_length;
 	stats->max_string_length = max_string_length;
-	stats->has_null = has_null;
+	CopyBase(*stats);
 	return move(stats);
 }
 
@@ -97,6 +97,7 @@ void StringStatistics::Update(const string_t &value) {
 }
 
 void StringStatistics::Merge(const BaseStatistics &other_p) {
+	BaseStatistics::Merge(other_p);
 	auto &other = (const StringStatistics &)other_p;
 	if (StringValueComparison(other.min, MAX_STRING_MINMAX_SIZE, min) < 0) {
 		memcpy(min, other.min, MAX_STRING_MINMAX_SIZE);
@@ -104,7 +105,6 @@ void StringStatistics::Merge(const BaseStatistics &other_p) {
 	if (StringValueComparison(other.max, MAX_STRING_MINMAX_SIZE, max) > 0) {
 		memcpy(max, other.max, MAX_STRING_MINMAX_SIZE);
 	}
-	has_null = has_null || other.has_null;
 	has_unicode = has_unicode || other.has_unicode;
 	max_string_length = MaxValue<uint32_t>(max_string_length, other.max_string_length);
 	has_overflow_strings = has_overflow_strings || other.has_overflow_strings;
@@ -7,17 +7,27 @@
 #include "duckdb/storage/meta_block_reader.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 
+#include "duckdb/storage/compressed_segment.hpp"
+#include "duckdb/storage/dictionary_segment.hpp"
 #include "duckdb/storage/numeric_segment.hpp"
 #include "duckdb/storage/string_segment.hpp"
 
 namespace duckdb {
 
 PersistentSegment::PersistentSegment(DatabaseInstance &db, block_id_t id, idx_t offset, const LogicalType &type_p,
-                                     idx_t start, idx_t count, unique_ptr<BaseStatistics> statistics)
+                                     idx_t start, idx_t count, unique_ptr<BaseStatistics> statistics,
+                                     CompressionType compression)
     : ColumnSegment(type_p, ColumnSegmentType::PERSISTENT, start, count, move(statistics)), db(db), block_id(id),
-      offset(offset) {
-	D_ASSERT(offset == 0);
-	if (type.InternalType() == PhysicalType::VARCHAR) {
+      offset(offset), compression(compression) {
+	D_ASSERT(offset == 0 || compression != CompressionType::UNCOMPRESSED);
+	if (compression == CompressionType::DICTIONARY) {
+		// dictionary segments are stored at an offset within a block that is shared with other segments
+		data = make_unique<DictionarySegment>(db, start, id, offset);
+		data->max_vector_count = count / STANDARD_VECTOR_SIZE + (count % STANDARD_VECTOR_SIZE == 0 ? 0 : 1);
+	} else if (compression != CompressionType::UNCOMPRESSED) {
+		// compressed segments are stored at an offset within a block that is shared with other segments
+		data = make_unique<CompressedSegment>(db, type.InternalType(), start, id, offset, compression);
+	} else if (type.InternalType() == PhysicalType::VARCHAR) {
 		data = make_unique<StringSegment>(db, start, id);
 		data->max_vector_count = count / STANDARD_VECTOR_SIZE + (count % STANDARD_VECTOR_SIZE == 0 ? 0 : 1);
 	} else {
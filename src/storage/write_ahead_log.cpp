@@ -4,14 +4,19 @@
 #include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/view_catalog_entry.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/parser/parsed_data/alter_table_info.hpp"
 
+#include <chrono>
 #include <cstring>
+#include <thread>
 
 namespace duckdb {
 
-WriteAheadLog::WriteAheadLog(DatabaseInstance &database) : initialized(false), skip_writing(false), database(database) {
+WriteAheadLog::WriteAheadLog(DatabaseInstance &database)
+    : initialized(false), skip_writing(false), database(database), sync_in_progress(false), sync_waiters(0),
+      written_position(0), synced_position(0), sync_failed(false), commit_count(0), sync_count(0) {
 }
 
 void WriteAheadLog::Initialize(string &path) {
@@ -236,10 +241,63 @@ void WriteAheadLog::Flush() {
 	if (skip_writing) {
 		return;
 	}
+	SyncTo(FlushBuffer());
+}
+
+idx_t WriteAheadLog::FlushBuffer() {
+	D_ASSERT(!skip_writing);
 	// write an empty entry
 	writer->Write<WALType>(WALType::WAL_FLUSH);
-	// flushes all changes made to the WAL to disk
-	writer->Sync();
+	// write the buffered changes to the file
+	writer->Flush();
+	idx_t position = writer->GetTotalWritten();
+	written_position = position;
+	return position;
+}
+
+void WriteAheadLog::SyncCommit(idx_t position) {
+	commit_count++;
+	SyncTo(position);
+}
+
+void WriteAheadLog::SyncTo(idx_t position) {
+	std::unique_lock<mutex> lock(sync_lock);
+	while (synced_position < position) {
+		if (sync_failed) {
+			throw IOException("Could not commit: an earlier sync of the write-ahead log failed, changes can no longer "
+			                  "be made durable. Restart the database to recover from the write-ahead log.");
+		}
+		if (sync_in_progress) {
+			// another thread is syncing the WAL: wait for it to finish, it might include our entries
+			sync_waiters++;
+			sync_condition.wait(lock);
+			sync_waiters--;
+			continue;
+		}
+		// no sync in progress: we sync the WAL for all commits that have been written so far
+		sync_in_progress = true;
+		lock.unlock();
+		auto commit_delay = DBConfig::GetConfig(database).wal_commit_delay;
+		if (commit_delay > 0) {
+			// wait for other commits to write their entries, so they can be included in this sync
+			std::this_thread::sleep_for(std::chrono::microseconds(commit_delay));
+		}
+		idx_t sync_position = written_position;
+		try {
+			writer->handle->Sync();
+		} catch (...) {
+			lock.lock();
+			sync_in_progress = false;
+			sync_failed = true;
+			sync_condition.notify_all();
+			throw;
+		}
+		sync_count++;
+		lock.lock();
+		synced_position = MaxValue<idx_t>(synced_position, sync_position);
+		sync_in_progress = false;
+		sync_condition.notify_all();
+	}
 }
 
 } // namespace duckdb
@@ -119,7 +119,7 @@ string Transaction::Commit(DatabaseInstance &db, transaction_t commit_id, bool c
 			if (log->GetTotalWritten() > initial_written) {
 				D_ASSERT(!checkpoint);
 				D_ASSERT(!log->skip_writing);
-				log->Flush();
+				wal_position = log->FlushBuffer();
 			}
 			log->skip_writing = false;
 		}
@@ -62,7 +62,7 @@ Transaction *TransactionManager::StartTransaction(ClientContext &context) {
 	}
 
 	// obtain the start time and transaction ID of this transaction
-	transaction_t start_time = current_start_timestamp++;
+	transaction_t start_time = GetDurableStartTime();
 	transaction_t transaction_id = current_transaction_id++;
 	timestamp_t start_timestamp = Timestamp::GetCurrentTimestamp();
 
@@ -195,6 +195,9 @@ string TransactionManager::CommitTransaction(ClientContext &context, Transaction
 		}
 	}
 	// obtain a commit id for the transaction
+	// the timestamp right before the commit id is never used as a commit id: while this commit is not durable yet, new
+	// transactions use it as start time (see GetDurableStartTime)
+	current_start_timestamp++;
 	transaction_t commit_id = current_start_timestamp++;
 	// commit the UndoBuffer of the transaction
 	string error = transaction->Commit(db, commit_id, checkpoint);
@@ -210,19 +213,52 @@ string TransactionManager::CommitTransaction(ClientContext &context, Transaction
 		client_locks.clear();
 	}
 
+	idx_t wal_position = error.empty() ? transaction->wal_position : 0;
+	if (wal_position > 0) {
+		// the commit is only durable once the WAL has been synced: hide it from new transactions until then
+		unsynced_commits[commit_id] = wal_position;
+	}
+
 	// commit successful: remove the transaction id from the list of active transactions
 	// potentially resulting in garbage collection
 	RemoveTransaction(transaction);
 	// now perform a checkpoint if (1) we are able to checkpoint, and (2) the WAL has reached sufficient size to
 	// checkpoint
+	auto &storage_manager = StorageManager::GetStorageManager(db);
 	if (checkpoint) {
 		// checkpoint the database to disk
-		auto &storage_manager = StorageManager::GetStorageManager(db);
 		storage_manager.CreateCheckpoint(false, true);
 	}
+	if (wal_position > 0) {
+		// the transaction lock is released while syncing, so the commits of transactions that are already running can
+		// write their changes to the WAL and be synced together with this one. Only this client waits for the sync.
+		// If the sync fails, the commit is not durable and stays hidden from new transactions: the WAL refuses to sync
+		// after a failure, so no later commit can make it visible either.
+		lock.reset();
+		storage_manager.GetWriteAheadLog()->SyncCommit(wal_position);
+		FinishSync(wal_position);
+	}
 	return error;
 }
 
+transaction_t TransactionManager::GetDurableStartTime() {
+	if (unsynced_commits.empty()) {
+		return current_start_timestamp++;
+	}
+	// start right before the lowest unsynced commit: all commits before it are durable
+	return unsynced_commits.begin()->first - 1;
+}
+
+void TransactionManager::FinishSync(idx_t wal_position) {
+	lock_guard<mutex> lock(transaction_lock);
+	// the WAL is synced up to (at least) the given position: every commit written before it is durable as well
+	while (!unsynced_commits.empty() && unsynced_commits.begin()->second <= wal_position) {
+		unsynced_commits.erase(unsynced_commits.begin());
+	}
+	// the commits that were kept around for new transactions might no longer be needed
+	GarbageCollect();
+}
+
 void TransactionManager::RollbackTransaction(Transaction *transaction) {
 	// obtain the transaction lock during this function
 	lock_guard<mutex> lock(transaction_lock);
@@ -238,18 +274,12 @@ void TransactionManager::RollbackTransaction(Transaction *transaction) {
 void TransactionManager::RemoveTransaction(Transaction *transaction) noexcept {
 	// remove the transaction from the list of active transactions
 	idx_t t_index = active_transactions.size();
-	// check for the lowest and highest start time in the list of transactions
-	transaction_t lowest_start_time = TRANSACTION_ID_START;
-	transaction_t lowest_active_query = MAXIMUM_QUERY_ID;
 	for (idx_t i = 0; i < active_transactions.size(); i++) {
 		if (active_transactions[i].get() == transaction) {
 			t_index = i;
-		} else {
-			lowest_start_time = MinValue(lowest_start_time, active_transactions[i]->start_time);
-			lowest_active_query = MinValue(lowest_active_query, active_transactions[i]->active_query);
+			break;
 		}
 	}
-	transaction_t lowest_stored_query = lowest_start_time;
 	D_ASSERT(t_index != active_transactions.size());
 	auto current_transaction = move(active_transactions[t_index]);
 	if (transaction->commit_id != 0) {
@@ -264,6 +294,22 @@ void TransactionManager::RemoveTransaction(Transaction *transaction) noexcept {
 	}
 	// remove the transaction from the set of currently active transactions
 	active_transactions.erase(active_transactions.begin() + t_index);
+	GarbageCollect();
+}
+
+void TransactionManager::GarbageCollect() noexcept {
+	// check for the lowest and highest start time in the list of transactions
+	transaction_t lowest_start_time = TRANSACTION_ID_START;
+	transaction_t lowest_active_query = MAXIMUM_QUERY_ID;
+	for (auto &active : active_transactions) {
+		lowest_start_time = MinValue(lowest_start_time, active->start_time);
+		lowest_active_query = MinValue(lowest_active_query, active->active_query);
+	}
+	transaction_t lowest_stored_query = lowest_start_time;
+	if (!unsynced_commits.empty()) {
+		// transactions that start later can still use a start time before the lowest unsynced commit
+		lowest_start_time = MinValue(lowest_start_time, unsynced_commits.begin()->first - 1);
+	}
 	// traverse the recently_committed transactions to see if we can remove any
 	idx_t i = 0;
 	for (; i < recently_committed_transactions.size(); i++) {
@@ -0,0 +1,118 @@
+#include "catch.hpp"
+#include "duckdb/common/file_handle_stream.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "test_helpers.hpp"
+
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <thread>
+
+using namespace duckdb;
+using namespace std;
+
+TEST_CASE("Test reading and seeking in a file through a file handle stream", "[file_handle_stream]") {
+	string file_path = TestCreatePath("file_handle_stream.txt");
+
+	// write a file that is larger than the buffer of the stream
+	string contents;
+	for (idx_t i = 0; contents.size() <= 2 * FileHandleStreamBuf::BUFFER_SIZE; i++) {
+		contents += "line " + to_string(i) + "\n";
+	}
+	ofstream ofp(file_path, ios::out | ios::binary);
+	ofp.write(contents.c_str(), contents.size());
+	ofp.close();
+
+	FileSystem fs;
+	FileHandleStream stream(fs, file_path);
+	REQUIRE(stream.GetFileSize() == contents.size());
+
+	string line;
+	getline(stream, line);
+	REQUIRE(line == "line 0");
+	REQUIRE(stream.tellg() == 7);
+
+	// read across the end of the buffered part of the file
+	idx_t read_size = FileHandleStreamBuf::BUFFER_SIZE + 100;
+	auto buffer = unique_ptr<char[]>(new char[read_size]);
+	stream.read(buffer.get(), read_size);
+	REQUIRE(idx_t(stream.gcount()) == read_size);
+	REQUIRE(string(buffer.get(), read_size) == contents.substr(7, read_size));
+
+	// seek relative to the current position, the start and the end of the file
+	stream.seekg(-100, stream.cur);
+	REQUIRE(idx_t(stream.tellg()) == 7 + read_size - 100);
+	stream.seekg(12, stream.beg);
+	getline(stream, line);
+	REQUIRE(line == "1");
+	stream.seekg(-7, stream.end);
+	stream.read(buffer.get(), 100);
+	REQUIRE(stream.eof());
+	REQUIRE(string(buffer.get(), stream.gcount()) == contents.substr(contents.size() - 7));
+
+	// after reaching the end of the file we can seek back to the start
+	stream.clear();
+	stream.seekg(0, stream.beg);
+	string all(istreambuf_iterator<char>(stream), {});
+	REQUIRE(all == contents);
+
+	REQUIRE_THROWS(FileHandleStream(fs, "XXX_THIS_DOES_NOT_EXIST"));
+}
+
+//! A file system that counts the positional reads and keeps track of the threads they are made from
+class ReadCountingFileSystem : public FileSystem {
+public:
+	void Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override {
+		FileSystem::Read(handle, buffer, nr_bytes, location);
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			reading_threads.insert(std::this_thread::get_id());
+		}
+		bytes_read += nr_bytes;
+		read_count++;
+	}
+
+	std::atomic<idx_t> read_count {0};
+	std::atomic<idx_t> bytes_read {0};
+	std::mutex lock;
+	std::set<std::thread::id> reading_threads;
+};
+
+TEST_CASE("Test that a file handle stream reads the next block in the background", "[file_handle_stream]") {
+	string file_path = TestCreatePath("file_handle_stream_prefetch.txt");
+
+	string contents;
+	for (idx_t i = 0; contents.size() <= 3 * FileHandleStreamBuf::BUFFER_SIZE; i++) {
+		contents += "line " + to_string(i) + "\n";
+	}
+	ofstream ofp(file_path, ios::out | ios::binary);
+	ofp.write(contents.c_str(), contents.size());
+	ofp.close();
+
+	ReadCountingFileSystem fs;
+	FileHandleStream stream(fs, file_path);
+	// read the file in pieces that are smaller than a block, like the CSV reader does
+	idx_t read_size = FileHandleStreamBuf::BUFFER_SIZE / 4;
+	auto buffer = unique_ptr<char[]>(new char[read_size]);
+	stream.read(buffer.get(), read_size);
+	REQUIRE(string(buffer.get(), read_size) == contents.substr(0, read_size));
+	// while the first block is consumed, the second block is read without the stream asking for it
+	while (fs.read_count < 2) {
+		std::this_thread::yield();
+	}
+	REQUIRE(fs.bytes_read == 2 * FileHandleStreamBuf::BUFFER_SIZE);
+
+	string result(buffer.get(), read_size);
+	while (stream.read(buffer.get(), read_size) || stream.gcount() > 0) {
+		result += string(buffer.get(), stream.gcount());
+	}
+	REQUIRE(result == contents);
+	// every block is read exactly once: the blocks that are read in the background are not read again
+	REQUIRE(fs.bytes_read == contents.size());
+	auto block_size = FileHandleStreamBuf::BUFFER_SIZE;
+	REQUIRE(fs.read_count == (contents.size() + block_size - 1) / block_size);
+	// all blocks are read in the background by the same thread
+	fs.reading_threads.erase(std::this_thread::get_id());
+	REQUIRE(fs.reading_threads.size() == 1);
+}
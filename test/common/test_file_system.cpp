@@ -4,6 +4,10 @@
 #include "duckdb/common/fstream.hpp"
 #include "test_helpers.hpp"
 
+#include <atomic>
+#include <cstring>
+#include <thread>
+
 using namespace duckdb;
 using namespace std;
 
@@ -129,3 +133,90 @@ TEST_CASE("Test file buffers for reading/writing to file", "[file_system]") {
 
 	fs.RemoveFile(fname);
 }
+
+//! A file system that keeps a single file in memory, and only supports reading and writing at the file pointer
+class FilePointerFileSystem : public FileSystem {
+public:
+	struct MemoryFileHandle : public FileHandle {
+		MemoryFileHandle(FileSystem &file_system, string path) : FileHandle(file_system, move(path)), position(0) {
+		}
+
+		idx_t position;
+
+	protected:
+		void Close() override {
+		}
+	};
+
+	unique_ptr<FileHandle> OpenFile(const char *path, uint8_t flags, FileLockType lock_type) override {
+		return make_unique<MemoryFileHandle>(*this, path);
+	}
+	int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override {
+		auto &memory_handle = (MemoryFileHandle &)handle;
+		nr_bytes = MinValue<int64_t>(nr_bytes, data.size() - memory_handle.position);
+		memcpy(buffer, data.data() + memory_handle.position, nr_bytes);
+		memory_handle.position += nr_bytes;
+		return nr_bytes;
+	}
+	int64_t Write(FileHandle &handle, void *buffer, int64_t nr_bytes) override {
+		auto &memory_handle = (MemoryFileHandle &)handle;
+		if (memory_handle.position + nr_bytes > data.size()) {
+			data.resize(memory_handle.position + nr_bytes);
+		}
+		memcpy(data.data() + memory_handle.position, buffer, nr_bytes);
+		memory_handle.position += nr_bytes;
+		return nr_bytes;
+	}
+	int64_t GetFileSize(FileHandle &handle) override {
+		return data.size();
+	}
+
+	vector<char> data;
+
+protected:
+	void SetFilePointer(FileHandle &handle, idx_t location) override {
+		((MemoryFileHandle &)handle).position = location;
+	}
+};
+
+TEST_CASE("Test positional reads and writes of a file system with its own file handles", "[file_system]") {
+	FilePointerFileSystem fs;
+	auto handle = fs.OpenFile("memory_file", FileFlags::FILE_FLAGS_WRITE, FileLockType::NO_LOCK);
+
+	// write the blocks out of order, each block is filled with its index
+	const idx_t block_size = 64;
+	const idx_t block_count = 16;
+	char block[block_size];
+	for (idx_t i = 0; i < block_count; i++) {
+		idx_t block_idx = (i * 7) % block_count;
+		memset(block, 'a' + block_idx, block_size);
+		handle->Write(block, block_size, block_idx * block_size);
+	}
+	REQUIRE(fs.data.size() == block_size * block_count);
+
+	// read the blocks back from multiple threads
+	vector<std::thread> threads;
+	std::atomic<idx_t> errors(0);
+	for (idx_t t = 0; t < 4; t++) {
+		threads.push_back(std::thread([&, t]() {
+			char read_block[block_size];
+			for (idx_t i = 0; i < 100; i++) {
+				idx_t block_idx = (i + t) % block_count;
+				handle->Read(read_block, block_size, block_idx * block_size);
+				for (idx_t k = 0; k < block_size; k++) {
+					if (read_block[k] != char('a' + block_idx)) {
+						errors++;
+						break;
+					}
+				}
+			}
+		}));
+	}
+	for (auto &thread : threads) {
+		thread.join();
+	}
+	REQUIRE(errors == 0);
+
+	// reading beyond the end of the file fails
+	REQUIRE_THROWS(handle->Read(block, block_size, block_size * block_count));
+}
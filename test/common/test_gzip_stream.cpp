@@ -13,6 +13,28 @@ unsigned char test_txt_gz[] = {0x1f, 0x8b, 0x08, 0x08, 0x9a, 0x57, 0xc8, 0x5c, 0
 
 unsigned int test_txt_gz_len = 42;
 
+//! Writes a GZIP file whose payload is stored in uncompressed deflate blocks
+static void WriteStoredGzipFile(const string &path, const string &contents, const string &file_name = string()) {
+	ofstream ofp(path, ios::out | ios::binary);
+	ofp.write((const char *)test_txt_gz, 3);
+	ofp.put(file_name.empty() ? 0x00 : 0x08); // whether or not the original file name is present
+	ofp.write((const char *)test_txt_gz + 4, 6);
+	if (!file_name.empty()) {
+		ofp.write(file_name.c_str(), file_name.size() + 1);
+	}
+	for (idx_t offset = 0; offset < contents.size(); offset += 60000) {
+		uint16_t block_size = MinValue<idx_t>(60000, contents.size() - offset);
+		uint16_t block_size_complement = ~block_size;
+		ofp.put(offset + block_size == contents.size() ? 0x01 : 0x00);
+		ofp.write((const char *)&block_size, sizeof(uint16_t));
+		ofp.write((const char *)&block_size_complement, sizeof(uint16_t));
+		ofp.write(contents.c_str() + offset, block_size);
+	}
+	// crc32 and size are not verified
+	ofp.write("\0\0\0\0\0\0\0\0", 8);
+	ofp.close();
+}
+
 TEST_CASE("Test basic stream read from GZIP files", "[gzip_stream]") {
 	string gzip_file_path = TestCreatePath("test.txt.gz");
 
@@ -20,7 +42,8 @@ TEST_CASE("Test basic stream read from GZIP files", "[gzip_stream]") {
 	ofp.write((const char *)test_txt_gz, test_txt_gz_len);
 	ofp.close();
 
-	GzipStream gz(gzip_file_path);
+	FileSystem fs;
+	GzipStream gz(fs, gzip_file_path);
 	std::string s(istreambuf_iterator<char>(gz), {});
 	REQUIRE(s == "Hello, World\n");
 
@@ -28,9 +51,121 @@ TEST_CASE("Test basic stream read from GZIP files", "[gzip_stream]") {
 	ofp2.write((const char *)test_txt_gz, 5); // header too short
 	ofp2.close();
 
-	GzipStream gz2(gzip_file_path);
+	GzipStream gz2(fs, gzip_file_path);
 	REQUIRE_THROWS(s = string(std::istreambuf_iterator<char>(gz2), {}));
 
-	GzipStream gz3("XXX_THIS_DOES_NOT_EXIST");
+	GzipStream gz3(fs, "XXX_THIS_DOES_NOT_EXIST");
 	REQUIRE_THROWS(s = string(std::istreambuf_iterator<char>(gz3), {}));
 }
+
+//! A file system that, like remote file systems, can only read at an explicit offset
+class PositionalReadFileSystem : public FileSystem {
+public:
+	struct PositionalReadFileHandle : public FileHandle {
+		PositionalReadFileHandle(FileSystem &fs, string path, unique_ptr<FileHandle> local_handle)
+		    : FileHandle(fs, move(path)), local_handle(move(local_handle)) {
+		}
+		void Close() override {
+		}
+
+		unique_ptr<FileHandle> local_handle;
+	};
+
+	unique_ptr<FileHandle> OpenFile(const char *path, uint8_t flags, FileLockType lock) override {
+		return make_unique<PositionalReadFileHandle>(*this, path, local_fs.OpenFile(path, flags, lock));
+	}
+	void Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override {
+		read_count++;
+		local_fs.Read(*((PositionalReadFileHandle &)handle).local_handle, buffer, nr_bytes, location);
+	}
+	int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override {
+		throw IOException("Read3");
+	}
+	int64_t GetFileSize(FileHandle &handle) override {
+		return local_fs.GetFileSize(*((PositionalReadFileHandle &)handle).local_handle);
+	}
+
+	FileSystem local_fs;
+	idx_t read_count = 0;
+};
+
+TEST_CASE("Test reading GZIP files from a file system that only supports positional reads", "[gzip_stream]") {
+	string gzip_file_path = TestCreatePath("test_positional.txt.gz");
+
+	PositionalReadFileSystem fs;
+	{
+		ofstream ofp(gzip_file_path, ios::out | ios::binary);
+		ofp.write((const char *)test_txt_gz, test_txt_gz_len);
+		ofp.close();
+
+		GzipStream gz(fs, gzip_file_path);
+		std::string s(istreambuf_iterator<char>(gz), {});
+		REQUIRE(s == "Hello, World\n");
+		// the header and the payload are read with a single read
+		REQUIRE(fs.read_count == 1);
+	}
+
+	// write a file that spans multiple read blocks: the payload is stored in uncompressed deflate blocks
+	string contents;
+	for (idx_t i = 0; contents.size() < 200000; i++) {
+		contents += "line " + to_string(i) + "\n";
+	}
+	string file_name(100, 'x');
+	WriteStoredGzipFile(gzip_file_path, contents, file_name);
+
+	fs.read_count = 0;
+	GzipStream gz(fs, gzip_file_path);
+	std::string s(istreambuf_iterator<char>(gz), {});
+	REQUIRE(s == contents);
+	auto file_size = 10 + file_name.size() + 1 + 4 * 5 + contents.size() + 8;
+	REQUIRE(fs.read_count == (file_size + 65535) / 65536);
+}
+
+TEST_CASE("Test reading a glob of GZIP and plain CSV files in parallel", "[gzip_stream]") {
+	// write several GZIP files and several plain files of different sizes
+	idx_t gzip_count = 0;
+	idx_t gzip_sum = 0;
+	idx_t total_count = 0;
+	idx_t total_sum = 0;
+	for (idx_t part = 0; part < 8; part++) {
+		string contents = "part,j\n";
+		idx_t row_count = (part + 1) * 2000;
+		for (idx_t j = 0; j < row_count; j++) {
+			contents += to_string(part) + "," + to_string(j) + "\n";
+		}
+		total_count += row_count;
+		total_sum += row_count * (row_count - 1) / 2;
+		auto path = TestCreatePath("parallel_gzip_part" + to_string(part) + ".csv");
+		if (part % 2 == 0) {
+			WriteStoredGzipFile(path + ".gz", contents);
+			gzip_count += row_count;
+			gzip_sum += row_count * (row_count - 1) / 2;
+		} else {
+			ofstream ofp(path, ios::out | ios::binary);
+			ofp.write(contents.c_str(), contents.size());
+			ofp.close();
+		}
+	}
+
+	DuckDB db(nullptr);
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("PRAGMA threads=4"));
+	REQUIRE_NO_FAIL(con.Query("PRAGMA force_parallelism"));
+	auto glob = TestCreatePath("parallel_gzip_part*");
+	// the compressed files are spread over the threads, the plain files are split up into byte ranges
+	auto result = con.Query("SELECT COUNT(*), SUM(j) FROM read_csv_auto('" + glob + ".csv.gz')");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(gzip_count)}));
+	REQUIRE(CHECK_COLUMN(result, 1, {Value::HUGEINT(gzip_sum)}));
+	result = con.Query("SELECT COUNT(*), SUM(j) FROM read_csv_auto('" + glob + "')");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(total_count)}));
+	REQUIRE(CHECK_COLUMN(result, 1, {Value::HUGEINT(total_sum)}));
+
+	// the rows are the same, and in the same order, as when the files are read sequentially
+	for (auto &pattern : {glob + ".csv.gz", glob}) {
+		auto parallel_result = con.Query("SELECT * FROM read_csv_auto('" + pattern + "')");
+		auto sequential_result = con.Query("SELECT * FROM read_csv_auto('" + pattern + "', parallel=false)");
+		REQUIRE(parallel_result->success);
+		REQUIRE(sequential_result->success);
+		REQUIRE(parallel_result->Equals(*sequential_result));
+	}
+}
@@ -0,0 +1,52 @@
+#include "catch.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "test_helpers.hpp"
+
+#include <atomic>
+
+using namespace duckdb;
+using namespace std;
+
+TEST_CASE("Test executing tasks with the TaskExecutor", "[parallelism]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("PRAGMA threads=4"));
+	auto &scheduler = db.instance->GetScheduler();
+
+	// all work items are executed before WorkOnTasks returns
+	atomic<idx_t> sum(0);
+	{
+		TaskExecutor executor(scheduler);
+		for (idx_t i = 1; i <= 1000; i++) {
+			executor.ScheduleTask([&sum, i]() { sum += i; });
+		}
+		executor.WorkOnTasks();
+		REQUIRE(sum == 500500);
+	}
+
+	// the exception thrown by a work item is rethrown as-is
+	{
+		TaskExecutor executor(scheduler);
+		for (idx_t i = 0; i < 100; i++) {
+			executor.ScheduleTask([i]() {
+				if (i == 42) {
+					throw IOException("task failed");
+				}
+			});
+		}
+		REQUIRE_THROWS_AS(executor.WorkOnTasks(), IOException);
+	}
+
+	// the executor can be reused after an error
+	{
+		TaskExecutor executor(scheduler);
+		executor.ScheduleTask([]() { throw ConversionException("first error"); });
+		REQUIRE_THROWS_AS(executor.WorkOnTasks(), ConversionException);
+		sum = 0;
+		executor.ScheduleTask([&sum]() { sum += 1; });
+		executor.WorkOnTasks();
+		REQUIRE(sum == 1);
+	}
+}
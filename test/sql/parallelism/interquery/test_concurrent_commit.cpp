@@ -0,0 +1,199 @@
+#include "catch.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/storage/write_ahead_log.hpp"
+#include "test_helpers.hpp"
+
+#include <atomic>
+#include <thread>
+
+using namespace duckdb;
+using namespace std;
+
+static constexpr int CONCURRENT_COMMIT_THREAD_COUNT = 8;
+static constexpr int CONCURRENT_COMMIT_INSERT_COUNT = 50;
+
+static void CommitInserts(DuckDB *db, int *acknowledged, int threadnr) {
+	acknowledged[threadnr] = 0;
+	Connection con(*db);
+	for (int i = 0; i < CONCURRENT_COMMIT_INSERT_COUNT; i++) {
+		// every insert is committed (and synced) on its own
+		auto value = threadnr * CONCURRENT_COMMIT_INSERT_COUNT + i;
+		auto result = con.Query("INSERT INTO integers VALUES (" + to_string(value) + ")");
+		if (!result->success) {
+			return;
+		}
+		acknowledged[threadnr]++;
+	}
+}
+
+TEST_CASE("Concurrent commits are grouped into WAL syncs", "[interquery]") {
+	auto config = GetTestConfig();
+	config->checkpoint_on_shutdown = false;
+	// commits that checkpoint the database are not written to the WAL
+	config->checkpoint_wal_size = idx_t(1) << 30;
+	auto storage_database = TestCreatePath("concurrent_commit");
+	int acknowledged[CONCURRENT_COMMIT_THREAD_COUNT];
+	DeleteDatabase(storage_database);
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER)"));
+		// give concurrent commits time to join a sync
+		REQUIRE_NO_FAIL(con.Query("PRAGMA wal_commit_delay=1000"));
+
+		auto result = con.Query("SELECT commits, syncs FROM pragma_wal_stats()");
+		REQUIRE(result->success);
+		auto initial_commits = result->collection.GetValue(0, 0).GetValue<int64_t>();
+		auto initial_syncs = result->collection.GetValue(1, 0).GetValue<int64_t>();
+
+		thread threads[CONCURRENT_COMMIT_THREAD_COUNT];
+		for (int i = 0; i < CONCURRENT_COMMIT_THREAD_COUNT; i++) {
+			threads[i] = thread(CommitInserts, &db, acknowledged, i);
+		}
+		for (int i = 0; i < CONCURRENT_COMMIT_THREAD_COUNT; i++) {
+			threads[i].join();
+			REQUIRE(acknowledged[i] == CONCURRENT_COMMIT_INSERT_COUNT);
+		}
+
+		result = con.Query("SELECT commits, syncs, commit_delay FROM pragma_wal_stats()");
+		REQUIRE(result->success);
+		auto commits = result->collection.GetValue(0, 0).GetValue<int64_t>() - initial_commits;
+		auto syncs = result->collection.GetValue(1, 0).GetValue<int64_t>() - initial_syncs;
+		REQUIRE(commits == CONCURRENT_COMMIT_THREAD_COUNT * CONCURRENT_COMMIT_INSERT_COUNT);
+		REQUIRE(syncs > 0);
+		REQUIRE(syncs <= commits);
+		REQUIRE(CHECK_COLUMN(result, 2, {Value::BIGINT(1000)}));
+	}
+	// every acknowledged commit is durable: the database is not checkpointed, so they are replayed from the WAL
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		for (int i = 0; i < CONCURRENT_COMMIT_THREAD_COUNT; i++) {
+			auto first_value = i * CONCURRENT_COMMIT_INSERT_COUNT;
+			auto result = con.Query("SELECT COUNT(*) FROM integers WHERE i >= " + to_string(first_value) +
+			                        " AND i < " + to_string(first_value + acknowledged[i]));
+			REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(acknowledged[i])}));
+		}
+		auto result = con.Query("SELECT COUNT(*) FROM integers");
+		REQUIRE(
+		    CHECK_COLUMN(result, 0, {Value::BIGINT(CONCURRENT_COMMIT_THREAD_COUNT * CONCURRENT_COMMIT_INSERT_COUNT)}));
+	}
+	DeleteDatabase(storage_database);
+}
+
+//! File system that holds the next sync of the WAL until it is released
+class SyncBlockingFileSystem : public FileSystem {
+public:
+	std::atomic<bool> block_next_sync {false};
+	std::atomic<bool> release_sync {false};
+
+	void FileSync(FileHandle &handle) override {
+		if (StringUtil::EndsWith(handle.path, ".wal") && block_next_sync.exchange(false)) {
+			while (!release_sync) {
+				std::this_thread::yield();
+			}
+		}
+		FileSystem::FileSync(handle);
+	}
+};
+
+static void CommitInsert(DuckDB *db, bool *success, int threadnr) {
+	Connection con(*db);
+	success[threadnr] = con.Query("INSERT INTO integers VALUES (" + to_string(threadnr) + ")")->success;
+}
+
+TEST_CASE("Commits that wait for a WAL sync share the next sync", "[interquery]") {
+	auto config = GetTestConfig();
+	config->checkpoint_wal_size = idx_t(1) << 30;
+	auto file_system = new SyncBlockingFileSystem();
+	config->file_system = unique_ptr<FileSystem>(file_system);
+	auto storage_database = TestCreatePath("concurrent_commit_sync");
+	bool success[CONCURRENT_COMMIT_THREAD_COUNT];
+	DeleteDatabase(storage_database);
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER)"));
+		auto log = StorageManager::GetStorageManager(*db.instance).GetWriteAheadLog();
+		auto initial_commits = log->GetCommitCount();
+		auto initial_syncs = log->GetSyncCount();
+
+		// the first commit that syncs the WAL is held until all other commits are waiting for it
+		file_system->block_next_sync = true;
+		thread threads[CONCURRENT_COMMIT_THREAD_COUNT];
+		for (int i = 0; i < CONCURRENT_COMMIT_THREAD_COUNT; i++) {
+			threads[i] = thread(CommitInsert, &db, success, i);
+		}
+		while (log->GetSyncWaiters() < CONCURRENT_COMMIT_THREAD_COUNT - 1) {
+			std::this_thread::yield();
+		}
+		// new transactions start without waiting for the sync, but do not see the commits that are not durable yet
+		auto result = con.Query("SELECT COUNT(*) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(0)}));
+
+		file_system->release_sync = true;
+		for (int i = 0; i < CONCURRENT_COMMIT_THREAD_COUNT; i++) {
+			threads[i].join();
+		}
+		for (int i = 0; i < CONCURRENT_COMMIT_THREAD_COUNT; i++) {
+			REQUIRE(success[i]);
+		}
+		result = con.Query("SELECT COUNT(*) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(CONCURRENT_COMMIT_THREAD_COUNT)}));
+
+		// the waiting commits are made durable by at most one more sync
+		REQUIRE(log->GetCommitCount() - initial_commits == CONCURRENT_COMMIT_THREAD_COUNT);
+		auto syncs = log->GetSyncCount() - initial_syncs;
+		REQUIRE(syncs >= 1);
+		REQUIRE(syncs <= 2);
+
+		// flushing the WAL outside of a commit syncs it, but is not counted as a commit
+		REQUIRE_NO_FAIL(con.Query("CHECKPOINT"));
+		REQUIRE(log->GetCommitCount() - initial_commits == CONCURRENT_COMMIT_THREAD_COUNT);
+	}
+	DeleteDatabase(storage_database);
+}
+
+//! File system that fails to sync the WAL while fail_sync is set
+class SyncFailingFileSystem : public FileSystem {
+public:
+	std::atomic<bool> fail_sync {false};
+
+	void FileSync(FileHandle &handle) override {
+		if (StringUtil::EndsWith(handle.path, ".wal") && fail_sync) {
+			throw IOException("Could not sync file \"%s\"", handle.path);
+		}
+		FileSystem::FileSync(handle);
+	}
+};
+
+TEST_CASE("Commits stay hidden when the WAL sync fails", "[interquery]") {
+	auto config = GetTestConfig();
+	config->checkpoint_on_shutdown = false;
+	config->checkpoint_wal_size = idx_t(1) << 30;
+	auto file_system = new SyncFailingFileSystem();
+	config->file_system = unique_ptr<FileSystem>(file_system);
+	auto storage_database = TestCreatePath("concurrent_commit_sync_failure");
+	DeleteDatabase(storage_database);
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER)"));
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO integers VALUES (1)"));
+
+		// the commit is not durable: it fails and is not visible to new transactions
+		file_system->fail_sync = true;
+		REQUIRE_FAIL(con.Query("INSERT INTO integers VALUES (2)"));
+		auto result = con.Query("SELECT SUM(i) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(1)}));
+
+		// the entries before the failed sync might be lost: later commits fail as well, even if syncing works again
+		file_system->fail_sync = false;
+		REQUIRE_FAIL(con.Query("INSERT INTO integers VALUES (3)"));
+		result = con.Query("SELECT SUM(i) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(1)}));
+	}
+	DeleteDatabase(storage_database);
+}
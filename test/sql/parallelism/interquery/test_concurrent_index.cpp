@@ -1,5 +1,9 @@
 #include "catch.hpp"
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/main/appender.hpp"
+#include "duckdb/main/client_context.hpp"
 #include "test_helpers.hpp"
 
 #include <atomic>
@@ -301,3 +305,126 @@ TEST_CASE("Parallel appends to table with index with transactions", "[index][.]"
 	REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(CONCURRENT_INDEX_THREAD_COUNT * 50)}));
 	REQUIRE(CHECK_COLUMN(result, 1, {Value::BIGINT(CONCURRENT_INDEX_THREAD_COUNT * 50)}));
 }
+
+#define CONCURRENT_LOOKUP_READER_COUNT 8
+#define CONCURRENT_LOOKUP_KEY_COUNT 1000
+
+static void lookup_in_integers(DuckDB *db, bool *correct, idx_t threadnr) {
+	Connection con(*db);
+	correct[threadnr] = true;
+	std::mt19937 gen;
+	gen.seed(threadnr);
+	std::uniform_int_distribution<> distribution(0, CONCURRENT_LOOKUP_KEY_COUNT - 1);
+	while (!is_finished) {
+		// the keys that are a multiple of ten are never modified by the writers
+		auto key = distribution(gen) * 10;
+		auto result = con.Query("SELECT COUNT(*), MIN(j) FROM integers WHERE i = " + to_string(key));
+		if (!CHECK_COLUMN(result, 0, {Value::BIGINT(1)}) || !CHECK_COLUMN(result, 1, {Value::INTEGER(key * 2)})) {
+			correct[threadnr] = false;
+		}
+		// index joins probe the index in the same way
+		result = con.Query("SELECT COUNT(*) FROM (SELECT " + to_string(key) + " AS k) t JOIN integers ON t.k = i");
+		if (!CHECK_COLUMN(result, 0, {Value::BIGINT(1)})) {
+			correct[threadnr] = false;
+		}
+	}
+}
+
+TEST_CASE("Concurrent point lookups during index appends and deletes", "[index]") {
+	unique_ptr<QueryResult> result;
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER PRIMARY KEY, j INTEGER)"));
+	REQUIRE_NO_FAIL(con.Query("INSERT INTO integers SELECT i * 10, i * 20 FROM range(0, " +
+	                          to_string(CONCURRENT_LOOKUP_KEY_COUNT) + ") t(i)"));
+
+	is_finished = false;
+	bool correct[CONCURRENT_LOOKUP_READER_COUNT];
+	thread threads[CONCURRENT_LOOKUP_READER_COUNT];
+	for (idx_t i = 0; i < CONCURRENT_LOOKUP_READER_COUNT; i++) {
+		threads[i] = thread(lookup_in_integers, &db, correct, i);
+	}
+
+	// fill up the nodes around the keys the readers look up, so they grow (and shrink again when the keys are deleted)
+	for (idx_t offset = 1; offset < 10; offset++) {
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO integers SELECT i * 10 + " + to_string(offset) +
+		                          ", 0 FROM range(0, " + to_string(CONCURRENT_LOOKUP_KEY_COUNT) + ") t(i)"));
+	}
+	for (idx_t offset = 1; offset < 10; offset += 2) {
+		REQUIRE_NO_FAIL(con.Query("DELETE FROM integers WHERE i % 10 = " + to_string(offset)));
+	}
+	is_finished = true;
+
+	for (idx_t i = 0; i < CONCURRENT_LOOKUP_READER_COUNT; i++) {
+		threads[i].join();
+		REQUIRE(correct[i]);
+	}
+
+	result = con.Query("SELECT COUNT(*), SUM(j) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(CONCURRENT_LOOKUP_KEY_COUNT * 5)}));
+	REQUIRE(CHECK_COLUMN(result, 1, {Value::BIGINT(9990000)}));
+	result = con.Query("SELECT COUNT(*) FROM integers WHERE i = 9995");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(0)}));
+	result = con.Query("SELECT COUNT(*) FROM integers WHERE i = 9996");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(1)}));
+}
+
+static void lookup_in_integers_without_check(DuckDB *db, idx_t threadnr) {
+	Connection con(*db);
+	idx_t key = threadnr;
+	while (!is_finished) {
+		con.Query("SELECT COUNT(*) FROM integers WHERE i = " + to_string(key % CONCURRENT_LOOKUP_KEY_COUNT));
+		key += CONCURRENT_LOOKUP_READER_COUNT;
+	}
+}
+
+TEST_CASE("Retired index nodes are freed during concurrent point lookups", "[index]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER PRIMARY KEY)"));
+	REQUIRE_NO_FAIL(con.Query("INSERT INTO integers SELECT * FROM range(0, " +
+	                          to_string(CONCURRENT_LOOKUP_KEY_COUNT) + ") t(i)"));
+	ART *art = nullptr;
+	con.context->RunFunctionInTransaction([&]() {
+		auto table = Catalog::GetCatalog(*con.context).GetEntry<TableCatalogEntry>(*con.context, DEFAULT_SCHEMA,
+		                                                                            "integers");
+		art = (ART *)table->storage->info->indexes[0].get();
+	});
+
+	is_finished = false;
+	thread threads[CONCURRENT_LOOKUP_READER_COUNT];
+	for (idx_t i = 0; i < CONCURRENT_LOOKUP_READER_COUNT; i++) {
+		threads[i] = thread(lookup_in_integers_without_check, &db, i);
+	}
+
+	// a reader that stays inside the tree keeps the nodes retired by the deletes alive
+	auto slot = art->EnterReader();
+	for (idx_t key = 0; key < CONCURRENT_LOOKUP_KEY_COUNT / 2; key += 2) {
+		REQUIRE_NO_FAIL(con.Query("DELETE FROM integers WHERE i = " + to_string(key)));
+	}
+	auto retired_count = art->RetiredCount();
+	art->LeaveReader(slot);
+
+	// once it has left, the nodes are freed by the next deletes, even though the other readers keep looking up keys
+	idx_t key = CONCURRENT_LOOKUP_KEY_COUNT / 2;
+	while (art->RetiredCount() >= retired_count && key < CONCURRENT_LOOKUP_KEY_COUNT) {
+		REQUIRE_NO_FAIL(con.Query("DELETE FROM integers WHERE i = " + to_string(key)));
+		key += 2;
+	}
+	auto retired_after_leaving = art->RetiredCount();
+	is_finished = true;
+
+	for (idx_t i = 0; i < CONCURRENT_LOOKUP_READER_COUNT; i++) {
+		threads[i].join();
+	}
+	REQUIRE(retired_count > 0);
+	REQUIRE(retired_after_leaving < retired_count);
+	// without readers all retired nodes are freed
+	REQUIRE_NO_FAIL(con.Query("DELETE FROM integers WHERE i = " + to_string(key)));
+	REQUIRE(art->RetiredCount() == 0);
+
+	auto result = con.Query("SELECT COUNT(*) FROM integers WHERE i % 2 = 1");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(CONCURRENT_LOOKUP_KEY_COUNT / 2)}));
+}
@@ -1,8 +1,11 @@
 #include "catch.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "test_helpers.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <thread>
+
 using namespace duckdb;
 using namespace std;
 
@@ -222,3 +225,140 @@ TEST_CASE("Modifying the buffer manager limit at runtime for an in-memory databa
 	REQUIRE_NO_FAIL(con.Query("DROP TABLE test"));
 	REQUIRE_NO_FAIL(con.Query("PRAGMA memory_limit='1MB'"));
 }
+
+TEST_CASE("Test offloading blocks to the shared temporary file", "[storage]") {
+	auto storage_database = TestCreatePath("storage_test");
+	auto temp_directory = storage_database + ".tmp";
+	auto config = GetTestConfig();
+	// set the maximum memory to 10MB
+	config->maximum_memory = 10000000;
+
+	DeleteDatabase(storage_database);
+	{
+		DuckDB db(storage_database, config.get());
+		auto &buffer_manager = BufferManager::GetBufferManager(*db.instance);
+		auto &fs = FileSystem::GetFileSystem(*db.instance);
+
+		auto count_temp_files = [&]() {
+			idx_t file_count = 0;
+			fs.ListFiles(temp_directory, [&](string path, bool is_dir) { file_count++; });
+			return file_count;
+		};
+
+		// register 40MB worth of blocks, filling every block with its index
+		idx_t block_count = 4 * config->maximum_memory / Storage::BLOCK_ALLOC_SIZE;
+		vector<shared_ptr<BlockHandle>> blocks;
+		for (idx_t i = 0; i < block_count; i++) {
+			auto block = buffer_manager.RegisterMemory(Storage::BLOCK_ALLOC_SIZE, false);
+			auto handle = buffer_manager.Pin(block);
+			memset(handle->Ptr(), (int)(i % 256), Storage::BLOCK_SIZE);
+			blocks.push_back(move(block));
+		}
+		// the offloaded blocks all end up in a single temporary file
+		REQUIRE(count_temp_files() == 1);
+
+		// every block can be read back
+		for (idx_t i = 0; i < block_count; i++) {
+			auto handle = buffer_manager.Pin(blocks[i]);
+			auto ptr = handle->Ptr();
+			REQUIRE(ptr[0] == (data_t)(i % 256));
+			REQUIRE(ptr[Storage::BLOCK_SIZE - 1] == (data_t)(i % 256));
+		}
+		REQUIRE(count_temp_files() == 1);
+
+		// destroying the blocks removes the temporary file
+		blocks.clear();
+		REQUIRE(count_temp_files() == 0);
+	}
+	DeleteDatabase(storage_database);
+}
+
+static void scan_table_concurrently(DuckDB *db, bool *correct, idx_t thread_nr, Value expected_sum) {
+	Connection con(*db);
+	correct[thread_nr] = true;
+	for (idx_t i = 0; i < 5; i++) {
+		auto result = con.Query("SELECT SUM(a) FROM test");
+		if (!CHECK_COLUMN(result, 0, {expected_sum})) {
+			correct[thread_nr] = false;
+		}
+	}
+}
+
+TEST_CASE("Test concurrently loading persistent blocks that exceed buffer manager size", "[storage]") {
+	constexpr idx_t SCAN_THREAD_COUNT = 8;
+	auto storage_database = TestCreatePath("storage_test");
+	auto config = GetTestConfig();
+
+	// create a table of roughly 40MB
+	DeleteDatabase(storage_database);
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE test AS SELECT i AS a FROM range(0, 5000000, 1) t(i)"));
+	}
+	// reload the database with a memory limit of 10MB, so the blocks have to be read from disk again and again
+	config->maximum_memory = 10000000;
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("PRAGMA threads=4"));
+
+		auto expected_sum = Value::HUGEINT(hugeint_t(4999999) * hugeint_t(5000000) / hugeint_t(2));
+		bool correct[SCAN_THREAD_COUNT];
+		thread threads[SCAN_THREAD_COUNT];
+		for (idx_t i = 0; i < SCAN_THREAD_COUNT; i++) {
+			threads[i] = thread(scan_table_concurrently, &db, correct, i, expected_sum);
+		}
+		for (idx_t i = 0; i < SCAN_THREAD_COUNT; i++) {
+			threads[i].join();
+			REQUIRE(correct[i]);
+		}
+	}
+	DeleteDatabase(storage_database);
+}
+
+static int64_t count_pin_misses(Connection &con, const string &query) {
+	auto before = con.Query("SELECT misses FROM pragma_buffer_manager_stats()");
+	REQUIRE_NO_FAIL(*before);
+	REQUIRE_NO_FAIL(con.Query(query));
+	auto after = con.Query("SELECT misses FROM pragma_buffer_manager_stats()");
+	REQUIRE_NO_FAIL(*after);
+	return after->GetValue(0, 0).GetValue<int64_t>() - before->GetValue(0, 0).GetValue<int64_t>();
+}
+
+TEST_CASE("Test that a large scan does not evict frequently used blocks with the 2Q eviction policy", "[storage]") {
+	auto storage_database = TestCreatePath("storage_test");
+	auto config = GetTestConfig();
+
+	// create a small table of roughly 2MB, a medium table of roughly 8MB and a big table of roughly 20MB
+	DeleteDatabase(storage_database);
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE hot AS SELECT i::INTEGER AS a FROM range(0, 500000, 1) t(i)"));
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE medium AS SELECT i::INTEGER AS a FROM range(0, 2000000, 1) t(i)"));
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE big AS SELECT i::INTEGER AS a FROM range(0, 5000000, 1) t(i)"));
+	}
+	// reload the database with a memory limit of 10MB, so the big table does not fit in memory
+	config->maximum_memory = 10000000;
+	for (auto policy : {BufferEvictionPolicy::LRU, BufferEvictionPolicy::TWO_QUEUE}) {
+		config->eviction_policy = policy;
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("PRAGMA threads=1"));
+
+		// the blocks of the small table are loaded and then used again after the correlated reference period
+		REQUIRE(count_pin_misses(con, "SELECT SUM(a) FROM hot") > 0);
+		REQUIRE(count_pin_misses(con, "SELECT SUM(a) FROM medium") > 0);
+		REQUIRE(count_pin_misses(con, "SELECT SUM(a) FROM hot") == 0);
+		// scan the big table: with 2Q the blocks of the small table are protected and stay in memory
+		REQUIRE(count_pin_misses(con, "SELECT SUM(a) FROM big") > 0);
+		auto hot_misses = count_pin_misses(con, "SELECT SUM(a) FROM hot");
+		if (policy == BufferEvictionPolicy::LRU) {
+			REQUIRE(hot_misses > 0);
+		} else {
+			REQUIRE(hot_misses == 0);
+		}
+	}
+	DeleteDatabase(storage_database);
+}
@@ -74,3 +74,54 @@ TEST_CASE("Test interleaving of insertions/updates/deletes on multiple tables",
 	}
 	DeleteDatabase(storage_database);
 }
+
+TEST_CASE("Test checkpointing many columns with a small memory limit", "[storage]") {
+	unique_ptr<QueryResult> result;
+	auto storage_database = TestCreatePath("storage_test");
+	idx_t table_count = 50;
+	idx_t column_count = 20;
+
+	// make sure the database does not exist
+	DeleteDatabase(storage_database);
+	{
+		// create many tables with many columns, they are written to disk when the database is closed
+		DuckDB db(storage_database);
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("BEGIN TRANSACTION"));
+		for (idx_t table_idx = 0; table_idx < table_count; table_idx++) {
+			string table_name = "t" + to_string(table_idx);
+			string columns, values;
+			for (idx_t col_idx = 0; col_idx < column_count; col_idx++) {
+				columns += string(col_idx > 0 ? ", " : "") + "c" + to_string(col_idx) + " INTEGER";
+				values += string(col_idx > 0 ? ", " : "") + to_string(col_idx);
+			}
+			REQUIRE_NO_FAIL(con.Query("CREATE TABLE " + table_name + " (" + columns + ")"));
+			REQUIRE_NO_FAIL(con.Query("INSERT INTO " + table_name + " VALUES (" + values + ")"));
+		}
+		REQUIRE_NO_FAIL(con.Query("COMMIT"));
+	}
+	{
+		// the columns that are not checkpointed at the same time do not all have to fit in memory together
+		DBConfig config;
+		config.maximum_memory = 32 * 1024 * 1024;
+		config.use_temporary_directory = false;
+		DuckDB db(storage_database, &config);
+		Connection con(db);
+		for (idx_t table_idx = 0; table_idx < table_count; table_idx += 10) {
+			REQUIRE_NO_FAIL(con.Query("INSERT INTO t" + to_string(table_idx) + " SELECT * FROM t" +
+			                          to_string(table_idx)));
+		}
+		REQUIRE_NO_FAIL(con.Query("CHECKPOINT"));
+	}
+	{
+		DuckDB db(storage_database);
+		Connection con(db);
+		result = con.Query("SELECT COUNT(*), SUM(c19) FROM t0");
+		REQUIRE(CHECK_COLUMN(result, 0, {2}));
+		REQUIRE(CHECK_COLUMN(result, 1, {38}));
+		result = con.Query("SELECT COUNT(*), SUM(c19) FROM t49");
+		REQUIRE(CHECK_COLUMN(result, 0, {1}));
+		REQUIRE(CHECK_COLUMN(result, 1, {19}));
+	}
+	DeleteDatabase(storage_database);
+}
@@ -1234,4 +1234,59 @@ robj *hll_merge(robj **hlls, size_t hll_count) {
         }
     }
 	return result;
-}
\ No newline at end of file
+}
+size_t hll_serialized_size(robj *o) {
+	return sdslen((sds) o->ptr);
+}
+
+unsigned char *hll_serialized_data(robj *o) {
+	return (unsigned char *) o->ptr;
+}
+
+robj *hll_deserialize(const unsigned char *data, size_t size) {
+	struct hllhdr *hdr;
+
+	/* Check the header and the size of the representation. */
+	if (size < HLL_HDR_SIZE) return NULL;
+	hdr = (struct hllhdr *) data;
+	if (memcmp(hdr->magic,"HYLL",4) != 0) return NULL;
+	if (hdr->encoding > HLL_MAX_ENCODING) return NULL;
+	if (hdr->encoding == HLL_DENSE && size != HLL_DENSE_SIZE) return NULL;
+
+	return createObject(sdsnewlen(data,size));
+}
+
+int hll_to_dense(robj *o) {
+	return hllSparseToDense(o);
+}
+
+int hll_add_hashes(robj *o, const uint64_t *hashes, size_t count) {
+    struct hllhdr *hdr = (struct hllhdr *) o->ptr;
+    size_t i;
+
+    if (hdr->encoding != HLL_DENSE) return C_ERR;
+    for (i = 0; i < count; i++) {
+        uint64_t hash = hashes[i], bit = 1;
+        long index;
+        uint8_t patlen = 1;
+
+        /* Finalize the hash (the MurmurHash3 fmix64 step) so that every
+         * input bit affects the register index and the zero-run count. */
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53ULL;
+        hash ^= hash >> 33;
+
+        /* Same as hllPatLen(), but on the finalized hash. */
+        index = hash & HLL_P_MASK;
+        hash >>= HLL_P;
+        hash |= ((uint64_t)1<<HLL_Q);
+        while((hash & bit) == 0) {
+            patlen++;
+            bit <<= 1;
+        }
+        hllDenseSet(hdr->registers,index,patlen);
+    }
+    return C_OK;
+}
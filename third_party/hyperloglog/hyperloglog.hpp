@@ -33,6 +33,18 @@ int hll_add(robj *o, unsigned char *ele, size_t elesize);
 int hll_count(robj *o, size_t *result);
 //! Merge hll_count HyperLogLog objects into a single one. Returns NULL on failure, or the new HLL object on success.
 robj *hll_merge(robj **hlls, size_t hll_count);
+//! Returns the size in bytes of the serialized representation of the HyperLogLog object.
+size_t hll_serialized_size(robj *o);
+//! Returns a pointer to the serialized representation of the HyperLogLog object.
+unsigned char *hll_serialized_data(robj *o);
+//! Create a HyperLogLog object from a serialized representation. Returns NULL if the representation is invalid.
+robj *hll_deserialize(const unsigned char *data, size_t size);
+//! Convert the HyperLogLog object to the dense representation, which is larger but makes adding elements much faster.
+//! Returns C_OK on success, or C_ERR on failure.
+int hll_to_dense(robj *o);
+//! Add a batch of (already hashed) 64-bit elements to a HyperLogLog object in the dense representation. Returns C_OK on
+//! success, or C_ERR if the HyperLogLog object is not dense.
+int hll_add_hashes(robj *o, const uint64_t *hashes, size_t count);
 
 uint64_t MurmurHash64A (const void * key, int len, unsigned int seed);
 